@@ -0,0 +1,102 @@
+# CMAKE generated file: DO NOT EDIT!
+# Generated by "Unix Makefiles" Generator, CMake Version 3.25
+
+# The generator used is:
+set(CMAKE_DEPENDS_GENERATOR "Unix Makefiles")
+
+# The top level Makefile was generated from the following files:
+set(CMAKE_MAKEFILE_DEPENDS
+  "CMakeCache.txt"
+  "/root/repo/CMakeLists.txt"
+  "CMakeFiles/3.25.1/CMakeCCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeCXXCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeSystem.cmake"
+  "CMakeFiles/hdf5/cmake_hdf5_test.c"
+  "/root/repo/benchmarks/CMakeLists.txt"
+  "/root/repo/cmake/CheckCXXOptional.cmake"
+  "/root/repo/cmake/DeprecationWarnings.cmake"
+  "/root/repo/cmake/HDF5TargetUtils.cmake"
+  "/root/repo/cmake/PrintBuildInfo.cmake"
+  "/root/repo/cmake/PrintTargetInfo.cmake"
+  "/root/repo/cmake/SetupDependencies.cmake"
+  "/root/repo/cmake/SetupPaths.cmake"
+  "/root/repo/cmake/h5ppConfig.cmake.in"
+  "/root/repo/cmake/h5ppDeps.cmake.in"
+  "/root/repo/cmake/h5ppUninstall.cmake.in"
+  "/root/repo/cmake/h5ppVars.cmake.in"
+  "/root/repo/cmake/modules/FindFilesystem.cmake"
+  "/usr/share/cmake-3.25/Modules/BasicConfigVersion-AnyNewerVersion.cmake.in"
+  "/usr/share/cmake-3.25/Modules/CMakeCInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCXXInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCommonLanguageInclude.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeGenericSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeInitializeConfigs.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeLanguageInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakePackageConfigHelpers.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakePushCheckState.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInitialize.cmake"
+  "/usr/share/cmake-3.25/Modules/CPack.cmake"
+  "/usr/share/cmake-3.25/Modules/CPackComponent.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCXXSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFile.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFileCXX.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckLibraryExists.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/CMakeCommonCompilerMacros.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/FindHDF5.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageHandleStandardArgs.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageMessage.cmake"
+  "/usr/share/cmake-3.25/Modules/FindThreads.cmake"
+  "/usr/share/cmake-3.25/Modules/FindZLIB.cmake"
+  "/usr/share/cmake-3.25/Modules/GNUInstallDirs.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/UnixPaths.cmake"
+  "/usr/share/cmake-3.25/Modules/SelectLibraryConfigurations.cmake"
+  "/usr/share/cmake-3.25/Modules/WriteBasicConfigVersionFile.cmake"
+  "/usr/share/cmake-3.25/Templates/CPackConfig.cmake.in"
+  )
+
+# The corresponding makefile is:
+set(CMAKE_MAKEFILE_OUTPUTS
+  "Makefile"
+  "CMakeFiles/cmake.check_cache"
+  )
+
+# Byproducts of CMake generate step:
+set(CMAKE_MAKEFILE_PRODUCTS
+  "h5ppConfig.cmake"
+  "h5ppDeps.cmake"
+  "h5ppVars.cmake"
+  "h5ppConfigVersion.cmake"
+  "h5ppUninstall.cmake"
+  "CPackConfig.cmake"
+  "CPackSourceConfig.cmake"
+  "CMakeFiles/CMakeDirectoryInformation.cmake"
+  "benchmarks/CMakeFiles/CMakeDirectoryInformation.cmake"
+  )
+
+# Dependency information for all targets:
+set(CMAKE_DEPEND_INFO_FILES
+  "CMakeFiles/h5pp-uninstall.dir/DependInfo.cmake"
+  "benchmarks/CMakeFiles/h5pp-benchmark-all.dir/DependInfo.cmake"
+  "benchmarks/CMakeFiles/h5pp-benchmark-run.dir/DependInfo.cmake"
+  "benchmarks/CMakeFiles/h5pp-benchmark-conversion.dir/DependInfo.cmake"
+  "benchmarks/CMakeFiles/h5pp-benchmark-datasetBatch.dir/DependInfo.cmake"
+  "benchmarks/CMakeFiles/h5pp-benchmark-findLinks.dir/DependInfo.cmake"
+  "benchmarks/CMakeFiles/h5pp-benchmark-fixedStrings.dir/DependInfo.cmake"
+  "benchmarks/CMakeFiles/h5pp-benchmark-hidCheck.dir/DependInfo.cmake"
+  "benchmarks/CMakeFiles/h5pp-benchmark-overhead.dir/DependInfo.cmake"
+  "benchmarks/CMakeFiles/h5pp-benchmark-readAllAttributes.dir/DependInfo.cmake"
+  "benchmarks/CMakeFiles/h5pp-benchmark-readText.dir/DependInfo.cmake"
+  "benchmarks/CMakeFiles/h5pp-benchmark-snapshot.dir/DependInfo.cmake"
+  "benchmarks/CMakeFiles/h5pp-benchmark-typeRegistry.dir/DependInfo.cmake"
+  "benchmarks/CMakeFiles/h5pp-benchmark-xferBuffer.dir/DependInfo.cmake"
+  )
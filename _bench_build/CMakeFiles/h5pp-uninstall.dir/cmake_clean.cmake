@@ -0,0 +1,8 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/h5pp-uninstall"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/h5pp-uninstall.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
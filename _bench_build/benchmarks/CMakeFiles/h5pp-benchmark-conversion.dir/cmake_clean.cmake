@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/h5pp-benchmark-conversion.dir/benchmark-conversion.cpp.o"
+  "CMakeFiles/h5pp-benchmark-conversion.dir/benchmark-conversion.cpp.o.d"
+  "h5pp-benchmark-conversion"
+  "h5pp-benchmark-conversion.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/h5pp-benchmark-conversion.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
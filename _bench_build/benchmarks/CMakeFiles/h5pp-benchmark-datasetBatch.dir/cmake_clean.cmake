@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/h5pp-benchmark-datasetBatch.dir/benchmark-datasetBatch.cpp.o"
+  "CMakeFiles/h5pp-benchmark-datasetBatch.dir/benchmark-datasetBatch.cpp.o.d"
+  "h5pp-benchmark-datasetBatch"
+  "h5pp-benchmark-datasetBatch.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/h5pp-benchmark-datasetBatch.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/h5pp-benchmark-findLinks.dir/benchmark-findLinks.cpp.o"
+  "CMakeFiles/h5pp-benchmark-findLinks.dir/benchmark-findLinks.cpp.o.d"
+  "h5pp-benchmark-findLinks"
+  "h5pp-benchmark-findLinks.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/h5pp-benchmark-findLinks.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/h5pp-benchmark-fixedStrings.dir/benchmark-fixedStrings.cpp.o"
+  "CMakeFiles/h5pp-benchmark-fixedStrings.dir/benchmark-fixedStrings.cpp.o.d"
+  "h5pp-benchmark-fixedStrings"
+  "h5pp-benchmark-fixedStrings.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/h5pp-benchmark-fixedStrings.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/h5pp-benchmark-hidCheck.dir/benchmark-hidCheck.cpp.o"
+  "CMakeFiles/h5pp-benchmark-hidCheck.dir/benchmark-hidCheck.cpp.o.d"
+  "h5pp-benchmark-hidCheck"
+  "h5pp-benchmark-hidCheck.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/h5pp-benchmark-hidCheck.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
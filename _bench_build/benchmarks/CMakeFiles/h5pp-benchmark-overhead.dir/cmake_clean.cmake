@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/h5pp-benchmark-overhead.dir/benchmark-overhead.cpp.o"
+  "CMakeFiles/h5pp-benchmark-overhead.dir/benchmark-overhead.cpp.o.d"
+  "h5pp-benchmark-overhead"
+  "h5pp-benchmark-overhead.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/h5pp-benchmark-overhead.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
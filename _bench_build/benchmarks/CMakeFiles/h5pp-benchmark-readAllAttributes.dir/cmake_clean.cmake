@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/h5pp-benchmark-readAllAttributes.dir/benchmark-readAllAttributes.cpp.o"
+  "CMakeFiles/h5pp-benchmark-readAllAttributes.dir/benchmark-readAllAttributes.cpp.o.d"
+  "h5pp-benchmark-readAllAttributes"
+  "h5pp-benchmark-readAllAttributes.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/h5pp-benchmark-readAllAttributes.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
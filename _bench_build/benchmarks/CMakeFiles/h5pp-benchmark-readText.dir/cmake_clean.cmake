@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/h5pp-benchmark-readText.dir/benchmark-readText.cpp.o"
+  "CMakeFiles/h5pp-benchmark-readText.dir/benchmark-readText.cpp.o.d"
+  "h5pp-benchmark-readText"
+  "h5pp-benchmark-readText.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/h5pp-benchmark-readText.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/h5pp-benchmark-snapshot.dir/benchmark-snapshot.cpp.o"
+  "CMakeFiles/h5pp-benchmark-snapshot.dir/benchmark-snapshot.cpp.o.d"
+  "h5pp-benchmark-snapshot"
+  "h5pp-benchmark-snapshot.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/h5pp-benchmark-snapshot.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
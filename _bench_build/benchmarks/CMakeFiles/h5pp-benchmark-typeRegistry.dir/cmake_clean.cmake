@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/h5pp-benchmark-typeRegistry.dir/benchmark-typeRegistry.cpp.o"
+  "CMakeFiles/h5pp-benchmark-typeRegistry.dir/benchmark-typeRegistry.cpp.o.d"
+  "h5pp-benchmark-typeRegistry"
+  "h5pp-benchmark-typeRegistry.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/h5pp-benchmark-typeRegistry.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
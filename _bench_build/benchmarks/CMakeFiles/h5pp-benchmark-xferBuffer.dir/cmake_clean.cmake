@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/h5pp-benchmark-xferBuffer.dir/benchmark-xferBuffer.cpp.o"
+  "CMakeFiles/h5pp-benchmark-xferBuffer.dir/benchmark-xferBuffer.cpp.o.d"
+  "h5pp-benchmark-xferBuffer"
+  "h5pp-benchmark-xferBuffer.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/h5pp-benchmark-xferBuffer.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
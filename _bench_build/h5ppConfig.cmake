@@ -0,0 +1,45 @@
+
+####### Expanded from @PACKAGE_INIT@ by configure_package_config_file() #######
+####### Any changes to this file will be overwritten by the next CMake run ####
+####### The input file was h5ppConfig.cmake.in                            ########
+
+get_filename_component(PACKAGE_PREFIX_DIR "${CMAKE_CURRENT_LIST_DIR}/../../../" ABSOLUTE)
+
+macro(set_and_check _var _file)
+  set(${_var} "${_file}")
+  if(NOT EXISTS "${_file}")
+    message(FATAL_ERROR "File or directory ${_file} referenced by variable ${_var} does not exist !")
+  endif()
+endmacro()
+
+macro(check_required_components _NAME)
+  foreach(comp ${${_NAME}_FIND_COMPONENTS})
+    if(NOT ${_NAME}_${comp}_FOUND)
+      if(${_NAME}_FIND_REQUIRED_${comp})
+        set(${_NAME}_FOUND FALSE)
+      endif()
+    endif()
+  endforeach()
+endmacro()
+
+####################################################################################
+
+if(h5pp_FOUND)
+    return()
+endif()
+
+
+##################################################################
+### Preempt Threads::Threads                                   ###
+### It's looked for in dependencies, so we make it right       ###
+### before it's done wrong, i.e. with pthread instead of       ###
+### -lpthread which causes link errors downstream with         ###
+###    -Wl,--whole-archive.... -Wl,--no-whole-archive          ###
+##################################################################
+set(THREADS_PREFER_PTHREAD_FLAG TRUE)
+find_package(Threads)
+
+include(${CMAKE_CURRENT_LIST_DIR}/h5ppTargets.cmake)
+include(${CMAKE_CURRENT_LIST_DIR}/h5ppVars.cmake)
+include(${CMAKE_CURRENT_LIST_DIR}/h5ppDeps.cmake)
+check_required_components(h5pp)
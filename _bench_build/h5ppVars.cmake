@@ -0,0 +1,18 @@
+# Propagate options that were set when h5pp was installed
+option(H5PP_ENABLE_EIGEN3      "Enables Eigen3 linear algebra library"            OFF)
+option(H5PP_ENABLE_FMT         "Enables the {fmt} formatting library"             OFF)
+option(H5PP_ENABLE_SPDLOG      "Enables Spdlog for logging h5pp internal info"    OFF)
+option(H5PP_ENABLE_MPI         "Enables use of MPI (work in progress)"            OFF)
+
+list(APPEND CMAKE_PREFIX_PATH /usr/local)
+list(REMOVE_DUPLICATES CMAKE_PREFIX_PATH)
+
+if(H5PP_ENABLE_SPDLOG)
+    set(H5PP_ENABLE_FMT ON CACHE INTERNAL "H5PP_ENABLE_SPDLOG:ON implies H5PP_ENABLE_FMT:ON)" FORCE)
+endif()
+
+
+mark_as_advanced(H5PP_ENABLE_EIGEN3)
+mark_as_advanced(H5PP_ENABLE_FMT)
+mark_as_advanced(H5PP_ENABLE_SPDLOG)
+mark_as_advanced(H5PP_ENABLE_MPI)
@@ -0,0 +1,63 @@
+#include "benchmark.h"
+#include <h5pp/h5pp.h>
+
+/*
+ * Measures reads and writes where the dataset type differs from the type in memory.
+ *
+ * h5pp converts between float and double, and between integer widths, itself (see h5ppTypeConvert.h).
+ * The reference passes the memory type to H5Dread/H5Dwrite and lets HDF5 convert.
+ * The ratio column is below 1 when the conversion in h5pp is faster.
+ */
+
+template<typename FileType, typename MemType>
+void compareConversion(h5pp::File &file, size_t size, std::vector<bench::Result> &results, const bench::Config &config) {
+    std::string name = h5pp::format("{}->{}", h5pp::type::sfinae::type_name<FileType>(), h5pp::type::sfinae::type_name<MemType>());
+    std::vector<FileType> fileData(size);
+    std::vector<MemType>  memData(size);
+    for(size_t i = 0; i < size; ++i) {
+        fileData[i] = static_cast<FileType>(i % 100); // Values that fit in every type
+        memData[i]  = static_cast<MemType>(i % 100);
+    }
+    std::string dsetPath = h5pp::format("{}_{}", name, size);
+    file.writeDataset(fileData, dsetPath, H5D_CONTIGUOUS);
+
+    h5pp::hid::h5f fileHandle = file.openFileHandle();
+    h5pp::hid::h5d dset       = H5Dopen(fileHandle, dsetPath.c_str(), H5P_DEFAULT);
+    h5pp::hid::h5t memType    = h5pp::type::getH5Type<MemType>();
+
+    std::vector<MemType> read(size);
+    results.emplace_back(bench::compare(
+        "read " + name,
+        size,
+        [&]() { file.readDataset(read, dsetPath); },
+        [&]() { H5Dread(dset, memType, H5S_ALL, H5S_ALL, H5P_DEFAULT, read.data()); },
+        config));
+    if(read != memData) throw h5pp::runtime_error("Data mismatch after reading [{}]", dsetPath);
+
+    results.emplace_back(bench::compare(
+        "write " + name,
+        size,
+        [&]() { file.writeDataset(memData, dsetPath); },
+        [&]() { H5Dwrite(dset, memType, H5S_ALL, H5S_ALL, H5P_DEFAULT, memData.data()); },
+        config));
+    if(file.readDataset<std::vector<FileType>>(dsetPath) != fileData) throw h5pp::runtime_error("Data mismatch after writing [{}]", dsetPath);
+}
+
+int main(int argc, char *argv[]) {
+    auto config = bench::parseArgs(argc, argv);
+
+    h5pp::File file("output/benchmark-conversion.h5", h5pp::FileAccess::REPLACE, h5pp::LogLevel::warn);
+    file.setKeepFileOpened();
+
+    std::vector<bench::Result> results;
+    bench::printHeader("Numeric conversion by h5pp versus HDF5 (seconds per call)", "hdf5 conv");
+    for(size_t size : {1000ul, 1000000ul}) {
+        compareConversion<double, float>(file, size, results, config);
+        compareConversion<float, double>(file, size, results, config);
+        compareConversion<int64_t, int32_t>(file, size, results, config);
+        compareConversion<int32_t, int64_t>(file, size, results, config);
+        compareConversion<uint16_t, int32_t>(file, size, results, config);
+        compareConversion<int32_t, uint8_t>(file, size, results, config);
+    }
+    return bench::report(results, config);
+}
@@ -0,0 +1,57 @@
+#include "benchmark.h"
+#include <h5pp/h5pp.h>
+
+/*
+ * Measures a checkpoint of many small datasets written and read with File::writeDatasets/readDatasets,
+ * against a loop of File::writeDataset/readDataset over the same datasets.
+ *
+ * The batch keeps the metadata of each dataset between checkpoints, and transfers all datasets in a single
+ * H5Dwrite_multi/H5Dread_multi call when HDF5 is 1.14 or newer. The ratio column is below 1 when the batch is faster.
+ *
+ * The number of datasets is 5000 by default. Set H5PP_BENCHMARK_NUM_DATASETS to change it.
+ */
+
+int main(int argc, char *argv[]) {
+    auto   config      = bench::parseArgs(argc, argv);
+    size_t numDatasets = 5000;
+    if(const char *env = std::getenv("H5PP_BENCHMARK_NUM_DATASETS")) numDatasets = std::strtoul(env, nullptr, 10);
+
+    h5pp::File file("output/benchmark-datasetBatch.h5", h5pp::FileAccess::REPLACE, h5pp::LogLevel::warn);
+    file.setKeepFileOpened();
+
+    // A mix of small vectors and scalars, as in a typical checkpoint
+    std::vector<std::vector<double>> vectors(numDatasets / 2, std::vector<double>(16, 1.0));
+    std::vector<int64_t>             scalars(numDatasets - vectors.size(), 7);
+    std::vector<std::string>         paths;
+    h5pp::WriteBatch                 writeBatch;
+    h5pp::ReadBatch                  readBatch;
+    for(size_t i = 0; i < vectors.size(); ++i) {
+        paths.emplace_back(h5pp::format("checkpoint/vectors/v{}", i));
+        writeBatch.add(vectors[i], paths.back());
+        readBatch.add(vectors[i], paths.back());
+    }
+    for(size_t i = 0; i < scalars.size(); ++i) {
+        paths.emplace_back(h5pp::format("checkpoint/scalars/s{}", i));
+        writeBatch.add(scalars[i], paths.back());
+        readBatch.add(scalars[i], paths.back());
+    }
+    auto report = file.writeDatasets(writeBatch); // Creates the datasets
+    h5pp::print("First write: {}\n", report.string());
+
+    auto writeLoop = [&]() {
+        for(size_t i = 0; i < vectors.size(); ++i) file.writeDataset(vectors[i], paths[i]);
+        for(size_t i = 0; i < scalars.size(); ++i) file.writeDataset(scalars[i], paths[vectors.size() + i]);
+    };
+    auto readLoop = [&]() {
+        for(size_t i = 0; i < vectors.size(); ++i) file.readDataset(vectors[i], paths[i]);
+        for(size_t i = 0; i < scalars.size(); ++i) file.readDataset(scalars[i], paths[vectors.size() + i]);
+    };
+
+    std::vector<bench::Result> results;
+    bench::printHeader(h5pp::format("Checkpoint of {} datasets (seconds per checkpoint)", numDatasets), "loop");
+    results.emplace_back(bench::compare("write checkpoint", numDatasets, [&]() { file.writeDatasets(writeBatch); }, writeLoop, config));
+    results.emplace_back(bench::compare("read checkpoint", numDatasets, [&]() { file.readDatasets(readBatch); }, readLoop, config));
+    h5pp::print("Batch write: {}\n", file.writeDatasets(writeBatch).string());
+    h5pp::print("Batch read:  {}\n", file.readDatasets(readBatch).string());
+    return bench::report(results, config);
+}
@@ -0,0 +1,64 @@
+#include "benchmark.h"
+#include <h5pp/h5pp.h>
+
+/*
+ * Measures opening HDF5 files from memory buffers and serializing them to buffers, against H5LTopen_file_image and
+ * H5Fget_file_image. Each call opens an image and reads its dataset, or writes a dataset and takes the image.
+ *
+ * The dataset holds 8 MB by default: set H5PP_BENCHMARK_IMAGE_MB to change it.
+ */
+
+int main(int argc, char *argv[]) {
+    auto   config = bench::parseArgs(argc, argv);
+    size_t sizeMB = 8;
+    if(const char *env = std::getenv("H5PP_BENCHMARK_IMAGE_MB")) sizeMB = std::strtoul(env, nullptr, 10);
+    size_t              numDoubles = sizeMB * 1024 * 1024 / sizeof(double);
+    std::vector<double> data(numDoubles, 1.0), dataRead(numDoubles);
+
+    std::vector<std::byte> image;
+    {
+        auto file = h5pp::File::inMemory(h5pp::LogLevel::warn);
+        file.writeDataset(data, "data");
+        image = file.toImage();
+    }
+
+    std::vector<bench::Result> results;
+    bench::printHeader(h5pp::format("File images with a dataset of {} MB (seconds per call)", sizeMB), "hdf5");
+    results.emplace_back(bench::compare(
+        "open image and read",
+        numDoubles,
+        [&]() {
+            auto file = h5pp::File::fromImage(image, h5pp::FileAccess::READONLY, h5pp::LogLevel::warn);
+            file.readDataset(dataRead, "data");
+        },
+        [&]() {
+            h5pp::hid::h5f file = H5LTopen_file_image(image.data(), image.size(), H5LT_FILE_IMAGE_DONT_COPY | H5LT_FILE_IMAGE_DONT_RELEASE);
+            h5pp::hid::h5d dset = H5Dopen(file, "data", H5P_DEFAULT);
+            H5Dread(dset, H5T_NATIVE_DOUBLE, H5S_ALL, H5S_ALL, H5P_DEFAULT, dataRead.data());
+        },
+        config));
+    if(dataRead != data) throw h5pp::runtime_error("Data mismatch after reading an image");
+    std::vector<std::byte> imageWritten;
+    results.emplace_back(bench::compare(
+        "write and take image",
+        numDoubles,
+        [&]() {
+            auto file = h5pp::File::inMemory(h5pp::LogLevel::warn);
+            file.writeDataset(data, "data");
+            imageWritten = file.toImage();
+        },
+        [&]() {
+            h5pp::hid::h5p fapl = H5Pcreate(H5P_FILE_ACCESS);
+            H5Pset_fapl_core(fapl, 10240000, false);
+            h5pp::hid::h5f file  = H5Fcreate("benchmark-fileImage-ref.h5", H5F_ACC_TRUNC, H5P_DEFAULT, fapl);
+            hsize_t        dims  = numDoubles;
+            h5pp::hid::h5s space = H5Screate_simple(1, &dims, nullptr);
+            h5pp::hid::h5d dset  = H5Dcreate(file, "data", H5T_NATIVE_DOUBLE, space, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+            H5Dwrite(dset, H5T_NATIVE_DOUBLE, H5S_ALL, H5S_ALL, H5P_DEFAULT, data.data());
+            H5Fflush(file, H5F_SCOPE_LOCAL);
+            imageWritten.resize(static_cast<size_t>(H5Fget_file_image(file, nullptr, 0)));
+            H5Fget_file_image(file, imageWritten.data(), imageWritten.size());
+        },
+        config));
+    return bench::report(results, config);
+}
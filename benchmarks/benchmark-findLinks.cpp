@@ -0,0 +1,117 @@
+#include "benchmark.h"
+#include <h5pp/h5pp.h>
+
+/*
+ * Measures searches for datasets in a large hierarchy with File::findDatasets, against the serial visitor that
+ * findLinks used before: H5Lvisit_by_name over every link, with H5Oget_info_by_name on each one to learn its type,
+ * collecting the full paths in a vector.
+ *
+ * Path patterns are compared against the same visitor filtering every path with PathPattern::matches.
+ *
+ * The hierarchy has 64 top-level groups with 32 subgroups each, and about 16000 datasets by default.
+ * Set H5PP_BENCHMARK_NUM_DATASETS to change the number of datasets, and H5PP_BENCHMARK_NUM_WORKERS to change the
+ * number of worker processes in the parallel search (4 by default). The workers only pay off with several cores.
+ */
+
+namespace reference {
+    struct Search {
+        std::string_view         key;
+        std::vector<std::string> matches;
+        const h5pp::PathPattern *pattern = nullptr;
+    };
+    herr_t matcher(hid_t loc, const char *name, const H5L_info_t *info, void *opdata) {
+        auto &search = *static_cast<Search *>(opdata);
+        if(info->type != H5L_TYPE_HARD) return 0;
+        H5O_info_t oInfo;
+#if defined(H5Oget_info_vers) && H5Oget_info_vers >= 2
+        H5Oget_info_by_name(loc, name, &oInfo, H5O_INFO_BASIC, H5P_DEFAULT);
+#else
+        H5Oget_info_by_name(loc, name, &oInfo, H5P_DEFAULT);
+#endif
+        if(oInfo.type != H5O_TYPE_DATASET) return 0;
+        std::string_view path(name);
+        auto             slash = path.rfind('/');
+        if(search.pattern != nullptr and not search.pattern->matches(path)) return 0;
+        if(search.key.empty() or path.substr(slash == std::string_view::npos ? 0 : slash).find(search.key) != std::string_view::npos)
+            search.matches.emplace_back(path);
+        return 0;
+    }
+    std::vector<std::string> findDatasets(hid_t file, std::string_view key, const h5pp::PathPattern *pattern = nullptr) {
+        Search search{key, {}, pattern};
+        H5Lvisit_by_name(file, "/", H5_INDEX_NAME, H5_ITER_NATIVE, matcher, &search, H5P_DEFAULT);
+        return search.matches;
+    }
+}
+
+int main(int argc, char *argv[]) {
+    auto   config      = bench::parseArgs(argc, argv);
+    size_t numDatasets = 16384;
+    size_t numWorkers  = 4;
+    if(const char *env = std::getenv("H5PP_BENCHMARK_NUM_DATASETS")) numDatasets = std::strtoul(env, nullptr, 10);
+    if(const char *env = std::getenv("H5PP_BENCHMARK_NUM_WORKERS")) numWorkers = std::strtoul(env, nullptr, 10);
+
+    h5pp::File file("output/benchmark-findLinks.h5", h5pp::FileAccess::REPLACE, h5pp::LogLevel::warn);
+    file.setKeepFileOpened();
+    const size_t numGroups = 64, numSubgroups = 32;
+    size_t       perSubgroup = std::max<size_t>(1, numDatasets / (numGroups * numSubgroups));
+    for(size_t g = 0; g < numGroups; ++g)
+        for(size_t s = 0; s < numSubgroups; ++s)
+            for(size_t d = 0; d < perSubgroup; ++d) {
+                auto name = d % 2 == 0 ? h5pp::format("energy_{}", d) : h5pp::format("count_{}", d);
+                file.writeDataset(static_cast<double>(d), h5pp::format("run_{}/step_{}/{}", g, s, name));
+            }
+    file.flush();
+    numDatasets = numGroups * numSubgroups * perSubgroup;
+    h5pp::hid::h5f fid = file.openFileHandle();
+
+    h5pp::LinkSearch parallel;
+    parallel.numWorkers = numWorkers;
+
+    std::vector<bench::Result> results;
+    bench::printHeader(h5pp::format("Search {} datasets in {} groups (seconds per search)", numDatasets, numGroups * (numSubgroups + 1)), "H5Lvisit");
+    results.emplace_back(bench::compare(
+        "findDatasets", numDatasets, [&]() { auto m = file.findDatasets(); }, [&]() { auto m = reference::findDatasets(fid, ""); }, config));
+    results.emplace_back(bench::compare(
+        "findDatasets(\"energy\")",
+        numDatasets,
+        [&]() { auto m = file.findDatasets("energy"); },
+        [&]() { auto m = reference::findDatasets(fid, "energy"); },
+        config));
+    results.emplace_back(bench::compare(
+        "callback",
+        numDatasets,
+        [&]() {
+            size_t n = 0;
+            file.findDatasets([&n](std::string_view) { return ++n, true; });
+        },
+        [&]() { auto m = reference::findDatasets(fid, ""); },
+        config));
+    results.emplace_back(bench::compare(
+        h5pp::format("callback, {} workers", numWorkers),
+        numDatasets,
+        [&]() {
+            size_t n = 0;
+            file.findDatasets([&n](std::string_view) { return ++n, true; }, parallel);
+        },
+        [&]() { auto m = reference::findDatasets(fid, ""); },
+        config));
+    results.emplace_back(bench::compare(
+        "visitLinks",
+        numDatasets,
+        [&]() {
+            size_t n = 0;
+            file.visitLinks("/", [&n](const h5pp::LinkView &link) { return n += link.objType() == H5O_TYPE_DATASET, true; });
+        },
+        [&]() { auto m = reference::findDatasets(fid, ""); },
+        config));
+    for(const auto &text : {"run_7/step_*/energy_0", "run_*/step_3/energy_*", "run_7/step_3/energy_0"}) {
+        h5pp::PathPattern pattern(text);
+        results.emplace_back(bench::compare(
+            text,
+            numDatasets,
+            [&]() { auto m = file.findDatasets(pattern); },
+            [&]() { auto m = reference::findDatasets(fid, "", &pattern); },
+            config));
+    }
+    return bench::report(results, config);
+}
@@ -0,0 +1,77 @@
+#include "benchmark.h"
+#include <h5pp/h5pp.h>
+
+/*
+ * Measures reads and writes of fixed-length string datasets, against H5Dread/H5Dwrite of one contiguous char buffer.
+ *
+ * A container of h5pp::fstr_t<N> has the memory layout of the dataset, so h5pp transfers it without copies.
+ * A container of std::string is copied through a contiguous buffer on the way, and so is the reference for it.
+ *
+ * There are 1000000 strings of 16 bytes by default: set H5PP_BENCHMARK_NUM_STRINGS to change it, e.g. to 10000000.
+ */
+
+int main(int argc, char *argv[]) {
+    auto   config     = bench::parseArgs(argc, argv);
+    size_t numStrings = 1000000;
+    if(const char *env = std::getenv("H5PP_BENCHMARK_NUM_STRINGS")) numStrings = std::strtoul(env, nullptr, 10);
+    constexpr size_t N = 16;
+
+    h5pp::File file("output/benchmark-fixedStrings.h5", h5pp::FileAccess::REPLACE, h5pp::LogLevel::warn);
+    file.setKeepFileOpened();
+
+    std::vector<h5pp::fstr_t<N>> fixed(numStrings);
+    std::vector<std::string>     strings(numStrings);
+    for(size_t i = 0; i < numStrings; ++i) {
+        strings[i] = h5pp::format("string {}", i);
+        fixed[i]   = strings[i];
+    }
+    file.writeDataset(fixed, "fixed");
+
+    h5pp::hid::h5f    fileHandle = file.openFileHandle();
+    h5pp::hid::h5d    dset       = H5Dopen(fileHandle, "fixed", H5P_DEFAULT);
+    h5pp::hid::h5t    type       = H5Dget_type(dset);
+    std::vector<char> buffer(numStrings * N);
+    H5Dread(dset, type, H5S_ALL, H5S_ALL, H5P_DEFAULT, buffer.data()); // The reference writes back the same strings
+
+    std::vector<bench::Result> results;
+    bench::printHeader(h5pp::format("Fixed-length strings of {} bytes (seconds per call)", N), "hdf5");
+    results.emplace_back(bench::compare(
+        "write fstr_t<16>",
+        numStrings,
+        [&]() { file.writeDataset(fixed, "fixed"); },
+        [&]() { H5Dwrite(dset, type, H5S_ALL, H5S_ALL, H5P_DEFAULT, buffer.data()); },
+        config));
+    results.emplace_back(bench::compare(
+        "write std::string",
+        numStrings,
+        [&]() { file.writeDataset(strings, "fixed", type); },
+        [&]() {
+            std::vector<char> copy(numStrings * N, '\0');
+            for(size_t i = 0; i < numStrings; ++i) strings[i].copy(copy.data() + i * N, N - 1);
+            H5Dwrite(dset, type, H5S_ALL, H5S_ALL, H5P_DEFAULT, copy.data());
+        },
+        config));
+    std::vector<h5pp::fstr_t<N>> fixedRead(numStrings);
+    results.emplace_back(bench::compare(
+        "read fstr_t<16>",
+        numStrings,
+        [&]() { file.readDataset(fixedRead, "fixed"); },
+        [&]() { H5Dread(dset, type, H5S_ALL, H5S_ALL, H5P_DEFAULT, buffer.data()); },
+        config));
+    if(fixedRead != fixed) throw h5pp::runtime_error("Data mismatch after reading fstr_t<{}>", N);
+    std::vector<std::string> stringsRead(numStrings);
+    results.emplace_back(bench::compare(
+        "read std::string",
+        numStrings,
+        [&]() { file.readDataset(stringsRead, "fixed"); },
+        [&]() {
+            H5Dread(dset, type, H5S_ALL, H5S_ALL, H5P_DEFAULT, buffer.data());
+            for(size_t i = 0; i < numStrings; ++i) {
+                auto str       = std::string_view(buffer.data() + i * N, N);
+                stringsRead[i] = str.substr(0, str.find('\0'));
+            }
+        },
+        config));
+    if(stringsRead != strings) throw h5pp::runtime_error("Data mismatch after reading std::string");
+    return bench::report(results, config);
+}
@@ -0,0 +1,60 @@
+#include "benchmark.h"
+#include <h5pp/h5pp.h>
+
+/*
+ * Measures the cost of validating identifiers with H5Iis_valid each time a h5pp::hid wrapper is used.
+ *
+ * The h5pp column converts the wrappers to hid_t as configured by H5PP_HID_CHECK (always | debug | never).
+ * The reference column checks validity explicitly on every use, which is what h5pp always did before.
+ * The ratio column is below 1 when the configured policy skips the check.
+ */
+
+int main(int argc, char *argv[]) {
+    auto config = bench::parseArgs(argc, argv);
+    std::printf("H5PP_HID_CHECK: %s (checks on access: %s)\n",
+                H5PP_HID_CHECK == H5PP_HID_CHECK_ALWAYS  ? "always"
+                : H5PP_HID_CHECK == H5PP_HID_CHECK_DEBUG ? "debug"
+                                                          : "never",
+                h5pp::hid::checkOnAccess ? "yes" : "no");
+
+    std::vector<bench::Result> results;
+    bench::printHeader("Identifier access (seconds per call)", "checked");
+
+    h5pp::hid::h5t type  = H5Tcopy(H5T_NATIVE_DOUBLE);
+    h5pp::hid::h5s space = H5Screate(H5S_SCALAR);
+    h5pp::hid::h5p plist = H5Pcreate(H5P_DATASET_XFER);
+    hid_t          sink  = 0;
+    results.emplace_back(bench::compare(
+        "value() x3",
+        1,
+        [&]() { sink += type.value() + space.value() + plist.value(); },
+        [&]() {
+            if(type.valid() and space.valid() and plist.valid()) sink += type.unchecked() + space.unchecked() + plist.unchecked();
+        },
+        config));
+    results.emplace_back(bench::compare(
+        "H5Tget_size",
+        1,
+        [&]() { sink += static_cast<hid_t>(H5Tget_size(type)); },
+        [&]() {
+            if(type.valid()) sink += static_cast<hid_t>(H5Tget_size(type.unchecked()));
+        },
+        config));
+
+    h5pp::File file("output/benchmark-hidCheck.h5", h5pp::FileAccess::REPLACE, h5pp::LogLevel::warn);
+    file.setKeepFileOpened();
+    std::vector<double> data(16, 1.0);
+    file.writeDataset(data, "data");
+    h5pp::hid::h5d dset = H5Dopen(file.openFileHandle(), "data", H5P_DEFAULT);
+    results.emplace_back(bench::compare(
+        "H5Dwrite (16 doubles)",
+        data.size(),
+        [&]() { H5Dwrite(dset, type, H5S_ALL, H5S_ALL, plist, data.data()); },
+        [&]() {
+            if(dset.valid() and type.valid() and plist.valid())
+                H5Dwrite(dset.unchecked(), type.unchecked(), H5S_ALL, H5S_ALL, plist.unchecked(), data.data());
+        },
+        config));
+    std::printf("sink: %lld\n", static_cast<long long>(sink));
+    return bench::report(results, config);
+}
@@ -0,0 +1,87 @@
+#include "benchmark.h"
+#include <h5pp/h5pp.h>
+#include <numeric>
+
+/*
+ * Measures the overhead of the h5pp convenience layer (File -> scan::*Info -> hdf5::*Dataset)
+ * against a minimal, hand-written implementation of the same operation using the HDF5 C API.
+ *
+ * Both sides keep their file handle open during the measurement, and both use contiguous layout,
+ * so that the ratio reflects the cost of metadata scanning and bookkeeping in h5pp.
+ */
+
+namespace raw {
+    void createDataset(hid_t file, const std::string &dsetPath, const std::vector<double> &data) {
+        hsize_t dims[1] = {data.size()};
+        hid_t   space   = H5Screate_simple(1, dims, nullptr);
+        hid_t   dset    = H5Dcreate2(file, dsetPath.c_str(), H5T_NATIVE_DOUBLE, space, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+        H5Dwrite(dset, H5T_NATIVE_DOUBLE, H5S_ALL, H5S_ALL, H5P_DEFAULT, data.data());
+        H5Dclose(dset);
+        H5Sclose(space);
+    }
+    void overwriteDataset(hid_t file, const std::string &dsetPath, const std::vector<double> &data) {
+        hid_t dset = H5Dopen2(file, dsetPath.c_str(), H5P_DEFAULT);
+        H5Dwrite(dset, H5T_NATIVE_DOUBLE, H5S_ALL, H5S_ALL, H5P_DEFAULT, data.data());
+        H5Dclose(dset);
+    }
+    void readDataset(hid_t file, const std::string &dsetPath, std::vector<double> &data) {
+        hid_t dset  = H5Dopen2(file, dsetPath.c_str(), H5P_DEFAULT);
+        hid_t space = H5Dget_space(dset);
+        data.resize(static_cast<size_t>(H5Sget_simple_extent_npoints(space)));
+        H5Dread(dset, H5T_NATIVE_DOUBLE, H5S_ALL, H5S_ALL, H5P_DEFAULT, data.data());
+        H5Sclose(space);
+        H5Dclose(dset);
+    }
+}
+
+int main(int argc, char *argv[]) {
+    auto config = bench::parseArgs(argc, argv);
+
+    h5pp::File h5ppFile("output/benchmark-overhead-h5pp.h5", h5pp::FileAccess::REPLACE, h5pp::LogLevel::warn);
+    h5ppFile.setKeepFileOpened();
+    hid_t rawFile = H5Fcreate("output/benchmark-overhead-hdf5.h5", H5F_ACC_TRUNC, H5P_DEFAULT, H5P_DEFAULT);
+    if(rawFile < 0) throw h5pp::runtime_error("Failed to create file for raw HDF5 benchmark");
+
+    std::vector<bench::Result> results;
+    bench::printHeader("h5pp overhead versus the HDF5 C API (seconds per call)");
+
+    for(size_t size : {1ul, 1000ul, 100000ul}) {
+        std::vector<double> data(size);
+        std::iota(data.begin(), data.end(), 0.0);
+        size_t h5ppCount = 0;
+        size_t rawCount  = 0;
+        results.emplace_back(bench::compare(
+            "writeDataset (create)",
+            size,
+            [&]() { h5ppFile.writeDataset_contiguous(data, h5pp::format("create_{}_{}", size, h5ppCount++)); },
+            [&]() { raw::createDataset(rawFile, h5pp::format("create_{}_{}", size, rawCount++), data); },
+            config));
+    }
+
+    for(size_t size : {1ul, 1000ul, 100000ul, 1000000ul}) {
+        std::vector<double> data(size);
+        std::iota(data.begin(), data.end(), 0.0);
+        std::string dsetPath = h5pp::format("dset_{}", size);
+        h5ppFile.writeDataset_contiguous(data, dsetPath);
+        raw::createDataset(rawFile, dsetPath, data);
+
+        results.emplace_back(bench::compare(
+            "writeDataset (overwrite)",
+            size,
+            [&]() { h5ppFile.writeDataset(data, dsetPath); },
+            [&]() { raw::overwriteDataset(rawFile, dsetPath, data); },
+            config));
+
+        std::vector<double> read;
+        results.emplace_back(bench::compare(
+            "readDataset",
+            size,
+            [&]() { h5ppFile.readDataset(read, dsetPath); },
+            [&]() { raw::readDataset(rawFile, dsetPath, read); },
+            config));
+        if(read != data) throw h5pp::runtime_error("Data mismatch after reading [{}]", dsetPath);
+    }
+
+    H5Fclose(rawFile);
+    return bench::report(results, config);
+}
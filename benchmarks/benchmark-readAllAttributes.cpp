@@ -0,0 +1,53 @@
+#include "benchmark.h"
+#include <h5pp/h5pp.h>
+
+/*
+ * Measures reading every attribute of many datasets with File::readAllAttributes, against listing the attribute names
+ * with getAttributeNames and reading them one at a time with readAttribute, which opens the link again for each.
+ *
+ * Each dataset has 8 attributes. There are 2000 datasets by default: set H5PP_BENCHMARK_NUM_DATASETS to change it.
+ */
+
+int main(int argc, char *argv[]) {
+    auto   config      = bench::parseArgs(argc, argv);
+    size_t numDatasets = 2000;
+    if(const char *env = std::getenv("H5PP_BENCHMARK_NUM_DATASETS")) numDatasets = std::strtoul(env, nullptr, 10);
+    const size_t numAttrs = 8;
+
+    h5pp::File file("output/benchmark-readAllAttributes.h5", h5pp::FileAccess::REPLACE, h5pp::LogLevel::warn);
+    file.setKeepFileOpened();
+    std::vector<std::string> paths;
+    for(size_t d = 0; d < numDatasets; ++d) {
+        paths.emplace_back(h5pp::format("group_{}/dset_{}", d % 16, d));
+        file.writeDataset(static_cast<double>(d), paths.back());
+        for(size_t a = 0; a < numAttrs; ++a) file.writeAttribute(static_cast<double>(a), paths.back(), h5pp::format("attr_{}", a));
+    }
+    file.flush();
+
+    std::vector<bench::Result> results;
+    bench::printHeader(h5pp::format("Read all {} attributes of each dataset (seconds per pass)", numAttrs), "readAttribute");
+    auto readEach = [&](const std::string &path) {
+        double sum = 0;
+        for(const auto &name : file.getAttributeNames(path)) sum += file.readAttribute<double>(path, name);
+        return sum;
+    };
+    results.emplace_back(bench::compare(
+        "readAllAttributes",
+        numDatasets * numAttrs,
+        [&]() {
+            for(const auto &path : paths) auto attrs = file.readAllAttributes(path);
+        },
+        [&]() {
+            for(const auto &path : paths) readEach(path);
+        },
+        config));
+    results.emplace_back(bench::compare(
+        "readAllAttributes(paths)",
+        numDatasets * numAttrs,
+        [&]() { auto attrs = file.readAllAttributes(paths); },
+        [&]() {
+            for(const auto &path : paths) readEach(path);
+        },
+        config));
+    return bench::report(results, config);
+}
@@ -0,0 +1,109 @@
+#include "benchmark.h"
+#include <functional>
+#include <h5pp/h5pp.h>
+
+/*
+ * Measures reads of text datasets into one std::string, with one line per element, and into h5pp::StringViews.
+ * The references read with H5Dread and assemble the same result by hand, sizing the text once.
+ *
+ * The datasets hold 64 MB of text by default: set H5PP_BENCHMARK_TEXT_MB to change it, e.g. to 1024.
+ */
+
+int main(int argc, char *argv[]) {
+    auto   config = bench::parseArgs(argc, argv);
+    size_t textMB = 64;
+    if(const char *env = std::getenv("H5PP_BENCHMARK_TEXT_MB")) textMB = std::strtoul(env, nullptr, 10);
+    constexpr size_t N          = 32;
+    size_t           numStrings = textMB * 1024 * 1024 / N;
+
+    h5pp::File file("output/benchmark-readText.h5", h5pp::FileAccess::REPLACE, h5pp::LogLevel::warn);
+    file.setKeepFileOpened();
+
+    std::vector<h5pp::fstr_t<N>> lines(numStrings);
+    for(size_t i = 0; i < numStrings; ++i) lines[i] = h5pp::format("line {} of the text", i);
+    file.writeDataset(lines, "fixed");
+    {
+        std::vector<std::string> strings(lines.begin(), lines.end());
+        file.writeDataset(strings, "variable");
+    }
+
+    h5pp::hid::h5f fileHandle = file.openFileHandle();
+    h5pp::hid::h5d fixedDset  = H5Dopen(fileHandle, "fixed", H5P_DEFAULT);
+    h5pp::hid::h5t fixedType  = H5Dget_type(fixedDset);
+    h5pp::hid::h5d varDset    = H5Dopen(fileHandle, "variable", H5P_DEFAULT);
+    h5pp::hid::h5t varType    = H5Dget_type(varDset);
+    h5pp::hid::h5s varSpace   = H5Dget_space(varDset);
+
+    auto readFixedRef = [&](std::string &text) {
+        std::string buffer(numStrings * N, '\0');
+        H5Dread(fixedDset, fixedType, H5S_ALL, H5S_ALL, H5P_DEFAULT, buffer.data());
+        text.clear();
+        text.reserve(numStrings * N);
+        for(size_t i = 0; i < numStrings; ++i) {
+            if(i > 0) text.push_back('\n');
+            text.append(buffer.data() + i * N, std::strlen(buffer.data() + i * N));
+        }
+    };
+    auto readVariableRef = [&](std::string &text) {
+        std::vector<char *> buffer(numStrings, nullptr);
+        H5Dread(varDset, varType, H5S_ALL, H5S_ALL, H5P_DEFAULT, buffer.data());
+        size_t total = numStrings;
+        for(auto *str : buffer) total += std::strlen(str);
+        text.clear();
+        text.reserve(total);
+        for(size_t i = 0; i < numStrings; ++i) {
+            if(i > 0) text.push_back('\n');
+            text.append(buffer[i]);
+        }
+        H5Dvlen_reclaim(varType, varSpace, H5P_DEFAULT, buffer.data());
+    };
+
+    std::string                expected;
+    std::vector<bench::Result> results;
+    readFixedRef(expected);
+    bench::printHeader(h5pp::format("Text datasets of {} MB (seconds per call)", textMB), "hdf5");
+    using ReadRef = std::function<void(std::string &)>;
+    for(const auto &[name, readRef] : {std::pair<std::string, ReadRef>{"fixed", readFixedRef}, {"variable", readVariableRef}}) {
+        std::string text, ref;
+        results.emplace_back(bench::compare(
+            h5pp::format("read {} into std::string", name),
+            numStrings,
+            [&]() { text = file.readDataset<std::string>(name); },
+            [&]() { readRef(ref); },
+            config));
+        if(text != expected) throw h5pp::runtime_error("Text mismatch after reading [{}]", name);
+    }
+    {
+        h5pp::StringViews             views;
+        std::vector<std::string_view> refViews(numStrings);
+        std::string                   ref;
+        results.emplace_back(bench::compare(
+            "read fixed into StringViews",
+            numStrings,
+            [&]() { views = file.readStringViews("fixed"); },
+            [&]() {
+                ref.resize(numStrings * N);
+                H5Dread(fixedDset, fixedType, H5S_ALL, H5S_ALL, H5P_DEFAULT, ref.data());
+                for(size_t i = 0; i < numStrings; ++i) refViews[i] = std::string_view(ref.data() + i * N);
+            },
+            config));
+        if(views.size() != numStrings or views[numStrings - 1] != std::string_view(lines.back()))
+            throw h5pp::runtime_error("Wrong string views of [fixed]");
+        results.emplace_back(bench::compare(
+            "read variable into StringViews",
+            numStrings,
+            [&]() { views = file.readStringViews("variable"); },
+            [&]() {
+                readVariableRef(ref);
+                for(size_t i = 0, pos = 0; i < numStrings; ++i) {
+                    auto end    = std::min(ref.find('\n', pos), ref.size());
+                    refViews[i] = std::string_view(ref).substr(pos, end - pos);
+                    pos         = end + 1;
+                }
+            },
+            config));
+        if(views.size() != numStrings or views[0] != std::string_view(lines.front()))
+            throw h5pp::runtime_error("Wrong string views of [variable]");
+    }
+    return bench::report(results, config);
+}
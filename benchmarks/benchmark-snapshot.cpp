@@ -0,0 +1,61 @@
+#include "benchmark.h"
+#include <cstdio>
+#include <h5pp/h5pp.h>
+
+/*
+ * Measures snapshots of a file held in memory by the core driver, against taking the file image with H5Fget_file_image
+ * and writing it to disk on the calling thread.
+ *
+ * File::snapshot only waits for the image to be copied, and writes it to disk on a background thread. With
+ * waitForSnapshots it also waits for the write, which should take as long as the reference.
+ *
+ * The file holds 64 MB by default: set H5PP_BENCHMARK_SNAPSHOT_MB to change it.
+ */
+
+int main(int argc, char *argv[]) {
+    auto   config = bench::parseArgs(argc, argv);
+    size_t sizeMB = 64;
+    if(const char *env = std::getenv("H5PP_BENCHMARK_SNAPSHOT_MB")) sizeMB = std::strtoul(env, nullptr, 10);
+    size_t numDoubles = sizeMB * 1024 * 1024 / sizeof(double);
+
+    h5pp::File file("output/benchmark-snapshot.h5", h5pp::FileAccess::REPLACE, h5pp::LogLevel::warn);
+    file.setDriver_core(false);
+    file.setKeepFileOpened();
+    file.setSnapshotPolicy({"output/benchmark-snapshot-copy.h5"});
+    file.writeDataset(std::vector<double>(numDoubles, 1.0), "data");
+
+    h5pp::hid::h5f         fileHandle = file.openFileHandle();
+    std::vector<std::byte> image;
+    auto                   writeImage = [&]() {
+        image.resize(static_cast<size_t>(H5Fget_file_image(fileHandle, nullptr, 0)));
+        H5Fget_file_image(fileHandle, image.data(), image.size());
+        std::FILE *out = std::fopen("output/benchmark-snapshot-ref.h5.tmp", "wb");
+        std::fwrite(image.data(), 1, image.size(), out);
+        std::fflush(out);
+#if H5PP_HAS_FSYNC == 1
+        fsync(fileno(out));
+#endif
+        std::fclose(out);
+        std::rename("output/benchmark-snapshot-ref.h5.tmp", "output/benchmark-snapshot-ref.h5");
+    };
+
+    std::vector<bench::Result> results;
+    bench::printHeader(h5pp::format("Snapshots of a {} MB file in memory (seconds per call)", sizeMB), "sync");
+    results.emplace_back(bench::compare(
+        "snapshot",
+        numDoubles,
+        [&]() { file.snapshot(); },
+        writeImage,
+        config));
+    file.waitForSnapshots();
+    results.emplace_back(bench::compare(
+        "snapshot and wait",
+        numDoubles,
+        [&]() {
+            file.snapshot();
+            file.waitForSnapshots();
+        },
+        writeImage,
+        config));
+    return bench::report(results, config);
+}
@@ -0,0 +1,55 @@
+#include "benchmark.h"
+#include <h5pp/h5pp.h>
+
+/*
+ * Measures the cost of looking up HDF5 types in the registry behind h5pp::type::getH5Type<T>()
+ * against building them from scratch with h5pp::type::makeH5Type<T>() on every call, as h5pp used to.
+ *
+ * The second part repeats small writes, where the type is either looked up or built anew for each write.
+ * The ratio column is below 1 when the registry is faster.
+ */
+
+using Tile = std::array<std::complex<double>, 4>;
+
+template<typename T>
+void compareType(std::string_view name, std::vector<bench::Result> &results, const bench::Config &config) {
+    results.emplace_back(bench::compare(
+        name,
+        1,
+        []() { [[maybe_unused]] auto type = h5pp::type::getH5Type<T>(); },
+        []() { [[maybe_unused]] auto type = h5pp::type::makeH5Type<T>(); },
+        config));
+}
+
+int main(int argc, char *argv[]) {
+    auto config = bench::parseArgs(argc, argv);
+
+    std::vector<bench::Result> results;
+    bench::printHeader("h5pp::type::getH5Type versus makeH5Type (seconds per call)", "makeH5Type");
+    compareType<double>("double", results, config);
+    compareType<std::complex<double>>("complex<double>", results, config);
+    compareType<std::vector<Tile>>("vector<array<complex>>", results, config);
+
+    h5pp::File file("output/benchmark-typeRegistry.h5", h5pp::FileAccess::REPLACE, h5pp::LogLevel::warn);
+    file.setKeepFileOpened();
+    std::vector<Tile> data(1, Tile{std::complex<double>(1.0, 2.0)});
+    file.writeDataset(data, "tile");
+
+    bench::printHeader("Small writes with a registered versus a new type (seconds per call)", "new type");
+    h5pp::Options options;
+    options.linkPath = "tile";
+    auto result      = bench::compare(
+        "writeDataset (overwrite)",
+        data.size(),
+        [&]() { file.writeDataset(data, "tile"); },
+        [&]() {
+            options.h5Type = h5pp::type::makeH5Type<std::vector<Tile>>();
+            file.writeDataset(data, options);
+        },
+        config);
+    std::printf("Projected time for 1M writes: %.2f s registered | %.2f s new type\n", result.h5ppTime * 1e6, result.referenceTime * 1e6);
+    results.emplace_back(result);
+
+    if(file.readDataset<std::vector<Tile>>("tile") != data) throw h5pp::runtime_error("Data mismatch after writing [tile]");
+    return bench::report(results, config);
+}
@@ -0,0 +1,104 @@
+#include "benchmark.h"
+#include <h5pp/h5pp.h>
+
+/*
+ * Measures transfers of compound table records that HDF5 has to convert, with differently sized type-conversion buffers.
+ *
+ * The table is stored with packed records, while the struct in memory has padding, so every record is converted.
+ * The first part compares automatically sized buffers (File::setXferBufferAuto) against H5Dwrite/H5Dread with the
+ * default transfer property list, i.e. the 1 MB HDF5 buffer. The ratio column is below 1 when larger buffers are faster.
+ * The second part uses fixed 16 MB buffers in both columns: h5pp allocates them once and reuses them, whereas
+ * H5Pset_buffer without buffers makes HDF5 allocate them in every transfer.
+ *
+ * The number of rows is 1e7 by default. Set H5PP_BENCHMARK_TABLE_ROWS to change it, e.g. to 1e8 on a machine
+ * with at least 16 GB of memory.
+ */
+
+struct Record {
+    double  x    = 0;
+    int32_t id   = 0;
+    char    flag = 0;
+    float   w    = 0;
+    double  y    = 0;
+};
+H5PP_REGISTER_COMPOUND(Record, x, id, flag, w, y)
+
+struct Weight {
+    float w = 0;
+};
+H5PP_REGISTER_COMPOUND(Weight, w)
+
+int main(int argc, char *argv[]) {
+    auto   config = bench::parseArgs(argc, argv);
+    size_t rows   = 10000000;
+    if(const char *env = std::getenv("H5PP_BENCHMARK_TABLE_ROWS")) rows = static_cast<size_t>(std::strtod(env, nullptr));
+
+    h5pp::File file("output/benchmark-xferBuffer.h5", h5pp::FileAccess::REPLACE, h5pp::LogLevel::warn);
+    file.setKeepFileOpened();
+    file.setXferBufferAuto();
+
+    std::vector<Record> records(rows);
+    for(size_t i = 0; i < rows; ++i) {
+        records[i].x    = static_cast<double>(i);
+        records[i].id   = static_cast<int32_t>(i);
+        records[i].flag = static_cast<char>('a' + i % 26);
+        records[i].w    = static_cast<float>(i % 1000);
+        records[i].y    = -static_cast<double>(i);
+    }
+    h5pp::hid::h5t packed = H5Tcopy(h5pp::type::getH5Type<Record>());
+    H5Tpack(packed);
+    file.createTable(packed, "records", "Packed records", std::vector<hsize_t>{rows < 100000 ? rows : 100000}, 0);
+    file.writeTableRecords(records, "records");
+
+    h5pp::hid::h5d dset       = H5Dopen(file.openFileHandle(), "records", H5P_DEFAULT);
+    const auto    &recordType = h5pp::type::getH5Type<Record>();
+    const auto    &weightType = h5pp::type::getH5Type<Weight>();
+
+    std::vector<bench::Result> results;
+    bench::printHeader(h5pp::format("Compound table transfers, {} rows (seconds per call)", rows), "hdf5 1MB");
+    results.emplace_back(bench::compare(
+        "write records",
+        rows,
+        [&]() { file.writeTableRecords(records, "records", 0); },
+        [&]() { H5Dwrite(dset, recordType, H5S_ALL, H5S_ALL, H5P_DEFAULT, records.data()); },
+        config));
+
+    std::vector<Record> read(rows);
+    results.emplace_back(bench::compare(
+        "read records",
+        rows,
+        [&]() { file.readTableRecords(read, "records", h5pp::TableSelection::ALL); },
+        [&]() { H5Dread(dset, recordType, H5S_ALL, H5S_ALL, H5P_DEFAULT, read.data()); },
+        config));
+    for(size_t i = 0; i < rows; ++i)
+        if(read[i].id != records[i].id or read[i].y != records[i].y) throw h5pp::runtime_error("Record mismatch at {}", i);
+
+    std::vector<Weight> weights(rows);
+    results.emplace_back(bench::compare(
+        "read field [w]",
+        rows,
+        [&]() { file.readTableField(weights, "records", {"w"}, h5pp::TableSelection::ALL); },
+        [&]() { H5Dread(dset, weightType, H5S_ALL, H5S_ALL, H5P_DEFAULT, weights.data()); },
+        config));
+    for(size_t i = 0; i < rows; ++i)
+        if(weights[i].w != records[i].w) throw h5pp::runtime_error("Field mismatch at {}", i);
+
+    constexpr size_t bufferSize = 16 * 1024 * 1024;
+    file.setXferBufferSize(bufferSize);
+    h5pp::hid::h5p xfer = H5Pcreate(H5P_DATASET_XFER);
+    H5Pset_buffer(xfer, bufferSize, nullptr, nullptr);
+    bench::printHeader("Fixed 16 MB buffers (seconds per call)", "hdf5 alloc");
+    results.emplace_back(bench::compare(
+        "write records",
+        rows,
+        [&]() { file.writeTableRecords(records, "records", 0); },
+        [&]() { H5Dwrite(dset, recordType, H5S_ALL, H5S_ALL, xfer, records.data()); },
+        config));
+    results.emplace_back(bench::compare(
+        "read records",
+        rows,
+        [&]() { file.readTableRecords(read, "records", h5pp::TableSelection::ALL); },
+        [&]() { H5Dread(dset, recordType, H5S_ALL, H5S_ALL, xfer, read.data()); },
+        config));
+    return bench::report(results, config);
+}
@@ -0,0 +1,109 @@
+#pragma once
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <limits>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/*! \namespace bench
+ * \brief Helpers shared by the h5pp benchmarks: argument parsing, timing and reporting.
+ *
+ * Each benchmark measures an operation through h5pp and through a reference implementation
+ * (usually hand-written HDF5 C calls), and reports the ratio t_h5pp / t_reference.
+ * The benchmark exits with a non-zero status if any ratio exceeds the configured maximum overhead.
+ *
+ * The maximum overhead can be set (in increasing order of precedence) with
+ *  - the environment variable `H5PP_BENCHMARK_MAX_OVERHEAD`
+ *  - the command line argument `--max-overhead <factor>`
+ */
+namespace bench {
+    struct Config {
+        double maxOverhead  = 5.0;  /*!< Fail if t_h5pp / t_reference exceeds this factor */
+        size_t trials       = 5;    /*!< Number of trials per measurement. The fastest trial is kept */
+        double minTrialTime = 0.02; /*!< Minimum duration of a trial in seconds. Fast operations are repeated to reach it */
+    };
+
+    inline Config parseArgs(int argc, char *argv[]) {
+        Config config;
+        if(const char *env = std::getenv("H5PP_BENCHMARK_MAX_OVERHEAD")) config.maxOverhead = std::strtod(env, nullptr);
+        if(const char *env = std::getenv("H5PP_BENCHMARK_TRIALS")) config.trials = std::strtoul(env, nullptr, 10);
+        for(int i = 1; i < argc; ++i) {
+            std::string_view arg = argv[i];
+            bool             hasValue = i + 1 < argc;
+            if(arg == "--max-overhead" and hasValue) config.maxOverhead = std::strtod(argv[++i], nullptr);
+            else if(arg == "--trials" and hasValue) config.trials = std::strtoul(argv[++i], nullptr, 10);
+            else if(arg == "--min-trial-time" and hasValue) config.minTrialTime = std::strtod(argv[++i], nullptr);
+            else {
+                std::fprintf(stderr, "Usage: %s [--max-overhead <factor>] [--trials <n>] [--min-trial-time <seconds>]\n", argv[0]);
+                std::exit(EXIT_FAILURE);
+            }
+        }
+        config.trials = std::max<size_t>(1, config.trials);
+        return config;
+    }
+
+    struct Result {
+        std::string operation;
+        size_t      size          = 0; /*!< Number of elements transferred */
+        double      h5ppTime      = 0; /*!< Seconds per call through h5pp */
+        double      referenceTime = 0; /*!< Seconds per call through the reference implementation */
+        [[nodiscard]] double ratio() const { return referenceTime > 0 ? h5ppTime / referenceTime : std::numeric_limits<double>::infinity(); }
+    };
+
+    /*! Returns the number of seconds per call, averaged over reps calls */
+    template<typename Func>
+    double timeit(Func &&func, size_t reps) {
+        auto t0 = std::chrono::steady_clock::now();
+        for(size_t r = 0; r < reps; ++r) func();
+        auto t1 = std::chrono::steady_clock::now();
+        return std::chrono::duration<double>(t1 - t0).count() / static_cast<double>(reps);
+    }
+
+    /*! Chooses how many calls make up one trial, such that a trial lasts at least config.minTrialTime */
+    template<typename Func>
+    size_t calibrate(Func &&func, const Config &config) {
+        double once = timeit(func, 1); // Also serves as warmup
+        if(once <= 0) return 1000;
+        return std::clamp<size_t>(static_cast<size_t>(config.minTrialTime / once), 1, 1000000);
+    }
+
+    /*! Measures h5ppFunc against refFunc. Trials are interleaved so that drift affects both equally. */
+    template<typename H5ppFunc, typename RefFunc>
+    Result compare(std::string_view operation, size_t size, H5ppFunc &&h5ppFunc, RefFunc &&refFunc, const Config &config) {
+        Result res;
+        res.operation     = operation;
+        res.size          = size;
+        res.h5ppTime      = std::numeric_limits<double>::max();
+        res.referenceTime = std::numeric_limits<double>::max();
+        size_t h5ppReps   = calibrate(h5ppFunc, config);
+        size_t refReps    = calibrate(refFunc, config);
+        for(size_t t = 0; t < config.trials; ++t) {
+            res.h5ppTime      = std::min(res.h5ppTime, timeit(h5ppFunc, h5ppReps));
+            res.referenceTime = std::min(res.referenceTime, timeit(refFunc, refReps));
+        }
+        std::printf("%-24s %12zu %14.3e %14.3e %10.2f\n", res.operation.c_str(), res.size, res.h5ppTime, res.referenceTime, res.ratio());
+        std::fflush(stdout);
+        return res;
+    }
+
+    inline void printHeader(std::string_view title, std::string_view reference = "hdf5") {
+        std::printf("%.*s\n", static_cast<int>(title.size()), title.data());
+        std::printf("%-24s %12s %14s %14s %10s\n", "operation", "size", "h5pp [s]", (std::string(reference) + " [s]").c_str(), "ratio");
+    }
+
+    /*! Prints a summary and returns EXIT_FAILURE if any result exceeds the maximum overhead */
+    inline int report(const std::vector<Result> &results, const Config &config) {
+        int status = EXIT_SUCCESS;
+        for(const auto &res : results) {
+            if(res.ratio() > config.maxOverhead) {
+                std::printf("FAIL: %s (size %zu) overhead %.2f exceeds %.2f\n", res.operation.c_str(), res.size, res.ratio(), config.maxOverhead);
+                status = EXIT_FAILURE;
+            }
+        }
+        if(status == EXIT_SUCCESS) std::printf("All %zu measurements within max overhead %.2f\n", results.size(), config.maxOverhead);
+        return status;
+    }
+}
@@ -5,6 +5,10 @@ if(NOT THREADS_PREFER_PTHREAD_FLAG)
     set(THREADS_PREFER_PTHREAD_FLAG TRUE)
 endif()
 find_package(Threads)
+if(TARGET Threads::Threads)
+    # h5pp::hdf5::repackFile compresses chunks on worker threads
+    target_link_libraries(deps INTERFACE Threads::Threads)
+endif()
 
 
 # h5pp requires the filesystem header (and possibly stdc++fs library)
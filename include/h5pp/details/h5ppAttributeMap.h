@@ -0,0 +1,198 @@
+#pragma once
+#include "h5ppExcept.h"
+#include "h5ppFormat.h"
+#include "h5ppHdf5.h"
+#include "h5ppHid.h"
+#include "h5ppLinkView.h"
+#include "h5ppLogger.h"
+#include "h5ppPropertyLists.h"
+#include "h5ppTypeCast.h"
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <hdf5.h>
+#include <map>
+#include <string>
+#include <string_view>
+#include <variant>
+#include <vector>
+
+namespace h5pp {
+    /*! Raw data of an attribute whose type has no counterpart in h5pp::AttrValue, e.g. a compound or enum type */
+    struct AttrBuffer {
+        hid::h5t               h5Type; /*!< Native type of the elements in data */
+        std::vector<std::byte> data;   /*!< Elements in row-major order. Empty if the type holds variable-length data */
+    };
+
+    /*!
+     * \brief Value of an attribute read by File::readAllAttributes.
+     *
+     * Integers are widened to int64_t or uint64_t and floating-point numbers to double. Scalar attributes hold a single
+     * value and have no dimensions. Other attributes hold a std::vector with all elements in row-major order, and their
+     * dimensions in dims. Text, fixed- or variable-length, becomes std::string. Anything else is kept as raw bytes.
+     */
+    struct AttrValue {
+        using Variant = std::variant<int64_t,
+                                     uint64_t,
+                                     double,
+                                     std::string,
+                                     std::vector<int64_t>,
+                                     std::vector<uint64_t>,
+                                     std::vector<double>,
+                                     std::vector<std::string>,
+                                     AttrBuffer>;
+        Variant              value;
+        std::vector<hsize_t> dims; /*!< Dimensions of the attribute. Empty for scalars */
+
+        template<typename T>
+        [[nodiscard]] bool holds() const {
+            return std::holds_alternative<T>(value);
+        }
+        template<typename T>
+        [[nodiscard]] const T &get() const {
+            return std::get<T>(value);
+        }
+    };
+
+    /*! All the attributes of one object, by name */
+    using AttrMap = std::map<std::string, AttrValue, std::less<>>;
+}
+
+namespace h5pp::hdf5 {
+    namespace internal {
+        template<typename T>
+        [[nodiscard]] AttrValue::Variant readAttrNumbers(const hid::h5a &attr, hid_t memType, hsize_t size, bool scalar, std::string_view attrName) {
+            std::vector<T> values(type::safe_cast<size_t>(size));
+            if(size > 0 and H5Aread(attr, memType, values.data()) < 0) throw h5pp::runtime_error("Failed to read attribute [{}]", attrName);
+            if(scalar) return values.front();
+            return values;
+        }
+
+        [[nodiscard]] inline AttrValue::Variant
+            readAttrText(const hid::h5a &attr, const hid::h5t &type, const hid::h5s &space, hsize_t size, bool scalar, std::string_view attrName) {
+            std::vector<std::string> strings;
+            strings.reserve(type::safe_cast<size_t>(size));
+            if(size == 0) return strings;
+            if(H5Tis_variable_str(type) > 0) {
+                std::vector<char *> vdata(type::safe_cast<size_t>(size), nullptr);
+                if(H5Aread(attr, type, vdata.data()) < 0) throw h5pp::runtime_error("Failed to read attribute [{}]", attrName);
+                for(const auto *str : vdata) strings.emplace_back(str == nullptr ? "" : str);
+#if H5_VERSION_GE(1, 12, 0)
+                herr_t reclaimErr = H5Treclaim(type, space, H5P_DEFAULT, vdata.data());
+#else
+                herr_t reclaimErr = H5Dvlen_reclaim(type, space, H5P_DEFAULT, vdata.data());
+#endif
+                if(reclaimErr < 0) throw h5pp::runtime_error("Failed to reclaim the text of attribute [{}]", attrName);
+            } else {
+                size_t      bytesPerString = H5Tget_size(type);
+                bool        spacePad       = H5Tget_strpad(type) == H5T_STR_SPACEPAD;
+                std::string fdata(type::safe_cast<size_t>(size) * bytesPerString, '\0');
+                if(H5Aread(attr, type, fdata.data()) < 0) throw h5pp::runtime_error("Failed to read attribute [{}]", attrName);
+                for(size_t i = 0; i < type::safe_cast<size_t>(size); ++i) {
+                    std::string_view str(fdata.data() + i * bytesPerString, bytesPerString);
+                    str = str.substr(0, str.find('\0'));
+                    if(spacePad) str = str.substr(0, str.find_last_not_of(' ') + 1);
+                    strings.emplace_back(str);
+                }
+            }
+            if(scalar) return std::move(strings.front());
+            return strings;
+        }
+
+        /*! True if type holds variable-length sequences or strings anywhere, also inside compound or array types */
+        [[nodiscard]] inline bool hasVariableLength(hid_t type) {
+            switch(H5Tget_class(type)) {
+                case H5T_VLEN: return true;
+                case H5T_STRING: return H5Tis_variable_str(type) > 0;
+                case H5T_ARRAY: {
+                    hid::h5t super = H5Tget_super(type);
+                    return hasVariableLength(super);
+                }
+                case H5T_COMPOUND: {
+                    int numMembers = H5Tget_nmembers(type);
+                    for(int i = 0; i < numMembers; ++i) {
+                        hid::h5t member = H5Tget_member_type(type, type::safe_cast<unsigned>(i));
+                        if(hasVariableLength(member)) return true;
+                    }
+                    return false;
+                }
+                default: return false;
+            }
+        }
+
+        /*! Reads an attribute into an AttrValue, converting the data to the closest type in AttrValue::Variant */
+        [[nodiscard]] inline AttrValue readAttrValue(const hid::h5a &attr, std::string_view name) {
+            hid::h5t type   = H5Aget_type(attr);
+            hid::h5s space  = H5Aget_space(attr);
+            bool     scalar = H5Sget_simple_extent_type(space) == H5S_SCALAR;
+            hssize_t npts   = H5Sget_simple_extent_npoints(space);
+            if(npts < 0) throw h5pp::runtime_error("Failed to read the size of attribute [{}]", name);
+            AttrValue result;
+            result.dims = getDimensions(space);
+            auto size   = type::safe_cast<hsize_t>(npts);
+            if(size == 0) scalar = false; // An empty attribute becomes an empty vector
+            switch(H5Tget_class(type)) {
+                case H5T_INTEGER:
+                    if(H5Tget_size(type) > sizeof(int64_t)) break;
+                    if(H5Tget_sign(type) == H5T_SGN_NONE) result.value = readAttrNumbers<uint64_t>(attr, H5T_NATIVE_UINT64, size, scalar, name);
+                    else result.value = readAttrNumbers<int64_t>(attr, H5T_NATIVE_INT64, size, scalar, name);
+                    return result;
+                case H5T_FLOAT:
+                    if(H5Tget_size(type) > sizeof(double)) break;
+                    result.value = readAttrNumbers<double>(attr, H5T_NATIVE_DOUBLE, size, scalar, name);
+                    return result;
+                case H5T_STRING: result.value = readAttrText(attr, type, space, size, scalar, name); return result;
+                default: break;
+            }
+            // Anything else is kept as it is in memory. Variable-length data would need reclaiming, so it is left out
+            AttrBuffer buffer;
+            buffer.h5Type = H5Tget_native_type(type, H5T_DIR_ASCEND);
+            if(size > 0 and not hasVariableLength(type)) {
+                buffer.data.resize(type::safe_cast<size_t>(size) * H5Tget_size(buffer.h5Type));
+                if(H5Aread(attr, buffer.h5Type, buffer.data.data()) < 0) throw h5pp::runtime_error("Failed to read attribute [{}]", name);
+            }
+            result.value = std::move(buffer);
+            return result;
+        }
+    }
+
+    /*! Reads every attribute of link in a single H5Aiterate pass, without opening link again for each attribute */
+    template<typename h5x>
+    [[nodiscard]] inline AttrMap readAllAttributes(const h5x &link) {
+        static_assert(type::sfinae::is_hdf5_link_id<h5x>,
+                      "Template function [h5pp::hdf5::readAllAttributes(const h5x & link)] requires type h5x to be: "
+                      "[h5pp::hid::h5d], [h5pp::hid::h5g], [h5pp::hid::h5o] or [hid_t]");
+        AttrMap attrs;
+        visitAttributes(link, [&attrs](const AttrView &attr) {
+            attrs.emplace_hint(attrs.end(), attr.name(), internal::readAttrValue(attr.open(), attr.name()));
+            return true;
+        });
+        return attrs;
+    }
+
+    template<typename h5x>
+    [[nodiscard]] inline AttrMap readAllAttributes(const h5x          &loc,
+                                                   std::string_view    linkPath,
+                                                   std::optional<bool> linkExists = std::nullopt,
+                                                   const hid::h5p     &linkAccess = H5P_DEFAULT) {
+        static_assert(type::sfinae::is_hdf5_loc_id<h5x>,
+                      "Template function [h5pp::hdf5::readAllAttributes(const h5x & loc, std::string_view linkPath, ...)] requires type h5x to be: "
+                      "[h5pp::hid::h5f], [h5pp::hid::h5g], [h5pp::hid::h5o] or [hid_t]");
+        auto link = openLink<hid::h5o>(loc, linkPath, linkExists, linkAccess);
+        return readAllAttributes(link);
+    }
+
+    /*! Reads every attribute of each link in linkPaths, opening each link once. The results are in the order of linkPaths */
+    template<typename h5x>
+    [[nodiscard]] inline std::vector<AttrMap>
+        readAllAttributes(const h5x &loc, const std::vector<std::string> &linkPaths, const hid::h5p &linkAccess = H5P_DEFAULT) {
+        static_assert(type::sfinae::is_hdf5_loc_id<h5x>,
+                      "Template function [h5pp::hdf5::readAllAttributes(const h5x & loc, const std::vector<std::string> & linkPaths, ...)] requires type h5x to be: "
+                      "[h5pp::hid::h5f], [h5pp::hid::h5g], [h5pp::hid::h5o] or [hid_t]");
+        std::vector<AttrMap> result;
+        result.reserve(linkPaths.size());
+        for(const auto &linkPath : linkPaths) result.emplace_back(readAllAttributes(loc, linkPath, std::nullopt, linkAccess));
+        return result;
+    }
+}
@@ -6,4 +6,6 @@ namespace h5pp::constants {
     static constexpr unsigned long maxSizeContiguous = 512 * 1024; // Max size of contiguous datasets is 512 kB
     static constexpr unsigned long minChunkBytes     = 10 * 1024;  // 10 kB
     static constexpr unsigned long maxChunkBytes     = 500 * 1024; // 500 kB
+    static constexpr unsigned long minXferBuffer     = 1024 * 1024;       // Default size of the HDF5 type-conversion buffer, 1 MB
+    static constexpr unsigned long maxXferBuffer     = 16 * 1024 * 1024;  // Max size of automatically sized type-conversion buffers, 16 MB
 }
@@ -0,0 +1,291 @@
+#pragma once
+#include "h5ppEigen.h"
+#include "h5ppExcept.h"
+#include "h5ppFormat.h"
+#include "h5ppHdf5.h"
+#include "h5ppInfo.h"
+#include "h5ppLogger.h"
+#include "h5ppOptional.h"
+#include "h5ppPropertyLists.h"
+#include "h5ppScan.h"
+#include "h5ppTypeSfinae.h"
+#include "h5ppUtils.h"
+#include "h5ppVarr.h"
+#include <chrono>
+#include <hdf5.h>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace h5pp {
+
+    /*! Counts and timings of a batched transfer with File::writeDatasets or File::readDatasets */
+    struct BatchReport {
+        size_t numDatasets  = 0;     /*!< Number of datasets transferred */
+        size_t numMulti     = 0;     /*!< Number of datasets transferred together in a single multi-dataset call */
+        size_t numSerial    = 0;     /*!< Number of datasets transferred one at a time (text, variable-length or converted data) */
+        size_t numScanned   = 0;     /*!< Number of datasets whose metadata was scanned in this call, i.e. not cached by the batch */
+        size_t bytes        = 0;     /*!< Bytes transferred from or into memory */
+        bool   multi        = false; /*!< True if HDF5 has H5Dwrite_multi/H5Dread_multi (1.14 or newer) */
+        double scanSeconds  = 0;     /*!< Wall time spent scanning, creating and resizing datasets */
+        double xferSeconds  = 0;     /*!< Wall time spent transferring data */
+        [[nodiscard]] double seconds() const { return scanSeconds + xferSeconds; }
+        [[nodiscard]] std::string string(bool enable = true) const {
+            if(not enable) return {};
+            return h5pp::format("datasets {} | multi {} | serial {} | scanned {} | {} bytes | scan {:.6f} s | transfer {:.6f} s{}",
+                                numDatasets,
+                                numMulti,
+                                numSerial,
+                                numScanned,
+                                bytes,
+                                scanSeconds,
+                                xferSeconds,
+                                multi ? "" : " | serial fallback");
+        }
+    };
+
+    namespace hdf5 {
+#if H5_VERSION_GE(1, 14, 0)
+        inline constexpr bool has_multi_dataset_io = true;
+#else
+        inline constexpr bool has_multi_dataset_io = false;
+#endif
+        /*! The ids and buffer of one dataset in a multi-dataset transfer */
+        template<typename PtrType>
+        struct MultiTransfer {
+            std::vector<hid_t>   dsets, memTypes, memSpaces, fileSpaces;
+            std::vector<PtrType> bufs;
+            void                 reserve(size_t n) {
+                for(auto *v : {&dsets, &memTypes, &memSpaces, &fileSpaces}) v->reserve(n);
+                bufs.reserve(n);
+            }
+            void add(hid_t dset, hid_t memType, hid_t memSpace, hid_t fileSpace, PtrType buf) {
+                dsets.emplace_back(dset);
+                memTypes.emplace_back(memType);
+                memSpaces.emplace_back(memSpace);
+                fileSpaces.emplace_back(fileSpace);
+                bufs.emplace_back(buf);
+            }
+            [[nodiscard]] size_t size() const { return dsets.size(); }
+        };
+
+        /*! Writes several datasets with a single H5Dwrite_multi, or one H5Dwrite at a time on HDF5 older than 1.14 */
+        inline void writeMulti(MultiTransfer<const void *> &xfer, const PropertyLists &plists = PropertyLists::defaults()) {
+            if(xfer.size() == 0) return;
+#if H5_VERSION_GE(1, 14, 0)
+            if(H5Dwrite_multi(xfer.size(),
+                              xfer.dsets.data(),
+                              xfer.memTypes.data(),
+                              xfer.memSpaces.data(),
+                              xfer.fileSpaces.data(),
+                              plists.dsetXfer,
+                              xfer.bufs.data()) < 0)
+                throw h5pp::runtime_error("Failed to write {} datasets with H5Dwrite_multi", xfer.size());
+#else
+            for(size_t i = 0; i < xfer.size(); i++)
+                if(H5Dwrite(xfer.dsets[i], xfer.memTypes[i], xfer.memSpaces[i], xfer.fileSpaces[i], plists.dsetXfer, xfer.bufs[i]) < 0)
+                    throw h5pp::runtime_error("Failed to write dataset {} of {} in batch", i, xfer.size());
+#endif
+        }
+
+        /*! Reads several datasets with a single H5Dread_multi, or one H5Dread at a time on HDF5 older than 1.14 */
+        inline void readMulti(MultiTransfer<void *> &xfer, const PropertyLists &plists = PropertyLists::defaults()) {
+            if(xfer.size() == 0) return;
+#if H5_VERSION_GE(1, 14, 0)
+            if(H5Dread_multi(xfer.size(),
+                             xfer.dsets.data(),
+                             xfer.memTypes.data(),
+                             xfer.memSpaces.data(),
+                             xfer.fileSpaces.data(),
+                             plists.dsetXfer,
+                             xfer.bufs.data()) < 0)
+                throw h5pp::runtime_error("Failed to read {} datasets with H5Dread_multi", xfer.size());
+#else
+            for(size_t i = 0; i < xfer.size(); i++)
+                if(H5Dread(xfer.dsets[i], xfer.memTypes[i], xfer.memSpaces[i], xfer.fileSpaces[i], plists.dsetXfer, xfer.bufs[i]) < 0)
+                    throw h5pp::runtime_error("Failed to read dataset {} of {} in batch", i, xfer.size());
+#endif
+        }
+    }
+
+    namespace internal {
+        /*! True if DataType can be handed to a multi-dataset transfer as is, without the extra steps in hdf5::writeDataset/readDataset */
+        template<typename DataType>
+        constexpr bool isMultiCapable() {
+            if constexpr(type::sfinae::is_text_v<DataType> or type::sfinae::has_text_v<DataType>) return false;
+            else if constexpr(type::sfinae::is_or_has_varr_v<DataType>) return false;
+#ifdef H5PP_USE_EIGEN3
+            else if constexpr(type::sfinae::is_eigen_colmajor_v<DataType> and not type::sfinae::is_eigen_1d_v<DataType>) return false;
+#endif
+            else return true;
+        }
+
+        struct BatchItem {
+            Options                 options;
+            std::optional<DataInfo> dataInfo;
+            std::optional<DsetInfo> dsetInfo;
+            bool                    multi = false; /*!< Whether this item goes into the multi-dataset transfer */
+            explicit BatchItem(Options options_) : options(std::move(options_)) {}
+            virtual ~BatchItem() = default;
+        };
+
+        struct WriteItem : public BatchItem {
+            using BatchItem::BatchItem;
+            /*! Scans (or rescans, if the data changed shape) and creates or resizes the dataset. Returns true if it scanned */
+            virtual bool               prepare(const hid::h5f &file, const PropertyLists &plists) = 0;
+            virtual void               write(const PropertyLists &plists)                         = 0;
+            [[nodiscard]] virtual const void *pointer() const                                     = 0;
+        };
+
+        struct ReadItem : public BatchItem {
+            using BatchItem::BatchItem;
+            /*! Scans the dataset and resizes the data container to fit. Returns true if it scanned */
+            virtual bool                prepare(const hid::h5f &file, const PropertyLists &plists) = 0;
+            virtual void                read(const PropertyLists &plists)                          = 0;
+            [[nodiscard]] virtual void *pointer()                                                  = 0;
+        };
+
+        template<typename DataType>
+        struct WriteItemT final : public WriteItem {
+            const DataType &data;
+            WriteItemT(const DataType &data_, Options options_) : WriteItem(std::move(options_)), data(data_) {}
+            bool prepare(const hid::h5f &file, const PropertyLists &plists) final {
+                // Rescan only when the shape of the data has changed since the last transfer
+                OptDimsType dataDims = options.dataDims;
+                if constexpr(not std::is_pointer_v<DataType>)
+                    if(not dataDims) dataDims = util::getDimensions(data);
+                if(dataInfo and dsetInfo and dataInfo->dataDims and dataDims and dataInfo->dataDims.value() == dataDims.value()) return false;
+                dataInfo = scan::scanDataInfo(data, options);
+                dsetInfo = scan::inferDsetInfo(file, data, options, plists);
+                hdf5::createDataset(dsetInfo.value(), plists);
+                hdf5::resizeDataset(dsetInfo.value(), dataInfo.value());
+                multi = false;
+                if constexpr(isMultiCapable<DataType>()) {
+                    if(not dsetInfo->dsetSlab and not dataInfo->dataSlab and
+                       hdf5::internal::getConversion<DataType>(dataInfo.value(), dsetInfo.value()) == hdf5::internal::Conversion::none) {
+                        try {
+                            hdf5::assertWriteBufferIsLargeEnough(data, dataInfo->h5Space.value(), dsetInfo->h5Type.value());
+                            hdf5::assertBytesPerElemMatch<DataType>(dsetInfo->h5Type.value());
+                            hdf5::assertSpacesEqual<DataType>(dataInfo->h5Space.value(), dsetInfo->h5Space.value(), dsetInfo->h5Type.value());
+                        } catch(const std::exception &ex) {
+                            throw h5pp::runtime_error("Error writing to dataset [{}]:\n{}", dsetInfo->dsetPath.value(), ex.what());
+                        }
+                        multi = true;
+                    }
+                }
+                return true;
+            }
+            void write(const PropertyLists &plists) final { hdf5::writeDataset(data, dataInfo.value(), dsetInfo.value(), plists); }
+            [[nodiscard]] const void *pointer() const final { return util::getVoidPointer<const void *>(data); }
+        };
+
+        template<typename DataType>
+        struct ReadItemT final : public ReadItem {
+            DataType &data;
+            ReadItemT(DataType &data_, Options options_) : ReadItem(std::move(options_)), data(data_) {}
+            bool prepare(const hid::h5f &file, const PropertyLists &plists) final {
+                if(dsetInfo and dataInfo and dsetInfo->dsetDims) {
+                    // Reuse the metadata from the last read while the dataset keeps its extent
+                    hid::h5s space = H5Dget_space(dsetInfo->h5Dset->unchecked());
+                    if(hdf5::getDimensions(space) == dsetInfo->dsetDims.value()) {
+                        hdf5::resizeData(data, dataInfo.value(), dsetInfo.value());
+                        return false;
+                    }
+                }
+                dsetInfo = scan::readDsetInfo(file, options, plists);
+                if(dsetInfo->dsetExists and not dsetInfo->dsetExists.value())
+                    throw h5pp::runtime_error("Cannot read dataset [{}]: It does not exist", options.linkPath.value());
+                dataInfo = scan::scanDataInfo(data, options);
+                hdf5::resizeData(data, dataInfo.value(), dsetInfo.value());
+                multi = false;
+                if constexpr(isMultiCapable<DataType>()) {
+                    if(not dsetInfo->dsetSlab and not dataInfo->dataSlab and
+                       hdf5::internal::getConversion<DataType>(dataInfo.value(), dsetInfo.value()) == hdf5::internal::Conversion::none and
+                       not std::is_same_v<DataType, std::vector<std::byte>> and H5Tget_class(dsetInfo->h5Type.value()) != H5T_OPAQUE and
+                       not util::should_track_vlen_reclaims<DataType>(dsetInfo->h5Type.value(), plists)) {
+                        try {
+                            hdf5::assertReadTypeIsLargeEnough<DataType>(dsetInfo->h5Type.value());
+                            hdf5::assertReadSpaceIsLargeEnough(data, dataInfo->h5Space.value(), dsetInfo->h5Type.value());
+                            hdf5::assertSpacesEqual<DataType>(dataInfo->h5Space.value(), dsetInfo->h5Space.value(), dsetInfo->h5Type.value());
+                        } catch(const std::exception &ex) {
+                            throw h5pp::runtime_error("Error reading dataset [{}]:\n{}", dsetInfo->dsetPath.value(), ex.what());
+                        }
+                        multi = true;
+                    }
+                }
+                return true;
+            }
+            void read(const PropertyLists &plists) final { hdf5::readDataset(data, dataInfo.value(), dsetInfo.value(), plists); }
+            [[nodiscard]] void *pointer() final { return util::getVoidPointer<void *>(data); }
+        };
+    }
+
+    /*!
+     * \brief A list of (data, dataset path) pairs of any types, written together with File::writeDatasets.
+     *
+     * The batch keeps references to the data, which must outlive it. The metadata of each dataset is scanned on the first
+     * write and kept by the batch, so writing the same batch again (e.g. a checkpoint) only scans the datasets whose data
+     * has changed shape. Datasets are created and resized as in File::writeDataset.
+     *
+     * \code
+     *  h5pp::WriteBatch batch;
+     *  batch.add(energies, "checkpoint/energies").add(state, "checkpoint/state").add(step, "checkpoint/step");
+     *  auto report = file.writeDatasets(batch);
+     * \endcode
+     */
+    class WriteBatch {
+        private:
+        std::vector<std::unique_ptr<internal::WriteItem>> items;
+        friend class File;
+
+        public:
+        template<typename DataType>
+        WriteBatch &add(const DataType &data, const Options &options) {
+            static_assert(not type::sfinae::is_h5pp_id<DataType>);
+            options.assertWellDefined();
+            items.emplace_back(std::make_unique<internal::WriteItemT<DataType>>(data, options));
+            return *this;
+        }
+        template<typename DataType>
+        WriteBatch &add(const DataType &data, std::string_view dsetPath) {
+            Options options;
+            options.linkPath = dsetPath;
+            return add(data, options);
+        }
+        [[nodiscard]] size_t size() const { return items.size(); }
+        [[nodiscard]] bool   empty() const { return items.empty(); }
+        void                 clear() { items.clear(); }
+    };
+
+    /*!
+     * \brief A list of (data, dataset path) pairs of any types, read together with File::readDatasets.
+     *
+     * The batch keeps references to the data containers, which must outlive it. Containers are resized to fit each dataset
+     * as in File::readDataset. The metadata of each dataset is scanned on the first read, and again only when the extent of
+     * the dataset has changed. Datasets must not be deleted or replaced while the batch is in use.
+     */
+    class ReadBatch {
+        private:
+        std::vector<std::unique_ptr<internal::ReadItem>> items;
+        friend class File;
+
+        public:
+        template<typename DataType>
+        ReadBatch &add(DataType &data, const Options &options) {
+            static_assert(not std::is_const_v<DataType>);
+            static_assert(not type::sfinae::is_h5pp_id<DataType>);
+            options.assertWellDefined();
+            items.emplace_back(std::make_unique<internal::ReadItemT<DataType>>(data, options));
+            return *this;
+        }
+        template<typename DataType>
+        ReadBatch &add(DataType &data, std::string_view dsetPath) {
+            Options options;
+            options.linkPath = dsetPath;
+            return add(data, options);
+        }
+        [[nodiscard]] size_t size() const { return items.size(); }
+        [[nodiscard]] bool   empty() const { return items.empty(); }
+        void                 clear() { items.clear(); }
+    };
+}
@@ -302,6 +302,12 @@ namespace h5pp {
         template<typename T>
         inline constexpr bool is_eigen_map_v = is_eigen_map<T>::value;
         template<typename T>
+        struct is_eigen_tensormap : public std::false_type {};
+        template<typename PlainObjectType, int Options, template<class> class MakePointer>
+        struct is_eigen_tensormap<Eigen::TensorMap<PlainObjectType, Options, MakePointer>> : public std::true_type {};
+        template<typename T>
+        inline constexpr bool is_eigen_tensormap_v = is_eigen_tensormap<std::decay_t<T>>::value;
+        template<typename T>
         using is_eigen_plain = std::is_base_of<Eigen::PlainObjectBase<std::decay_t<T>>, std::decay_t<T>>;
         template<typename T>
         inline constexpr bool is_eigen_plain_v = is_eigen_plain<T>::value;
@@ -56,9 +56,23 @@ namespace h5pp {
     /*! \brief Set policy for modifying dataset dimensions when overwriting
      */
     enum class ResizePolicy {
-        FIT,  /*!< Overwriting a dataset will shrink or grow existing dimensions to fit new data (default on H5D_CHUNKED) */
-        GROW, /*!< Overwriting a dataset will may grow existing dimensions, but never shrink, to fit new data (works only on H5D_CHUNKED) */
-        OFF,  /*!< Overwriting a dataset will not modify existing dimensions */
+        FIT,     /*!< Overwriting a dataset will shrink or grow existing dimensions to fit new data (default on H5D_CHUNKED) */
+        GROW,    /*!< Overwriting a dataset will may grow existing dimensions, but never shrink, to fit new data (works only on H5D_CHUNKED) */
+        OFF,     /*!< Overwriting a dataset will not modify existing dimensions */
+        REPLACE, /*!< Like FIT, but H5D_COMPACT and H5D_CONTIGUOUS datasets are replaced by a new dataset with the same properties and new dimensions */
+    };
+
+    /*! \brief Hint about how a chunked dataset will be accessed, used to choose the chunk shape on create
+     *
+     * Chunks are the unit of I/O for H5D_CHUNKED datasets: touching a single element reads or writes the whole chunk.
+     * A chunk shape that matches the access pattern keeps the amount of bytes transferred close to the amount requested.
+     */
+    enum class AccessHint {
+        DEFAULT,     /*!< No particular pattern: use roughly square chunks in N dimensions */
+        APPEND,      /*!< Data is appended along one axis (see Options::accessAxis): chunks span the other axes fully */
+        ROW_SCAN,    /*!< Data is read one index of the first axis at a time (e.g. rows of a matrix) */
+        COLUMN_SCAN, /*!< Data is read one index of the last axis at a time (e.g. columns of a matrix) */
+        RANDOM_TILE, /*!< Small rectangular tiles are read at random positions: use small square chunks */
     };
 
     /*! \brief Specify whether the target location is on the same file or a different one when copying objects
@@ -76,6 +90,15 @@ namespace h5pp {
         DETECT,     /*!< Use H5Iget_file_id() to check. This is the default, but avoid when known. */
     };
 
+    /*! \brief How the pattern of a h5pp::LinkQuery or h5pp::PathPattern is matched against link paths
+     */
+    enum class LinkMatch {
+        SUBSTRING, /*!< The last component of the path contains the pattern, as in File::findLinks */
+        PREFIX,    /*!< The path relative to the search root starts with the pattern */
+        GLOB,      /*!< The path relative to the search root matches a shell pattern: '*' and '?' stay within a group, '**' spans groups */
+        REGEX,     /*!< The path relative to the search root matches one ECMAScript regular expression per level, see h5pp::PathPattern */
+    };
+
     /*! \brief Mimic the log levels in spdlog
      */
     enum class LogLevel : size_t {
@@ -123,6 +146,7 @@ namespace h5pp {
         FileAccess,
         TableSelection,
         ResizePolicy,
+        AccessHint,
         LogLevel,
         H5T_class_t>);
         if constexpr(std::is_same_v<T, FileAccess>) switch(item) {
@@ -142,6 +166,14 @@ namespace h5pp {
             case ResizePolicy::FIT:          return "FIT";
             case ResizePolicy::GROW:         return "GROW";
             case ResizePolicy::OFF:          return "OFF";
+            case ResizePolicy::REPLACE:      return "REPLACE";
+        }
+        else if constexpr(std::is_same_v<T, AccessHint>) switch(item) {
+            case AccessHint::DEFAULT:        return "DEFAULT";
+            case AccessHint::APPEND:         return "APPEND";
+            case AccessHint::ROW_SCAN:       return "ROW_SCAN";
+            case AccessHint::COLUMN_SCAN:    return "COLUMN_SCAN";
+            case AccessHint::RANDOM_TILE:    return "RANDOM_TILE";
         }
         else if constexpr(std::is_same_v<T, LocationMode>) switch(item) {
             case LocationMode::SAME_FILE:    return "SAME_FILE";
@@ -1,7 +1,9 @@
 
 #pragma once
 
+#include "h5ppAttributeMap.h"
 #include "h5ppConstants.h"
+#include "h5ppDatasetBatch.h"
 #include "h5ppDimensionType.h"
 #include "h5ppEigen.h"
 #include "h5ppEnums.h"
@@ -10,16 +12,22 @@
 #include "h5ppHdf5.h"
 #include "h5ppHid.h"
 #include "h5ppInitListType.h"
+#include "h5ppLinkIndex.h"
 #include "h5ppLogger.h"
 #include "h5ppOptional.h"
 #include "h5ppPropertyLists.h"
 #include "h5ppScan.h"
+#include "h5ppSnapshot.h"
+#include "h5ppStringViews.h"
 #include "h5ppUtils.h"
 #include "h5ppVarr.h"
 #include "h5ppVersion.h"
 #include "h5ppVstr.h"
+#include <chrono>
+#include <functional>
 #include <hdf5.h>
 #include <hdf5_hl.h>
+#include <memory>
 #include <string>
 #include <utility>
 
@@ -42,6 +50,10 @@ namespace h5pp {
         hid::h5e                                  error_stack        = H5E_DEFAULT;    /*!< Reference to the error stack used by HDF5 */
         int                                       currentCompression = -1; /*!< Compression level (-1 is off, 0 is none, 9 is max) */
         mutable std::vector<ReclaimInfo::Reclaim> reclaimStack;            /*!< Stores alloc metadata from variable-length reads to free */
+        mutable std::optional<LinkIndex>          linkIndex = std::nullopt; /*!< Index of all links, see getLinkIndex() */
+        SnapshotPolicy                            snapshotPolicy;           /*!< Where and how often to take snapshots */
+        std::shared_ptr<SnapshotWriter>           snapshotWriter;           /*!< Writes snapshots in the background */
+        std::chrono::steady_clock::time_point     lastSnapshot;             /*!< When the last snapshot was taken */
         void                                      init() {
             h5pp::logger::setLogger("h5pp|init", logLevel, logTimestamp);
             h5pp::logger::log->debug("Accessing file: [{}]", filePath.string());
@@ -55,6 +67,31 @@ namespace h5pp {
             filePath = h5pp::hdf5::createFile(filePath, fileAccess, plists);
         }
 
+        /*! Returns the link index if the file is read-only and has not changed since the index was built */
+        [[nodiscard]] const LinkIndex *currentLinkIndex() const {
+            if(fileAccess != FileAccess::READONLY or not linkIndex or not linkIndex->isCurrent(filePath)) return nullptr;
+            return &linkIndex.value();
+        }
+
+        template<H5O_type_t ObjType>
+        [[nodiscard]] std::vector<std::string> findPattern(const PathPattern &pattern, std::string_view searchRoot, long maxHits, bool followSymlinks) const {
+            LinkSearch search;
+            search.pattern        = pattern;
+            search.searchRoot     = searchRoot;
+            search.maxHits        = maxHits;
+            search.followSymlinks = followSymlinks;
+            std::vector<std::string> matchList;
+            h5pp::hdf5::findLinks<ObjType>(
+                openFileHandle(),
+                search,
+                [&matchList](std::string_view linkPath) {
+                    matchList.emplace_back(linkPath);
+                    return true;
+                },
+                plists);
+            return matchList;
+        }
+
         public:
         // The following struct contains modifiable property lists.
         // This allows us to use h5pp with MPI, for instance.
@@ -94,6 +131,47 @@ namespace h5pp {
             H5garbage_collect();
             H5Eprint(H5E_DEFAULT, stderr);
         }
+        /*! Sets where and how often snapshots are taken, see snapshot(). Waits for the snapshots taken so far to be written */
+        void setSnapshotPolicy(const SnapshotPolicy &policy) {
+            if(snapshotWriter) snapshotWriter->wait();
+            snapshotPolicy = policy;
+            auto target    = policy.snapshotPath;
+            if(target.empty()) target = filePath.parent_path() / (filePath.stem().string() + ".snapshot" + filePath.extension().string());
+            snapshotWriter = std::make_shared<SnapshotWriter>(target);
+            lastSnapshot   = std::chrono::steady_clock::now();
+        }
+
+        /*! Gets the policy for snapshots */
+        [[nodiscard]] const SnapshotPolicy &getSnapshotPolicy() const { return snapshotPolicy; }
+
+        /*! Writes a snapshot of the file to disk, in the background
+         *
+         * This is meant for files kept in memory with `setDriver_core()` and `setKeepFileOpened()`. The image of the file
+         * is copied with H5Fget_file_image, and then written to disk on a background thread while the file can be modified
+         * again. The snapshot first goes to a temporary file, which is renamed to the snapshot path when it is complete.
+         * If snapshots are taken faster than they are written, the ones that were never started are skipped.
+         * Errors from writing are thrown by the next call to snapshot() or waitForSnapshots().
+         */
+        void snapshot() {
+            if(not snapshotWriter) setSnapshotPolicy(snapshotPolicy);
+            auto image = snapshotWriter->takeBuffer();
+            h5pp::hdf5::getFileImage(openFileHandle(), image);
+            snapshotWriter->submit(std::move(image));
+            lastSnapshot = std::chrono::steady_clock::now();
+        }
+
+        /*! Takes a snapshot if the interval of the snapshot policy has passed since the last one. Returns true if it did */
+        bool snapshotIfDue() {
+            if(snapshotWriter and std::chrono::steady_clock::now() - lastSnapshot < snapshotPolicy.interval) return false;
+            snapshot();
+            return true;
+        }
+
+        /*! Blocks until all snapshots taken so far are written to disk */
+        void waitForSnapshots() const {
+            if(snapshotWriter) snapshotWriter->wait();
+        }
+
         /*! Calls H5Treclaim(...) on any data that HDF5 may have allocated for variable-length data during the last reads */
         void vlenReclaim() const {
             for(auto &item : reclaimStack) item.reclaim();
@@ -201,7 +279,7 @@ namespace h5pp {
          * */
         void setCloseDegree(H5F_close_degree_t degree) {
             if(plists.fileAccess == H5P_DEFAULT) plists.fileAccess = H5Fget_access_plist(openFileHandle());
-            H5Pset_fclose_degree(plists.fileAccess, degree);
+            H5Pset_fclose_degree(PropertyLists::writable(plists.fileAccess), degree);
             if(fileHandle) { // Refresh if the filehandle being kept is open
                 fileHandle = std::nullopt;
                 fileHandle = openFileHandle();
@@ -218,7 +296,7 @@ namespace h5pp {
                             size_t bytesPerMalloc = 10240000 /*!< Size, in bytes, of memory increments. */
         ) {
             if(plists.fileAccess == H5P_DEFAULT) plists.fileAccess = H5Fget_access_plist(openFileHandle());
-            H5Pset_fapl_core(plists.fileAccess, bytesPerMalloc, static_cast<hbool_t>(writeOnClose));
+            H5Pset_fapl_core(PropertyLists::writable(plists.fileAccess), bytesPerMalloc, static_cast<hbool_t>(writeOnClose));
             if(fileHandle) { // Refresh if the filehandle being kept is open
                 fileHandle = std::nullopt;
                 fileHandle = openFileHandle();
@@ -232,7 +310,7 @@ namespace h5pp {
          */
         void setDriver_sec2() {
             if(plists.fileAccess == H5P_DEFAULT) plists.fileAccess = H5Fget_access_plist(openFileHandle());
-            H5Pset_fapl_sec2(plists.fileAccess);
+            H5Pset_fapl_sec2(PropertyLists::writable(plists.fileAccess));
             if(fileHandle) { // Refresh if the filehandle being kept is open
                 fileHandle = std::nullopt;
                 fileHandle = openFileHandle();
@@ -245,7 +323,7 @@ namespace h5pp {
          */
         void setDriver_stdio() {
             if(plists.fileAccess == H5P_DEFAULT) plists.fileAccess = H5Fget_access_plist(openFileHandle());
-            H5Pset_fapl_stdio(plists.fileAccess);
+            H5Pset_fapl_stdio(PropertyLists::writable(plists.fileAccess));
             if(fileHandle) { // Refresh if the filehandle being kept is open
                 fileHandle = std::nullopt;
                 fileHandle = openFileHandle();
@@ -260,7 +338,7 @@ namespace h5pp {
          */
         void setDriver_mpio(MPI_Comm comm, MPI_Info info) {
             plists.fileAccess = H5Fget_access_plist(openFileHandle());
-            H5Pset_fapl_mpio(plists.fileAccess, comm, info);
+            H5Pset_fapl_mpio(PropertyLists::writable(plists.fileAccess), comm, info);
             if(fileHandle) { // Refresh if the filehandle being kept is open
                 fileHandle = std::nullopt;
                 fileHandle = openFileHandle();
@@ -286,6 +364,18 @@ namespace h5pp {
             return h5pp::hdf5::copyFile(getFilePath(), targetFilePath, perm, plists);
         }
 
+        /*! Make a repacked copy of this file at a different path, copying chunked datasets chunk by chunk.
+         *
+         * No change to the current file. See h5pp::hdf5::repackFile.
+         */
+        CopyReport repackFileTo(const h5pp::fs::path &targetFilePath,                                   /*!< Copy to this path */
+                                const FileAccess     &perm          = FileAccess::COLLISION_FAIL,       /*!< File access permission at the new path */
+                                const RepackOptions  &repackOptions = RepackOptions(),                  /*!< Compression and threads for the copy */
+                                const std::function<void(size_t, size_t, std::string_view)> &progress = nullptr /*!< Called after each link */
+        ) const {
+            return h5pp::hdf5::repackFile(getFilePath(), targetFilePath, perm, repackOptions, plists, progress);
+        }
+
         /*! Move the current file to a new path.
          *
          * The current file is re-opened at the new path.
@@ -299,6 +389,73 @@ namespace h5pp {
             return newPath;
         }
 
+        /*! Returns the number of bytes of unused space in the file, as tracked by HDF5 while the file is open.
+         *
+         * Space is freed when datasets are deleted or replaced (see h5pp::ResizePolicy::REPLACE).
+         * HDF5 reuses freed space for new data while the file stays open, but forgets about it when the file is closed.
+         */
+        [[nodiscard]] hsize_t getFreeSpace() const {
+            auto freeSpace = H5Fget_freespace(openFileHandle());
+            if(freeSpace < 0) throw h5pp::runtime_error("Failed to get free space in file [{}]", filePath.string());
+            return static_cast<hsize_t>(freeSpace);
+        }
+
+        /*! Rewrite the file to reclaim unused space, e.g. left behind by deleted or replaced datasets.
+         *
+         * All objects are copied into a temporary file next to this one, which then replaces this file.
+         * If given, progress(done, total, link) is called after each link in the file root has been copied.
+         * Returns the number of bytes reclaimed.
+         */
+        hsize_t repack(const std::function<void(size_t, size_t, std::string_view)> &progress = nullptr) {
+            if(fileAccess == h5pp::FileAccess::READONLY)
+                throw h5pp::runtime_error("Attempted to repack read-only file [{}]", filePath.string());
+            bool keepOpened = fileHandle.has_value();
+            setKeepFileClosed();
+            auto     oldSize = fs::file_size(filePath);
+            fs::path tmpPath = filePath;
+            tmpPath += ".repack";
+            h5pp::logger::log->debug("Repacking file [{}] via [{}]", filePath.string(), tmpPath.string());
+            try {
+                h5pp::hdf5::copyFile(filePath, tmpPath, h5pp::FileAccess::REPLACE, plists, progress);
+                fs::rename(tmpPath, filePath);
+            } catch(const std::exception &ex) {
+                std::error_code ec;
+                fs::remove(tmpPath, ec);
+                throw h5pp::runtime_error("Failed to repack file [{}]: {}", filePath.string(), ex.what());
+            }
+            auto newSize = fs::file_size(filePath);
+            if(keepOpened) setKeepFileOpened();
+            h5pp::logger::log->debug("Repacked file [{}]: {} bytes --> {} bytes", filePath.string(), oldSize, newSize);
+            return oldSize > newSize ? oldSize - newSize : 0;
+        }
+
+        /*! Rewrite the file chunk by chunk, e.g. to change the compression level of all chunked datasets.
+         *
+         * Works like repack(progress), but copies with h5pp::hdf5::repackFile, configured by repackOptions.
+         * If given, progress(done, total, link) is called after each link in the file has been copied.
+         * Returns a report with the number of chunks and bytes copied, and the throughput.
+         */
+        CopyReport repack(const RepackOptions &repackOptions, const std::function<void(size_t, size_t, std::string_view)> &progress = nullptr) {
+            if(fileAccess == h5pp::FileAccess::READONLY)
+                throw h5pp::runtime_error("Attempted to repack read-only file [{}]", filePath.string());
+            bool keepOpened = fileHandle.has_value();
+            setKeepFileClosed();
+            fs::path tmpPath = filePath;
+            tmpPath += ".repack";
+            h5pp::logger::log->debug("Repacking file [{}] via [{}]", filePath.string(), tmpPath.string());
+            CopyReport report;
+            try {
+                report = h5pp::hdf5::repackFile(filePath, tmpPath, h5pp::FileAccess::REPLACE, repackOptions, plists, progress);
+                fs::rename(tmpPath, filePath);
+            } catch(const std::exception &ex) {
+                std::error_code ec;
+                fs::remove(tmpPath, ec);
+                throw h5pp::runtime_error("Failed to repack file [{}]: {}", filePath.string(), ex.what());
+            }
+            if(keepOpened) setKeepFileOpened();
+            return report;
+        }
+
         /*
          *
          * Functions for transferring contents
@@ -454,6 +611,57 @@ namespace h5pp {
             else return currentCompression;
         }
 
+        /*
+         *
+         * Functions related to dataset layout
+         *
+         */
+
+        /*! Set the policy that decides the layout of new datasets when no layout is given
+         *
+         * Example: prefer chunked layout for all datasets larger than 64 kB, and never use compact layout
+         * \code
+         *  auto policy              = file.getLayoutPolicy();
+         *  policy.maxSizeContiguous = 64 * 1024;
+         *  policy.compactIfSmall    = false;
+         *  file.setLayoutPolicy(policy);
+         * \endcode
+         */
+        void setLayoutPolicy(const LayoutPolicy &layoutPolicy) { plists.layoutPolicy = layoutPolicy; }
+
+        /*! Get the policy that decides the layout of new datasets */
+        [[nodiscard]] const LayoutPolicy &getLayoutPolicy() const { return plists.layoutPolicy; }
+
+        /*
+         *
+         * Functions related to dataset transfers
+         *
+         */
+
+        /*! Set the policy that sizes the type-conversion and background buffers of dataset transfers.
+         *
+         * HDF5 converts between the type in memory and the type on file one buffer at a time, e.g. when reading a subset of
+         * the fields of a table, or a compound dataset that was written with a different layout.
+         * The buffers are allocated once by h5pp, and reused between transfers. A single transfer can override the policy
+         * of the file with Options::xferBufferPolicy.
+         */
+        void setXferBufferPolicy(const XferBufferPolicy &xferBufferPolicy) { plists.xferBufferPolicy = xferBufferPolicy; }
+
+        /*! Get the policy that sizes the type-conversion and background buffers of dataset transfers */
+        [[nodiscard]] const XferBufferPolicy &getXferBufferPolicy() const { return plists.xferBufferPolicy; }
+
+        /*! Use type-conversion and background buffers of a fixed size in dataset transfers. 0 restores the HDF5 default (1 MB) */
+        void setXferBufferSize(size_t bytes) {
+            plists.xferBufferPolicy.size     = bytes;
+            plists.xferBufferPolicy.autoSize = false;
+        }
+
+        /*! Size the type-conversion and background buffers to fit each dataset transfer whole, up to maxBytes */
+        void setXferBufferAuto(size_t maxBytes = h5pp::constants::maxXferBuffer) {
+            plists.xferBufferPolicy.autoSize = true;
+            plists.xferBufferPolicy.maxSize  = maxBytes;
+        }
+
         /*
          *
          * Functions related to groups and datasets
@@ -606,7 +814,7 @@ namespace h5pp {
             const OptDimsType &         dsetChunkDims  = std::nullopt, /*!< (On create) Chunking dimensions. Only valid for H5D_CHUNKED datasets */
             const OptDimsType &         dsetMaxDims    = std::nullopt, /*!< (On create) Maximum dimensions. Only valid for H5D_CHUNKED datasets */
             std::optional<hid::h5t>     h5Type         = std::nullopt, /*!< (On create) Type of dataset. Override automatic type detection. */
-            std::optional<ResizePolicy> resizePolicy   = std::nullopt, /*!< Type of resizing if needed. Choose GROW, FIT,OFF */
+            std::optional<ResizePolicy> resizePolicy   = std::nullopt, /*!< Type of resizing if needed. Choose GROW, FIT, OFF, REPLACE */
             const std::optional<int> compression    = std::nullopt) /*!< (On create) Compression level 0-9, 0 = off, 9 is gives best compression and is slowest */
         /* clang-format on */
         {
@@ -632,7 +840,7 @@ namespace h5pp {
             std::optional<H5D_layout_t> h5Layout      = std::nullopt, /*!< (On create) Layout of dataset. Choose between H5D_CHUNKED,H5D_COMPACT and H5D_CONTIGUOUS */
             const OptDimsType &         dsetChunkDims = std::nullopt, /*!< (On create) Chunking dimensions. Only valid for H5D_CHUNKED datasets */
             const OptDimsType &         dsetMaxDims   = std::nullopt, /*!< (On create) Maximum dimensions. Only valid for H5D_CHUNKED datasets */
-            std::optional<ResizePolicy> resizePolicy  = std::nullopt, /*!< Type of resizing if needed. Choose GROW, FIT, OFF */
+            std::optional<ResizePolicy> resizePolicy  = std::nullopt, /*!< Type of resizing if needed. Choose GROW, FIT, OFF, REPLACE */
             const std::optional<int> compression   = std::nullopt  /*!< (On create) Compression level 0-9, 0 = off, 9 is gives best compression and is slowest */
             /* clang-format on */
         ) {
@@ -658,7 +866,7 @@ namespace h5pp {
             const OptDimsType &         dsetChunkDims = std::nullopt, /*!< (On create) Chunking dimensions. Only valid for H5D_CHUNKED datasets */
             const OptDimsType &         dsetMaxDims   = std::nullopt, /*!< (On create) Maximum dimensions. Only valid for H5D_CHUNKED datasets */
             std::optional<hid::h5t>     h5Type        = std::nullopt, /*!< (On create) Type of dataset. Override automatic type detection. */
-            std::optional<ResizePolicy> resizePolicy  = std::nullopt, /*!< Type of resizing if needed. Choose GROW, FIT, OFF */
+            std::optional<ResizePolicy> resizePolicy  = std::nullopt, /*!< Type of resizing if needed. Choose GROW, FIT, OFF, REPLACE */
             const std::optional<int> compression   = std::nullopt  /*!< (On create) Compression level 0-9, 0 = off, 9 is gives best compression and is slowest */
             /* clang-format on */
         ) {
@@ -918,6 +1126,134 @@ namespace h5pp {
             return data;
         }
 
+        /*! Reads a hyperslab into data, a preallocated buffer or a map of one, without resizing it or scanning the dataset again.
+         *  Get dsetInfo once with getDatasetInfo() to make repeated slice reads free of temporary buffers.
+         *  See h5pp::hdf5::readHyperslab
+         */
+        template<typename DataType>
+        void readHyperslab(DataType &data, const DsetInfo &dsetInfo, const Hyperslab &hyperslab) const {
+            h5pp::hdf5::readHyperslab(data, dsetInfo, hyperslab, plists);
+        }
+
+        /*! Reads the points or union of hyperslabs in selection into data, in a single read. See h5pp::Selection */
+        template<typename DataType>
+        void readSelection(DataType &data, std::string_view dsetPath, const Selection &selection) const {
+            static_assert(not std::is_const_v<DataType>);
+            Options options;
+            options.linkPath = dsetPath;
+            auto dsetInfo    = h5pp::scan::readDsetInfo(openFileHandle(), options, plists);
+            if(dsetInfo.dsetExists and not dsetInfo.dsetExists.value())
+                throw h5pp::runtime_error("Cannot read dataset [{}]: It does not exist", dsetPath);
+            h5pp::hdf5::readSelection(data, dsetInfo, selection, plists);
+        }
+
+        template<typename DataType>
+        [[nodiscard]] DataType readSelection(std::string_view dsetPath, const Selection &selection) const {
+            static_assert(not std::is_const_v<DataType>);
+            DataType data;
+            readSelection(data, dsetPath, selection);
+            return data;
+        }
+
+        /*! Reads the strings of a text dataset as views into one buffer, without allocating a std::string for each.
+         *  Pass a hyperslab to read a part of the dataset. See h5pp::StringViews
+         */
+        [[nodiscard]] StringViews readStringViews(std::string_view dsetPath, const std::optional<Hyperslab> &hyperslab = std::nullopt) const {
+            Options options;
+            options.linkPath = dsetPath;
+            options.dsetSlab = hyperslab;
+            auto dsetInfo    = h5pp::scan::readDsetInfo(openFileHandle(), options, plists);
+            if(dsetInfo.dsetExists and not dsetInfo.dsetExists.value())
+                throw h5pp::runtime_error("Cannot read dataset [{}]: It does not exist", dsetPath);
+            return h5pp::hdf5::readStringViews(dsetInfo, plists);
+        }
+
+        /*! Writes data into the points or union of hyperslabs in selection of an existing dataset, in a single write */
+        template<typename DataType>
+        void writeSelection(const DataType &data, std::string_view dsetPath, const Selection &selection) {
+            if(fileAccess == h5pp::FileAccess::READONLY)
+                throw h5pp::runtime_error("Attempted to write on read-only file [{}]", filePath.string());
+            Options options;
+            options.linkPath = dsetPath;
+            auto dsetInfo    = h5pp::scan::readDsetInfo(openFileHandle(), options, plists);
+            if(dsetInfo.dsetExists and not dsetInfo.dsetExists.value())
+                throw h5pp::runtime_error("Cannot write selection into dataset [{}]: It does not exist", dsetPath);
+            h5pp::hdf5::writeSelection(data, dsetInfo, selection, plists);
+        }
+
+        /*! Writes every (data, path) pair in batch, creating and resizing datasets as needed. See h5pp::WriteBatch.
+         *  Data that HDF5 can transfer as is goes into a single H5Dwrite_multi call on HDF5 1.14 or newer, and
+         *  into one H5Dwrite per dataset otherwise. Text, variable-length and converted data are written one at a time.
+         */
+        BatchReport writeDatasets(WriteBatch &batch) {
+            if(fileAccess == h5pp::FileAccess::READONLY)
+                throw h5pp::runtime_error("Attempted to write on read-only file [{}]", filePath.string());
+            BatchReport report;
+            report.multi       = hdf5::has_multi_dataset_io;
+            report.numDatasets = batch.size();
+            auto t0            = std::chrono::steady_clock::now();
+            auto fileHandle    = openFileHandle();
+
+            hdf5::MultiTransfer<const void *> xfer;
+            xfer.reserve(batch.size());
+            for(auto &item : batch.items) {
+                if(item->prepare(fileHandle, plists)) report.numScanned++;
+                report.bytes += item->dataInfo->dataByte.value_or(0);
+                if(item->multi)
+                    xfer.add(item->dsetInfo->h5Dset->unchecked(),
+                             item->dsetInfo->h5Type->unchecked(),
+                             item->dataInfo->h5Space->unchecked(),
+                             item->dsetInfo->h5Space->unchecked(),
+                             item->pointer());
+            }
+            auto t1 = std::chrono::steady_clock::now();
+            hdf5::writeMulti(xfer, plists);
+            for(auto &item : batch.items)
+                if(not item->multi) item->write(plists);
+            auto t2            = std::chrono::steady_clock::now();
+            report.numMulti    = xfer.size();
+            report.numSerial   = batch.size() - xfer.size();
+            report.scanSeconds = std::chrono::duration<double>(t1 - t0).count();
+            report.xferSeconds = std::chrono::duration<double>(t2 - t1).count();
+            h5pp::logger::log->debug("Wrote batch: {}", report.string(h5pp::logger::logIf(LogLevel::debug)));
+            return report;
+        }
+        BatchReport writeDatasets(WriteBatch &&batch) { return writeDatasets(batch); }
+
+        /*! Reads every (data, path) pair in batch, resizing the data containers as needed. See h5pp::ReadBatch */
+        BatchReport readDatasets(ReadBatch &batch) const {
+            BatchReport report;
+            report.multi       = hdf5::has_multi_dataset_io;
+            report.numDatasets = batch.size();
+            auto t0            = std::chrono::steady_clock::now();
+            auto fileHandle    = openFileHandle();
+
+            hdf5::MultiTransfer<void *> xfer;
+            xfer.reserve(batch.size());
+            for(auto &item : batch.items) {
+                if(item->prepare(fileHandle, plists)) report.numScanned++;
+                report.bytes += item->dataInfo->dataByte.value_or(0);
+                if(item->multi)
+                    xfer.add(item->dsetInfo->h5Dset->unchecked(),
+                             item->dataInfo->h5Type->unchecked(),
+                             item->dataInfo->h5Space->unchecked(),
+                             item->dsetInfo->h5Space->unchecked(),
+                             item->pointer());
+            }
+            auto t1 = std::chrono::steady_clock::now();
+            hdf5::readMulti(xfer, plists);
+            for(auto &item : batch.items)
+                if(not item->multi) item->read(plists);
+            auto t2            = std::chrono::steady_clock::now();
+            report.numMulti    = xfer.size();
+            report.numSerial   = batch.size() - xfer.size();
+            report.scanSeconds = std::chrono::duration<double>(t1 - t0).count();
+            report.xferSeconds = std::chrono::duration<double>(t2 - t1).count();
+            h5pp::logger::log->debug("Read batch: {}", report.string(h5pp::logger::logIf(LogLevel::debug)));
+            return report;
+        }
+        BatchReport readDatasets(ReadBatch &&batch) const { return readDatasets(batch); }
+
         /*
          *
          * Functions related to attributes
@@ -1076,6 +1412,16 @@ namespace h5pp {
             return h5pp::hdf5::getAttributeNames(openFileHandle(), linkPath, std::nullopt, plists.linkAccess);
         }
 
+        /*! Reads every attribute of linkPath in one pass over the open object. See h5pp::AttrValue for the types of the values */
+        [[nodiscard]] AttrMap readAllAttributes(std::string_view linkPath) const {
+            return h5pp::hdf5::readAllAttributes(openFileHandle(), linkPath, std::nullopt, plists.linkAccess);
+        }
+
+        /*! Reads every attribute of each link in linkPaths, with the file opened once. The results are in the order of linkPaths */
+        [[nodiscard]] std::vector<AttrMap> readAllAttributes(const std::vector<std::string> &linkPaths) const {
+            return h5pp::hdf5::readAllAttributes(openFileHandle(), linkPaths, plists.linkAccess);
+        }
+
         /*
          *
          *
@@ -1111,6 +1457,17 @@ namespace h5pp {
             return info;
         }
 
+        /*! Creates a table whose records are structs of type DataType, registered with H5PP_REGISTER_COMPOUND */
+        template<typename DataType>
+        TableInfo createTable(std::string_view   tablePath,
+                              std::string_view   tableTitle,
+                              const OptDimsType &chunkDims   = std::nullopt,
+                              std::optional<int> compression = std::nullopt) {
+            static_assert(type::compound::is_registered_v<DataType>,
+                          "createTable<DataType> requires DataType to be registered with H5PP_REGISTER_COMPOUND");
+            return createTable(type::getH5Type<DataType>(), tablePath, tableTitle, chunkDims, compression);
+        }
+
         template<typename DataType>
         TableInfo writeTableRecords(const DataType        &data,
                                     std::string_view       tablePath,
@@ -1122,7 +1479,7 @@ namespace h5pp {
             Options options;
             options.linkPath = h5pp::util::safe_str(tablePath);
             auto info        = h5pp::scan::readTableInfo(openFileHandle(), options, plists);
-            h5pp::hdf5::writeTableRecords(data, info, offset, extent);
+            h5pp::hdf5::writeTableRecords(data, info, offset, extent, plists);
             return info;
         }
 
@@ -1135,7 +1492,7 @@ namespace h5pp {
             options.linkPath = h5pp::util::safe_str(tablePath);
             auto info        = h5pp::scan::readTableInfo(openFileHandle(), options, plists);
             info.assertWriteReady(); // Check to avoid bad access on numRecords below, in case of error.
-            h5pp::hdf5::writeTableRecords(data, info, info.numRecords.value(), extent);
+            h5pp::hdf5::writeTableRecords(data, info, info.numRecords.value(), extent, plists);
             return info;
         }
 
@@ -1145,7 +1502,7 @@ namespace h5pp {
             if(fileAccess == h5pp::FileAccess::READONLY)
                 throw h5pp::runtime_error("Attempted to write on read-only file [{}]", filePath.string());
             info.assertWriteReady(); // Check to avoid bad access on numRecords below, in case of error.
-            h5pp::hdf5::writeTableRecords(data, info, info.numRecords.value(), extent);
+            h5pp::hdf5::writeTableRecords(data, info, info.numRecords.value(), extent, plists);
             return info;
         }
 
@@ -1555,6 +1912,7 @@ namespace h5pp {
                                                          long             maxHits        = -1,
                                                          long             maxDepth       = -1,
                                                          bool             followSymlinks = false) const {
+            if(const auto *index = currentLinkIndex()) return index->findLinks(searchKey, searchRoot, maxHits, maxDepth, followSymlinks, H5O_TYPE_UNKNOWN);
             return h5pp::hdf5::findLinks<H5O_TYPE_UNKNOWN>(openFileHandle(),
                                                            searchKey,
                                                            searchRoot,
@@ -1569,6 +1927,7 @@ namespace h5pp {
                                                             long             maxHits        = -1,
                                                             long             maxDepth       = -1,
                                                             bool             followSymlinks = false) const {
+            if(const auto *index = currentLinkIndex()) return index->findLinks(searchKey, searchRoot, maxHits, maxDepth, followSymlinks, H5O_TYPE_DATASET);
             return h5pp::hdf5::findLinks<H5O_TYPE_DATASET>(openFileHandle(),
                                                            searchKey,
                                                            searchRoot,
@@ -1583,6 +1942,7 @@ namespace h5pp {
                                                           long             maxHits        = -1,
                                                           long             maxDepth       = -1,
                                                           bool             followSymlinks = false) const {
+            if(const auto *index = currentLinkIndex()) return index->findLinks(searchKey, searchRoot, maxHits, maxDepth, followSymlinks, H5O_TYPE_GROUP);
             return h5pp::hdf5::findLinks<H5O_TYPE_GROUP>(openFileHandle(),
                                                          searchKey,
                                                          searchRoot,
@@ -1592,12 +1952,104 @@ namespace h5pp {
                                                          plists);
         }
 
+        /*! Returns the paths under searchRoot, relative to it, that match pattern. Groups that cannot lead to a match are not searched */
+        [[nodiscard]] std::vector<std::string>
+            findLinks(const PathPattern &pattern, std::string_view searchRoot = "/", long maxHits = -1, bool followSymlinks = false) const {
+            return findPattern<H5O_TYPE_UNKNOWN>(pattern, searchRoot, maxHits, followSymlinks);
+        }
+
+        /*! As findLinks(pattern, ...), for datasets only */
+        [[nodiscard]] std::vector<std::string>
+            findDatasets(const PathPattern &pattern, std::string_view searchRoot = "/", long maxHits = -1, bool followSymlinks = false) const {
+            return findPattern<H5O_TYPE_DATASET>(pattern, searchRoot, maxHits, followSymlinks);
+        }
+
+        /*! As findLinks(pattern, ...), for groups only */
+        [[nodiscard]] std::vector<std::string>
+            findGroups(const PathPattern &pattern, std::string_view searchRoot = "/", long maxHits = -1, bool followSymlinks = false) const {
+            return findPattern<H5O_TYPE_GROUP>(pattern, searchRoot, maxHits, followSymlinks);
+        }
+
+        /*! Passes the path of each link under search.searchRoot to callback, and returns the number of matches.
+         *  Return false from the callback to stop the search. Set search.numWorkers to search in several processes */
+        size_t findLinks(const LinkCallback &callback, const LinkSearch &search = LinkSearch()) const {
+            return h5pp::hdf5::findLinks<H5O_TYPE_UNKNOWN>(openFileHandle(), search, callback, plists);
+        }
+
+        /*! As findLinks(callback, search), for datasets only */
+        size_t findDatasets(const LinkCallback &callback, const LinkSearch &search = LinkSearch()) const {
+            return h5pp::hdf5::findLinks<H5O_TYPE_DATASET>(openFileHandle(), search, callback, plists);
+        }
+
+        /*! As findLinks(callback, search), for groups only */
+        size_t findGroups(const LinkCallback &callback, const LinkSearch &search = LinkSearch()) const {
+            return h5pp::hdf5::findLinks<H5O_TYPE_GROUP>(openFileHandle(), search, callback, plists);
+        }
+
+        /*! Passes each link under root, recursively, to callback as a h5pp::LinkView, and returns the number of links visited.
+         *  The view gives the path without copying it, and reads link and object properties only when they are asked for.
+         *  Return false from the callback to stop the visit */
+        size_t visitLinks(std::string_view root, const LinkViewCallback &callback) const {
+            LinkSearch filter;
+            filter.searchRoot = root;
+            return visitLinks(filter, callback);
+        }
+
+        /*! As visitLinks(root, callback), for the links under filter.searchRoot that pass filter */
+        size_t visitLinks(const LinkSearch &filter, const LinkViewCallback &callback) const {
+            return h5pp::hdf5::visitLinks<H5O_TYPE_UNKNOWN>(openFileHandle(), filter, callback, plists);
+        }
+
+        /*! Passes each attribute of linkPath to callback as a h5pp::AttrView, and returns the number of attributes visited.
+         *  Return false from the callback to stop the visit */
+        size_t visitAttributes(std::string_view linkPath, const AttrViewCallback &callback) const {
+            return h5pp::hdf5::visitAttributes(openFileHandle(), linkPath, callback, std::nullopt, plists.linkAccess);
+        }
+
+        /*! Returns an index of all the links in the file, with their object types, dataset dimensions and types, and attribute names.
+         *
+         * The index is saved next to the file, in LinkIndex::sidecarPath(filePath), unless useSidecar is false. It is loaded from
+         * there as long as the size and modification time of the file are unchanged, and built again otherwise.
+         * While a read-only File holds a current index, findLinks, findDatasets and findGroups (returning vectors) search it
+         * instead of the file.
+         */
+        const LinkIndex &getLinkIndex(bool useSidecar = true) const {
+            // Changes in the metadata cache must reach the disk before the file stamp means anything
+            if(fileAccess != FileAccess::READONLY and H5Fflush(openFileHandle(), H5F_SCOPE_GLOBAL) < 0)
+                throw h5pp::runtime_error("Failed to flush file [{}]", filePath.string());
+            if(linkIndex and linkIndex->isCurrent(filePath)) return linkIndex.value();
+            auto sidecar = LinkIndex::sidecarPath(filePath);
+            if(useSidecar) linkIndex = LinkIndex::load(sidecar, filePath);
+            if(not linkIndex) {
+                linkIndex = LinkIndex::build(openFileHandle(), filePath, plists);
+                if(useSidecar) {
+                    try {
+                        linkIndex->save(sidecar);
+                    } catch(const std::exception &ex) { h5pp::logger::log->debug("Could not save the link index: {}", ex.what()); }
+                }
+            }
+            return linkIndex.value();
+        }
+
         [[nodiscard]] DsetInfo getDatasetInfo(std::string_view dsetPath) const {
             Options options;
             options.linkPath = h5pp::util::safe_str(dsetPath);
             return h5pp::scan::readDsetInfo(openFileHandle(), options, plists);
         }
 
+        /*! Returns a report of the expected chunks touched and bytes transferred per request, for each access pattern
+         *  (or only the given one) on the chunk dimensions of an existing dataset */
+        [[nodiscard]] std::string explainChunking(std::string_view          dsetPath,
+                                                  std::optional<AccessHint> accessHint = std::nullopt,
+                                                  std::optional<size_t>     accessAxis = std::nullopt) const {
+            auto info = getDatasetInfo(dsetPath);
+            return h5pp::format("[{}] ", info.dsetPath.value()) + h5pp::util::explainChunking(h5pp::hdf5::getBytesPerElem(info.h5Type.value()),
+                                                     info.dsetDims.value(),
+                                                     info.dsetChunk,
+                                                     accessHint,
+                                                     accessAxis);
+        }
+
         [[nodiscard]] TableInfo getTableInfo(std::string_view tablePath) const {
             Options options;
             options.linkPath = h5pp::util::safe_str(tablePath);
@@ -6,14 +6,26 @@
 #include "h5ppFilesystem.h"
 #include "h5ppHyperslab.h"
 #include "h5ppInfo.h"
+#include "h5ppLinkSearch.h"
 #include "h5ppLogger.h"
 #include "h5ppPropertyLists.h"
+#include "h5ppSelection.h"
 #include "h5ppTypeCast.h"
+#include "h5ppTypeConvert.h"
 #include "h5ppTypeSfinae.h"
 #include "h5ppUtils.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
 #include <cstddef>
+#include <cstring>
+#include <exception>
+#include <functional>
 #include <hdf5.h>
 #include <hdf5_hl.h>
+#include <mutex>
+#include <numeric>
+#include <thread>
 #include <typeindex>
 #include <utility>
 
@@ -208,27 +220,24 @@ namespace h5pp::hdf5 {
     inline herr_t H5Dvlen_get_buf_size_safe(const hid::h5d &dset, const hid::h5t &type, const hid::h5s &space, hsize_t *vlen) {
         *vlen = 0;
         if(H5Tis_variable_str(type) <= 0) return -1;
-        if(H5Sget_simple_extent_type(space) != H5S_SCALAR) {
-            herr_t retval = H5Dvlen_get_buf_size(dset, type, space, vlen);
-            if(retval >= 0) return retval;
-        }
         if(H5Dget_storage_size(dset) <= 0) return 0;
-
-        auto                      size = H5Sget_simple_extent_npoints(space);
-        std::vector<const char *> vdata{type::safe_cast<size_t>(size)}; // Allocate for pointers for "size" number of strings
+        // H5Dvlen_get_buf_size reads the strings one at a time, which takes longer than reading them all at once and
+        // adding up their lengths here.
+        auto                      size     = type::safe_cast<hsize_t>(H5Sget_select_npoints(space));
+        hid::h5s                  memSpace = H5Screate_simple(1, &size, nullptr);
+        std::vector<const char *> vdata(type::safe_cast<size_t>(size), nullptr); // Pointers for "size" number of strings
         // HDF5 allocates space for each string
-        herr_t                    retval = H5Dread(dset, type, H5S_ALL, H5S_ALL, H5P_DEFAULT, vdata.data());
+        herr_t                    retval = H5Dread(dset, type, memSpace, space, H5P_DEFAULT, vdata.data());
         if(retval < 0) {
             H5Eprint(H5E_DEFAULT, stderr);
             return 0;
         }
         // Sum up the number of bytes
-        size_t maxLen = h5pp::constants::maxSizeCompact;
         for(auto elem : vdata) {
             if(elem == nullptr) continue;
-            *vlen += type::safe_cast<hsize_t>(std::min(std::string_view(elem).size(), maxLen) + 1); // Add null-terminator
+            *vlen += type::safe_cast<hsize_t>(std::strlen(elem) + 1); // Add null-terminator
         }
-        H5Dvlen_reclaim(type, space, H5P_DEFAULT, vdata.data());
+        H5Dvlen_reclaim(type, memSpace, H5P_DEFAULT, vdata.data());
         return 1;
     }
 
@@ -373,7 +382,8 @@ namespace h5pp::hdf5 {
     void assertReadSpaceIsLargeEnough(const DataType &data, const hid::h5s &space, const hid::h5t &type) {
         if(H5Tget_class(type) == H5T_STRING) {
             if(H5Tis_variable_str(type)) return; // These are resized on the fly
-            if constexpr(type::sfinae::is_text_v<DataType>) {
+            if constexpr(std::is_same_v<DataType, std::string> or type::sfinae::is_vstr_v<DataType>) return; // Sized when read
+            else if constexpr(type::sfinae::is_text_v<DataType>) {
                 // The memory buffer must fit hdf5Byte: that's how many bytes will participate in IO
                 auto hdf5Byte = H5Tget_size(type); // Chars including null-terminator.
                 auto hdf5Size = getSizeSelected(space);
@@ -419,6 +429,9 @@ namespace h5pp::hdf5 {
 
     template<typename userDataType>
     [[nodiscard]] bool checkBytesPerElemMatch(const hid::h5t &h5Type) {
+        if constexpr(h5pp::type::sfinae::is_or_has_fstr_v<userDataType>) {
+            if(H5Tget_class(h5Type) == H5T_STRING) return true; // fstr_t<N> can be read from and written to strings of any size
+        }
         size_t dsetTypeSize = h5pp::hdf5::getBytesPerElem(h5Type);
         size_t dataTypeSize = h5pp::util::getBytesPerElem<userDataType>();
         if(H5Tget_class(h5Type) == H5T_STRING) dsetTypeSize = H5Tget_size(H5T_C_S1);
@@ -442,6 +455,9 @@ namespace h5pp::hdf5 {
     template<typename DataType, typename = std::enable_if_t<not std::is_base_of_v<hid::hid_base<DataType>, DataType>>>
     void assertBytesPerElemMatch(const hid::h5t &h5Type) {
         if constexpr(h5pp::type::sfinae::is_container_of_v<DataType, std::byte>) return;
+        if constexpr(h5pp::type::sfinae::is_or_has_fstr_v<DataType>) {
+            if(H5Tget_class(h5Type) == H5T_STRING) return; // fstr_t<N> can be read from and written to strings of any size
+        }
         size_t dsetTypeSize = 0;
         size_t dataTypeSize = h5pp::util::getBytesPerElem<DataType>();
         if(H5Tget_class(h5Type) == H5T_STRING) dsetTypeSize = H5Tget_size(H5T_C_S1);
@@ -474,6 +490,9 @@ namespace h5pp::hdf5 {
     template<typename DataType, typename = std::enable_if_t<not type::sfinae::is_h5pp_id<DataType>>>
     void assertReadTypeIsLargeEnough(const hid::h5t &h5Type) {
         if constexpr(h5pp::type::sfinae::is_container_of_v<DataType, std::byte>) return;
+        if constexpr(h5pp::type::sfinae::is_or_has_fstr_v<DataType>) {
+            if(H5Tget_class(h5Type) == H5T_STRING) return; // fstr_t<N> can be read from and written to strings of any size
+        }
         size_t dsetTypeSize = h5pp::hdf5::getBytesPerElem(h5Type);
         size_t dataTypeSize = h5pp::util::getBytesPerElem<DataType>();
         if(H5Tget_class(h5Type) == H5T_STRING) dsetTypeSize = H5Tget_size(H5T_C_S1);
@@ -629,7 +648,7 @@ namespace h5pp::hdf5 {
     inline void createGroup(const h5x           &loc,
                             std::string_view     relGroupPath,
                             std::optional<bool>  groupExists = std::nullopt,
-                            const PropertyLists &plists      = PropertyLists()) {
+                            const PropertyLists &plists      = PropertyLists::defaults()) {
         static_assert(type::sfinae::is_hdf5_loc_id<h5x>,
                       "Template function [h5pp::hdf5::createGroup(const h5x & loc, ...)] requires type h5x to be: "
                       "[h5pp::hid::h5f], [h5pp::hid::h5g], [h5pp::hid::h5o] or [hid_t]");
@@ -732,18 +751,57 @@ namespace h5pp::hdf5 {
         return buf.c_str();
     }
 
+    /*! Passes each attribute of link to callback as an AttrView, in one pass with H5Aiterate, and returns the number visited.
+     *  The attributes are not opened unless the callback asks for their type or dimensions. Return false from the callback to stop */
+    template<typename h5x>
+    inline size_t visitAttributes(const h5x &link, const AttrViewCallback &callback) {
+        static_assert(type::sfinae::is_hdf5_link_id<h5x>,
+                      "Template function [h5pp::hdf5::visitAttributes(const h5x & link, ...)] requires type h5x to be: "
+                      "[h5pp::hid::h5d], [h5pp::hid::h5g], [h5pp::hid::h5o] or [hid_t]");
+        struct Visit {
+            const AttrViewCallback &callback;
+            size_t                  count = 0;
+            std::exception_ptr      error;
+        } visit{callback};
+        auto visitAttr = [](hid_t loc, const char *name, const H5A_info_t *info, void *opdata) -> herr_t {
+            auto &v = *static_cast<Visit *>(opdata);
+            try {
+                v.count++;
+                return v.callback(AttrView(loc, name, *info)) ? 0 : 1;
+            } catch(...) {
+                v.error = std::current_exception();
+                return -1;
+            }
+        };
+        herr_t ret = H5Aiterate(link, H5_INDEX_NAME, H5_ITER_NATIVE, nullptr, visitAttr, &visit);
+        if(visit.error) std::rethrow_exception(visit.error);
+        if(ret < 0) throw h5pp::runtime_error("Failed to iterate over the attributes of link [{}]", getName(link));
+        return visit.count;
+    }
+
+    template<typename h5x>
+    inline size_t visitAttributes(const h5x              &loc,
+                                  std::string_view        linkPath,
+                                  const AttrViewCallback &callback,
+                                  std::optional<bool>     linkExists = std::nullopt,
+                                  const hid::h5p         &linkAccess = H5P_DEFAULT) {
+        static_assert(type::sfinae::is_hdf5_loc_id<h5x>,
+                      "Template function [h5pp::hdf5::visitAttributes(const h5x & loc, std::string_view linkPath, ...)] requires type h5x to be: "
+                      "[h5pp::hid::h5f], [h5pp::hid::h5g], [h5pp::hid::h5o] or [hid_t]");
+        auto link = openLink<hid::h5o>(loc, linkPath, linkExists, linkAccess);
+        return visitAttributes(link, callback);
+    }
+
     template<typename h5x>
     [[nodiscard]] inline std::vector<std::string> getAttributeNames(const h5x &link) {
         static_assert(type::sfinae::is_hdf5_link_id<h5x>,
                       "Template function [h5pp::hdf5::getAttributeNames(const h5x & link, ...)] requires type h5x to be: "
                       "[h5pp::hid::h5d], [h5pp::hid::h5g], [h5pp::hid::h5o] or [hid_t]");
-        auto                     numAttrs = H5Aget_num_attrs(link);
         std::vector<std::string> attrNames;
-        std::string              buf;
-        for(auto i = 0; i < numAttrs; i++) {
-            hid::h5a attrId = H5Aopen_idx(link, type::safe_cast<unsigned int>(i));
-            attrNames.emplace_back(getAttributeName(attrId));
-        }
+        visitAttributes(link, [&attrNames](const AttrView &attr) {
+            attrNames.emplace_back(attr.name());
+            return true;
+        });
         return attrNames;
     }
 
@@ -880,7 +938,7 @@ namespace h5pp::hdf5 {
     inline void createSoftLink(std::string_view     targetLinkPath,
                                const h5x           &loc,
                                std::string_view     softLinkPath,
-                               const PropertyLists &plists = PropertyLists()) {
+                               const PropertyLists &plists = PropertyLists::defaults()) {
         static_assert(type::sfinae::is_hdf5_loc_id<h5x>,
                       "Template function [h5pp::hdf5::createSoftLink(const h5x & loc, ...)] requires type h5x to be: "
                       "[h5pp::hid::h5f], [h5pp::hid::h5g], [h5pp::hid::h5o] or [hid_t]");
@@ -903,7 +961,7 @@ namespace h5pp::hdf5 {
                                std::string_view     targetLinkPath,
                                const h5x           &hardLinkLoc,
                                std::string_view     hardLinkPath,
-                               const PropertyLists &plists = PropertyLists()) {
+                               const PropertyLists &plists = PropertyLists::defaults()) {
         static_assert(type::sfinae::is_hdf5_loc_id<h5x>,
                       "Template function [h5pp::hdf5::createHardLink(const h5x & loc, ...)] requires type h5x to be: "
                       "[h5pp::hid::h5f], [h5pp::hid::h5g], [h5pp::hid::h5o] or [hid_t]");
@@ -929,7 +987,7 @@ namespace h5pp::hdf5 {
                             std::string_view     targetLinkPath,
                             const h5x           &loc,
                             std::string_view     softLinkPath,
-                            const PropertyLists &plists = PropertyLists()) {
+                            const PropertyLists &plists = PropertyLists::defaults()) {
         static_assert(type::sfinae::is_hdf5_loc_id<h5x>,
                       "Template function [h5pp::hdf5::createExternalLink(const h5x & loc, ...)] requires type h5x to be: "
                       "[h5pp::hid::h5f], [h5pp::hid::h5g], [h5pp::hid::h5o] or [hid_t]");
@@ -1094,7 +1152,7 @@ namespace h5pp::hdf5 {
         htri_t is_regular = H5Sis_regular_hyperslab(h5space);
         if(is_regular < 0) throw h5pp::runtime_error("Failed to check if Hyperslab selection is regular (non-rectangular)");
         else if(is_regular == 0)
-            throw h5pp::runtime_error("Hyperslab selection is irregular (non-rectangular).\nThis is not yet supported by h5pp");
+            throw h5pp::runtime_error("Hyperslab selection is irregular (non-rectangular).\nUse h5pp::Selection for irregular selections");
 
 #endif
         htri_t valid = H5Sselect_valid(h5space);
@@ -1354,6 +1412,60 @@ namespace h5pp::hdf5 {
         else extendDataset(dsetInfo, dataInfo.dataDims.value(), axis);
     }
 
+    inline void replaceDataset(DsetInfo &info, const std::vector<hsize_t> &newDimensions) {
+        /*! Replaces a dataset that cannot be resized (H5D_COMPACT or H5D_CONTIGUOUS layout) with a new dataset
+         * that has the same type and creation properties, but new dimensions. The old contents are discarded.
+         *
+         * The new dataset is created under a temporary name before the old one is deleted, so the old dataset
+         * is left untouched if creation fails. Contiguous storage is allocated late, on the first write, so the
+         * space freed by the old dataset is reused by the new one if it fits. Otherwise, HDF5 tracks the freed space
+         * while the file is open (see H5Fget_freespace), and it can be reclaimed for good with h5pp::File::repack().
+         */
+        if(not info.dsetPath) throw h5pp::runtime_error("Could not replace dataset: Path undefined");
+        if(not info.h5Dset) throw h5pp::runtime_error("Could not replace dataset [{}]: info.h5Dset undefined", info.dsetPath.value());
+        if(not info.h5Type) throw h5pp::runtime_error("Could not replace dataset [{}]: info.h5Type undefined", info.dsetPath.value());
+        if(info.dsetDims and info.dsetDims.value() == newDimensions) return;
+        if(info.dsetSlab) {
+            throw h5pp::runtime_error("Could not replace dataset [{}]: a hyperslab selection {} was made on the dataset. "
+                                      "Replacing it would discard the data outside of the selection",
+                                      info.dsetPath.value(),
+                                      info.dsetSlab->string());
+        }
+        std::string oldInfoStr = info.string(h5pp::logger::logIf(LogLevel::debug));
+        hid::h5f    loc        = info.getLocId();
+        hsize_t     oldStorage = H5Dget_storage_size(info.h5Dset.value());
+        hid::h5p    dcpl       = info.h5DsetCreate ? H5Pcopy(info.h5DsetCreate.value()) : H5Dget_create_plist(info.h5Dset.value());
+        hid::h5p    dapl       = info.h5DsetAccess ? H5Pcopy(info.h5DsetAccess.value()) : H5Dget_access_plist(info.h5Dset.value());
+        hid::h5s    space      = H5Screate_simple(type::safe_cast<int>(newDimensions.size()), newDimensions.data(), nullptr);
+        std::string tmpPath    = h5pp::format("{}.h5pp-replace", info.dsetPath.value());
+        hid_t       dsetId     = H5Dcreate(loc, tmpPath.c_str(), info.h5Type.value(), space, H5P_DEFAULT, dcpl, dapl);
+        if(dsetId < 0) {
+            throw h5pp::runtime_error("Could not replace dataset [{}]: failed to create a dataset with dimensions {}",
+                                      info.dsetPath.value(),
+                                      newDimensions);
+        }
+        hid::h5d dset = dsetId;
+        info.h5Dset   = std::nullopt; // Close the old dataset before its link is deleted
+        if(H5Ldelete(loc, info.dsetPath->c_str(), H5P_DEFAULT) < 0)
+            throw h5pp::runtime_error("Could not replace dataset [{}]: failed to delete the old dataset", info.dsetPath.value());
+        if(H5Lmove(loc, tmpPath.c_str(), loc, info.dsetPath->c_str(), H5P_DEFAULT, H5P_DEFAULT) < 0)
+            throw h5pp::runtime_error("Could not replace dataset [{}]: failed to move link from [{}]", info.dsetPath.value(), tmpPath);
+
+        info.h5Dset       = dset;
+        info.h5Space      = H5Dget_space(dset);
+        info.h5DsetCreate = dcpl;
+        info.h5DsetAccess = dapl;
+        info.dsetDims     = newDimensions;
+        info.dsetDimsMax  = newDimensions;
+        info.dsetRank     = h5pp::hdf5::getRank(info.h5Space.value());
+        info.dsetSize     = h5pp::hdf5::getSize(info.h5Space.value());
+        info.dsetByte     = h5pp::hdf5::getBytesTotal(info.h5Dset.value(), info.h5Space, info.h5Type);
+        h5pp::logger::log->debug("Replaced dataset (freed {} bytes of storage)\n \t old: {} \n \t new: {}",
+                                 oldStorage,
+                                 oldInfoStr,
+                                 info.string(h5pp::logger::logIf(LogLevel::debug)));
+    }
+
     inline void
         resizeDataset(DsetInfo &info, const std::vector<hsize_t> &newDimensions, std::optional<h5pp::ResizePolicy> policy = std::nullopt) {
         if(info.resizePolicy == h5pp::ResizePolicy::OFF) return;
@@ -1384,6 +1496,14 @@ namespace h5pp::hdf5 {
             }
         }
 
+        if(policy == h5pp::ResizePolicy::REPLACE) {
+            // Chunked datasets can be resized in place
+            if(info.h5Layout and info.h5Layout.value() != H5D_CHUNKED and info.h5Space and
+               H5Sget_simple_extent_type(info.h5Space.value()) == H5S_SIMPLE)
+                return replaceDataset(info, newDimensions);
+            policy = h5pp::ResizePolicy::FIT;
+        }
+
         if(info.h5Layout and info.h5Layout.value() != H5D_CHUNKED) {
             switch(info.h5Layout.value()) {
                 case H5D_COMPACT: throw h5pp::runtime_error("Datasets with H5D_COMPACT layout cannot be resized");
@@ -1502,18 +1622,14 @@ namespace h5pp::hdf5 {
         if(H5Tget_class(type) == H5T_STRING) {
             if constexpr(type::sfinae::is_text_v<DataType>) {
                 // Minus one: String resize allocates the null-terminator automatically, and bytes is the number of characters including
-                // null-terminator
-                h5pp::util::resizeData(data, {type::safe_cast<hsize_t>(bytes) - 1});
+                // null-terminator. Fixed-length strings are read into the container before they are joined, which takes all the bytes.
+                if(H5Tis_variable_str(type) > 0) h5pp::util::resizeData(data, {type::safe_cast<hsize_t>(bytes) - 1});
+                else h5pp::util::resizeData(data, {type::safe_cast<hsize_t>(bytes)});
             } else if constexpr(type::sfinae::has_text_v<DataType> and type::sfinae::is_iterable_v<DataType>) {
                 // We have a container such as std::vector<std::string> here, and the dataset may have multiple string elements
+                // Each string element is sized when it is read, to the length of its text
                 auto size = getSizeSelected(space);
                 h5pp::util::resizeData(data, {type::safe_cast<hsize_t>(size)});
-                // In variable length arrays each string element is dynamically resized when read.
-                // For fixed-size we can resize already.
-                if(not H5Tis_variable_str(type)) {
-                    auto fixedStringSize = H5Tget_size(type) - 1; // Subtract null terminator
-                    for(auto &str : data) h5pp::util::resizeData(str, {type::safe_cast<hsize_t>(fixedStringSize)});
-                }
             } else {
                 throw h5pp::runtime_error("Could not resize given container for text data: Unrecognized type for text [{}]",
                                           type::sfinae::type_name<DataType>());
@@ -1540,7 +1656,10 @@ namespace h5pp::hdf5 {
             } else {
                 h5pp::util::resizeData(data, extent);
             }
-            if(bytes != h5pp::util::getBytesTotal(data)) {
+            // Numeric data may be converted while reading, so that only the number of elements has to match
+            bool converts = not std::is_void_v<typename decltype(type::convert::getNumericElement<DataType>())::type> and
+                            type::convert::getNumeric(type).has_value();
+            if(converts ? bytes / H5Tget_size(type) != util::getSize(data) : bytes != h5pp::util::getBytesTotal(data)) {
                 h5pp::logger::log->warn("Size mismatch after resizing container [{}]: data [{}] bytes | dset [{}] bytes ",
                                         h5pp::type::sfinae::type_name<DataType>(),
                                         h5pp::util::getBytesTotal(data),
@@ -1648,10 +1767,6 @@ namespace h5pp::hdf5 {
         }
     }
     namespace internal {
-        inline long        maxHits  = -1;
-        inline long        maxDepth = -1;
-        inline bool        symlinks = false;
-        inline std::string searchKey;
         template<H5O_type_t ObjType>
         /* clang-format off */
         [[nodiscard]] inline constexpr std::string_view getObjTypeName() {
@@ -1688,103 +1803,41 @@ namespace h5pp::hdf5 {
         }
         /* clang-format on */
 
-        template<H5O_type_t ObjType, typename InfoType>
-        inline herr_t matcher([[maybe_unused]] hid_t id, const char *name, [[maybe_unused]] const InfoType *info, void *opdata) {
-            // If object type is the one requested, and name matches the search key, then add it to the match list (a vector<string>)
-            // If the search depth is passed the depth specified, return immediately
-            // Return 0 to continue searching
-            // Return 1 to finish the search. Normally when we've reached max search hits.
-
-            // Skip symlinks if not asked for
-            if(not symlinks and (info->type == H5L_TYPE_SOFT or info->type == H5L_TYPE_EXTERNAL)) return 0;
-            std::string_view linkPath(name); // <-- This is the full path to the object that we are currently visiting.
-
-            // If this group is deeper than maxDepth, just return
-            auto depth = std::count(linkPath.begin(), linkPath.end(), '/');
-            if(maxDepth >= 0 and depth > maxDepth) return 0;
-
-            // Get the name of the object without the full path, to match the searchKey
-            auto slashpos = linkPath.rfind('/');
-            if(slashpos == std::string_view::npos) slashpos = 0;
-            std::string_view linkName = linkPath.substr(slashpos);
-
-            auto matchList = reinterpret_cast<std::vector<std::string> *>(opdata);
-            try {
-                if constexpr(std::is_same_v<InfoType, H5O_info_t>) {
-                    if(info->type == ObjType or ObjType == H5O_TYPE_UNKNOWN) {
-                        if(searchKey.empty() or linkName.find(searchKey) != std::string::npos) {
-                            if(depth >= 1 and not symlinks) { // H5Lget_info fails on the root "." or "/"
-                                // Make sure not to include symbolic links if not asked for
-                                H5L_info_t lInfo;
-                                herr_t     lerr = H5Lget_info(id, name, &lInfo, H5P_DEFAULT);
-                                if(lerr < 0) throw h5pp::runtime_error("H5Lget_info failed on link [{}]", name);
-                                if(lInfo.type == H5L_type_t::H5L_TYPE_SOFT or lInfo.type == H5L_TYPE_EXTERNAL) return 0;
-                            }
-                            matchList->push_back(name);
-                        }
-                    }
-                }
+    }
 
-                else if constexpr(std::is_same_v<InfoType, H5L_info_t>) {
-                    /* clang-format off */
-                    // It is expensive to use H5Oopen to peek H5O_info_t::type.
-                    // It is faster to populate H5O_info_t using
-                    H5O_info_t oInfo;
-#if defined(H5Oget_info_vers) && H5Oget_info_vers >= 2
-                        H5Oget_info_by_name(id, name, &oInfo, H5O_INFO_BASIC, H5P_DEFAULT);
-#else
-                        H5Oget_info_by_name(id,name, &oInfo,H5P_DEFAULT);
-#endif
-                    /* clang-format on */
-                    if(oInfo.type == ObjType or ObjType == H5O_TYPE_UNKNOWN) {
-                        if(searchKey.empty() or linkName.find(searchKey) != std::string::npos) {
-                            // Otherwise append the match
-                            matchList->push_back(name);
-                        }
-                    }
-                } else {
-                    if(searchKey.empty() or linkName.find(searchKey) != std::string::npos) matchList->push_back(name);
-                }
+    /*! Passes each link of type ObjType found under search.searchRoot to callback as a LinkView, and returns the number of matches.
+     *  The paths are relative to search.searchRoot. The visit stops early when the callback returns false. */
+    template<H5O_type_t ObjType, typename h5x>
+    inline size_t visitLinks(const h5x              &loc,
+                             const LinkSearch       &search,
+                             const LinkViewCallback &callback,
+                             const PropertyLists    &plists = PropertyLists::defaults()) {
+        static_assert(type::sfinae::is_hdf5_loc_id<h5x>,
+                      "Template function [h5pp::hdf5::visitLinks(const h5x & loc, ...)] requires type h5x to be: "
+                      "[h5pp::hid::h5f], [h5pp::hid::h5g], [h5pp::hid::h5o] or [hid_t]");
+        h5pp::logger::log->trace("search key: {} | pattern: {} | root: {} | type: {} | max hits {} | max depth {} | workers {}",
+                                 search.searchKey,
+                                 search.pattern.string(),
+                                 search.searchRoot,
+                                 internal::getObjTypeName<ObjType>(),
+                                 search.maxHits,
+                                 search.maxDepth,
+                                 search.numWorkers);
 
-                if(maxHits > 0 and type::safe_cast<long>(matchList->size()) >= maxHits) return 1;
-                else return 0;
-            } catch(const std::exception &ex) {
-                throw h5pp::logic_error("Could not match object [{}] | loc_id [{}] | reason: {}", name, id, ex.what());
-            }
-        }
-
-        template<H5O_type_t ObjType, typename h5x>
-        inline herr_t visit_by_name(const h5x                &loc,
-                                    std::string_view          root,
-                                    std::vector<std::string> &matchList,
-                                    const PropertyLists      &plists = PropertyLists()) {
-            static_assert(type::sfinae::is_hdf5_loc_id<h5x>,
-                          "Template function [h5pp::hdf5::visit_by_name(const h5x & loc, ...)] requires type h5x to be: "
-                          "[h5pp::hid::h5f], [h5pp::hid::h5g], [h5pp::hid::h5o] or [hid_t]");
-            auto safe_root = util::safe_str(root);
-
-            if constexpr(h5pp::type::sfinae::is_any_v<h5x, hid::h5f, hid::h5g>) {
-                if(internal::maxDepth == 0) {
-                    // Faster when we don't need to iterate recursively
-                    hsize_t idx = 0;
-                    auto    gid = openLink<hid::h5g>(loc, safe_root, std::nullopt, plists.groupAccess);
-                    return H5Literate(gid,
-                                      H5_index_t::H5_INDEX_NAME,
-                                      H5_iter_order_t::H5_ITER_NATIVE,
-                                      &idx,
-                                      internal::matcher<ObjType>,
-                                      &matchList);
-                }
-            }
-            return H5Lvisit_by_name(loc,
-                                    safe_root.c_str(),
-                                    H5_index_t::H5_INDEX_NAME,
-                                    H5_iter_order_t::H5_ITER_NATIVE,
-                                    internal::matcher<ObjType>,
-                                    &matchList,
-                                    plists.linkAccess);
-        }
+        if(not checkIfLinkExists(loc, search.searchRoot, plists.linkAccess))
+            throw h5pp::runtime_error("Cannot find links inside group [{}]: it does not exist", search.searchRoot);
+        return internal::searchLinks(loc, ObjType, search, callback, plists);
+    }
 
+    /*! Passes the path of each link of type ObjType found under search.searchRoot to callback, and returns the number of matches.
+     *  The paths are relative to search.searchRoot. The search stops early when the callback returns false. */
+    template<H5O_type_t ObjType, typename h5x>
+    inline size_t findLinks(const h5x           &loc,
+                            const LinkSearch    &search,
+                            const LinkCallback  &callback,
+                            const PropertyLists &plists = PropertyLists::defaults()) {
+        return visitLinks<ObjType>(
+            loc, search, [&callback](const LinkView &link) { return callback(link.path()); }, plists);
     }
 
     template<H5O_type_t ObjType, typename h5x>
@@ -1794,48 +1847,45 @@ namespace h5pp::hdf5 {
                                                             long                 maxHits        = -1,
                                                             long                 maxDepth       = -1,
                                                             bool                 followSymlinks = false,
-                                                            const PropertyLists &plists         = PropertyLists()) {
-        h5pp::logger::log->trace("search key: {} | root: {} | type: {} | max hits {} | max depth {}",
-                                 searchKey,
-                                 searchRoot,
-                                 internal::getObjTypeName<ObjType>(),
-                                 maxHits,
-                                 maxDepth);
-
-        if(not checkIfLinkExists(loc, searchRoot, plists.linkAccess))
-            throw h5pp::runtime_error("Cannot find links inside group [{}]: it does not exist", searchRoot);
-
+                                                            const PropertyLists &plists         = PropertyLists::defaults()) {
+        LinkSearch search;
+        search.searchKey      = searchKey;
+        search.searchRoot     = searchRoot;
+        search.maxHits        = maxHits;
+        search.maxDepth       = maxDepth;
+        search.followSymlinks = followSymlinks;
         std::vector<std::string> matchList;
-        internal::maxHits   = maxHits;
-        internal::maxDepth  = maxDepth;
-        internal::symlinks  = followSymlinks;
-        internal::searchKey = searchKey;
-        herr_t err          = internal::visit_by_name<ObjType>(loc, searchRoot, matchList, plists);
-        if(err < 0) {
-            throw h5pp::runtime_error(
-                "Error occurred when trying to find links of type [{}] containing [{}] while iterating from root [{}]",
-                internal::getObjTypeName<ObjType>(),
-                searchKey,
-                searchRoot);
-        }
-
+        visitLinks<ObjType>(
+            loc,
+            search,
+            [&matchList](const LinkView &link) {
+                matchList.emplace_back(link.path());
+                return true;
+            },
+            plists);
         return matchList;
     }
 
     template<H5O_type_t ObjType, typename h5x>
     [[nodiscard]] inline std::vector<std::string>
-        getContentsOfLink(const h5x &loc, std::string_view linkPath, long maxDepth = 1, const PropertyLists &plists = PropertyLists()) {
+        getContentsOfLink(const h5x &loc, std::string_view linkPath, long maxDepth = 1, const PropertyLists &plists = PropertyLists::defaults()) {
+        LinkSearch search;
+        search.searchRoot = linkPath;
+        search.maxDepth   = maxDepth;
         std::vector<std::string> contents;
-        internal::maxHits  = -1;
-        internal::maxDepth = maxDepth;
-        internal::searchKey.clear();
-        herr_t err = internal::visit_by_name<ObjType>(loc, linkPath, contents, plists);
-        if(err < 0) throw h5pp::runtime_error("Failed to iterate link [{}] of type [{}]", linkPath, internal::getObjTypeName<ObjType>());
-
+        internal::searchLinks(
+            loc,
+            ObjType,
+            search,
+            [&contents](const LinkView &link) {
+                contents.emplace_back(link.path());
+                return true;
+            },
+            plists);
         return contents;
     }
 
-    inline void createDataset(DsetInfo &dsetInfo, const PropertyLists &plists = PropertyLists()) {
+    inline void createDataset(DsetInfo &dsetInfo, const PropertyLists &plists = PropertyLists::defaults()) {
         // Here we create, the dataset id and set its properties before writing data to it.
         dsetInfo.assertCreateReady();
         if(dsetInfo.dsetExists and dsetInfo.dsetExists.value()) {
@@ -2083,9 +2133,9 @@ namespace h5pp::hdf5 {
             size_t     typeSize  = h5pp::hdf5::getBytesPerElem(datatype);
             size_t     chunkSize = h5pp::util::getSizeFromDimensions(chunkDims);
             hsize_t    chunkByte = chunkSize * typeSize;
-            hid_t      h5dset    = dataset.value();    // Repeated calls to .value() takes time because validity is always checked
-            hid_t      h5dcpl    = dsetCreate.value(); // Repeated calls to .value() takes time because validity is always checked
-            hid_t      h5dxpl    = dsetXfer.value();   // Repeated calls to .value() takes time because validity is always checked
+            hid_t      h5dset    = dataset.value();    // Check validity once here and use the raw identifiers below
+            hid_t      h5dcpl    = dsetCreate.value();
+            hid_t      h5dxpl    = dsetXfer.value();
             auto       filters   = getFilters(h5dcpl);
             auto       deflate   = getDeflateLevel(h5dcpl);
             const auto rank      = dims.size();
@@ -2202,32 +2252,344 @@ namespace h5pp::hdf5 {
         }
     }
 
+    namespace internal {
+        /*! Tags DataType, or its value_type, if it is a struct registered with H5PP_REGISTER_COMPOUND. Tags void otherwise */
+        template<typename DataType>
+        constexpr auto getRegisteredElement() {
+            if constexpr(type::compound::is_registered_v<DataType>) return type::compound::Tag<DataType>();
+            else if constexpr(type::sfinae::has_value_type_v<DataType>) {
+                if constexpr(type::compound::is_registered_v<typename DataType::value_type>)
+                    return type::compound::Tag<typename DataType::value_type>();
+                else return type::compound::Tag<void>();
+            } else return type::compound::Tag<void>();
+        }
+
+        /*! Returns the memory type of table records held in DataType: the registered type of a registered struct, or else the
+         *  record type on file, in which case DataType must have the same layout.
+         */
+        template<typename DataType>
+        [[nodiscard]] hid_t getTableMemType(const TableInfo &info) {
+            using RegisteredType = typename decltype(getRegisteredElement<DataType>())::type;
+            if constexpr(std::is_void_v<RegisteredType>) return info.h5Type->unchecked();
+            else return type::getH5Type<RegisteredType>().unchecked();
+        }
+
+        /*! Returns the size in bytes of the type-conversion buffer for a transfer of transferBytes bytes, following policy */
+        [[nodiscard]] inline size_t getXferBufferSize(const XferBufferPolicy &policy, const hid::h5p &dsetXfer, size_t transferBytes) {
+            if(policy.autoSize) return std::clamp<size_t>(transferBytes, constants::minXferBuffer, std::max<size_t>(policy.maxSize, constants::minXferBuffer));
+            if(policy.size > 0) return policy.size;
+            return H5Pget_buffer(dsetXfer, nullptr, nullptr);
+        }
+
+        /*! Returns the dataset transfer property list for a transfer of numElems elements between memType and fileType.
+         *  This is plists.dsetXfer, unless HDF5 has to convert between the types and the policy asks for other buffers than it has.
+         *  In that case the buffers are taken from plists.xferBuffers, and stay locked until the returned lease is destroyed.
+         */
+        [[nodiscard]] inline XferBuffers::Lease getXferPlist(const PropertyLists                  &plists,
+                                                             const std::optional<XferBufferPolicy> &policyOverride,
+                                                             hid_t                                   memType,
+                                                             hid_t                                   fileType,
+                                                             hsize_t                                 numElems) {
+            const auto &policy = policyOverride ? policyOverride.value() : plists.xferBufferPolicy;
+            if((not policy.autoSize and policy.size == 0) or not plists.xferBuffers) return {plists.dsetXfer.unchecked(), {}};
+            if(memType == fileType or H5Tequal(memType, fileType) > 0) return {plists.dsetXfer.unchecked(), {}};
+            size_t typeSize = std::max(H5Tget_size(memType), H5Tget_size(fileType));
+            size_t size     = std::max(getXferBufferSize(policy, plists.dsetXfer, numElems * typeSize), typeSize);
+            if(policy.autoSize and size <= H5Pget_buffer(plists.dsetXfer, nullptr, nullptr)) return {plists.dsetXfer.unchecked(), {}};
+            bool background = H5Tget_class(memType) == H5T_COMPOUND or H5Tget_class(fileType) == H5T_COMPOUND;
+            h5pp::logger::log->trace("Using a {} byte type-conversion buffer for {} elements", size, numElems);
+            return plists.xferBuffers->lease(plists.dsetXfer, size, background);
+        }
+
+        enum class Conversion {
+            none, /*!< The dataset has the same type as the data in memory, or a type that h5pp does not recognize as numeric */
+            h5pp, /*!< h5pp converts between the numeric types, in blocks (see h5ppTypeConvert.h) */
+            hdf5, /*!< HDF5 converts between the numeric types */
+        };
+
+        /*! Decides who converts between the numeric element type of DataType and the dataset type, if they differ */
+        template<typename DataType>
+        [[nodiscard]] Conversion getConversion(const DataInfo &dataInfo, const DsetInfo &dsetInfo) {
+            using ElemType = typename decltype(type::convert::getNumericElement<DataType>())::type;
+            if constexpr(std::is_void_v<ElemType>) {
+                return Conversion::none;
+            } else {
+                const auto &dsetType = dsetInfo.h5Type.value();
+                if(H5Tequal(dsetType, type::getH5Type<ElemType>()) > 0) return Conversion::none;
+                auto dsetNumeric = type::convert::getNumeric(dsetType);
+                if(not dsetNumeric) return Conversion::none;
+                constexpr auto dataNumeric = type::convert::getNumeric<ElemType>().value();
+                // Blocks are taken along the first dimension of the whole dataset, so selections are left to HDF5
+                if(not dsetInfo.dsetSlab and not dataInfo.dataSlab and type::convert::isSupported(dsetNumeric.value(), dataNumeric))
+                    return Conversion::h5pp;
+                return Conversion::hdf5;
+            }
+        }
+
+        /*! Calls func(memSpace, dsetSpace, offset, size) for consecutive blocks of the dataset along its first dimension.
+         *  The blocks fit the type-conversion buffer size given by XferBufferPolicy (1 MB by default), and are a multiple of the
+         *  chunk dimension when the dataset is chunked. The memory space selects size elements, starting at element offset.
+         */
+        template<typename Func>
+        void forEachBlock(const DsetInfo &dsetInfo, const PropertyLists &plists, size_t bytesPerElem, Func &&func) {
+            const auto &dims = dsetInfo.dsetDims.value();
+            if(dims.empty()) {
+                hid::h5s memSpace = H5Screate(H5S_SCALAR);
+                func(memSpace, dsetInfo.h5Space.value(), 0, 1);
+                return;
+            }
+            hsize_t rowSize = std::accumulate(dims.begin() + 1, dims.end(), hsize_t(1), std::multiplies<>());
+            if(dims.front() == 0 or rowSize == 0) return;
+            const auto &policy     = dsetInfo.xferBufferPolicy ? dsetInfo.xferBufferPolicy.value() : plists.xferBufferPolicy;
+            size_t      bufferSize = getXferBufferSize(policy, plists.dsetXfer, dims.front() * rowSize * bytesPerElem);
+            bufferSize             = std::max<size_t>(bufferSize, bytesPerElem);
+            hsize_t blockRows  = std::max<hsize_t>(1, bufferSize / (rowSize * bytesPerElem));
+            if(dsetInfo.dsetChunk and not dsetInfo.dsetChunk->empty()) {
+                auto chunkRows = dsetInfo.dsetChunk->front();
+                blockRows      = std::max(chunkRows, blockRows / chunkRows * chunkRows);
+            }
+            blockRows = std::min(blockRows, dims.front());
+
+            hid::h5s             dsetSpace = H5Scopy(dsetInfo.h5Space.value());
+            std::vector<hsize_t> offset(dims.size(), 0);
+            std::vector<hsize_t> extent = dims;
+            for(hsize_t row = 0; row < dims.front(); row += blockRows) {
+                offset.front() = row;
+                extent.front() = std::min(blockRows, dims.front() - row);
+                if(H5Sselect_hyperslab(dsetSpace, H5S_SELECT_SET, offset.data(), nullptr, extent.data(), nullptr) < 0)
+                    throw h5pp::runtime_error("Failed to select block at row {} in dataset [{}]", row, dsetInfo.dsetPath.value());
+                hsize_t  size     = extent.front() * rowSize;
+                hid::h5s memSpace = H5Screate_simple(1, &size, nullptr);
+                func(memSpace, dsetSpace, row * rowSize, size);
+            }
+        }
+
+        /*! Writes data of type DataType into a dataset of a different numeric type, converting one block at a time */
+        template<typename DataType>
+        void writeDatasetConverted(const DataType &data, const DsetInfo &dsetInfo, const PropertyLists &plists) {
+            using ElemType = typename decltype(type::convert::getNumericElement<DataType>())::type;
+            const auto *dataPtr = static_cast<const ElemType *>(h5pp::util::getVoidPointer<const void *>(data));
+            type::convert::visit(type::convert::getNumeric(dsetInfo.h5Type.value()).value(), [&](auto tag) {
+                using DsetType = typename decltype(tag)::type;
+                if constexpr(type::convert::is_supported_v<ElemType, DsetType>) {
+                    h5pp::logger::log->debug("Converting [{}] to [{}] while writing dataset [{}]",
+                                             type::sfinae::type_name<ElemType>(),
+                                             type::sfinae::type_name<DsetType>(),
+                                             dsetInfo.dsetPath.value());
+                    const auto           &dsetType = type::getH5Type<DsetType>();
+                    std::vector<DsetType> buffer;
+                    forEachBlock(dsetInfo, plists, sizeof(DsetType), [&](const hid::h5s &memSpace, const hid::h5s &dsetSpace, hsize_t offset, hsize_t size) {
+                        buffer.resize(size);
+                        type::convert::convert(dataPtr + offset, buffer.data(), size);
+                        if(H5Dwrite(dsetInfo.h5Dset->unchecked(), dsetType, memSpace, dsetSpace, plists.dsetXfer, buffer.data()) < 0)
+                            throw h5pp::runtime_error("Failed to write converted block at element {} into dataset [{}]", offset, dsetInfo.dsetPath.value());
+                    });
+                }
+            });
+        }
+
+        /*! Reads a dataset of a different numeric type into data of type DataType, converting one block at a time */
+        template<typename DataType>
+        void readDatasetConverted(DataType &data, const DsetInfo &dsetInfo, const PropertyLists &plists) {
+            using ElemType = typename decltype(type::convert::getNumericElement<DataType>())::type;
+            auto *dataPtr  = static_cast<ElemType *>(h5pp::util::getVoidPointer<void *>(data));
+            type::convert::visit(type::convert::getNumeric(dsetInfo.h5Type.value()).value(), [&](auto tag) {
+                using DsetType = typename decltype(tag)::type;
+                if constexpr(type::convert::is_supported_v<DsetType, ElemType>) {
+                    h5pp::logger::log->debug("Converting [{}] to [{}] while reading dataset [{}]",
+                                             type::sfinae::type_name<DsetType>(),
+                                             type::sfinae::type_name<ElemType>(),
+                                             dsetInfo.dsetPath.value());
+                    const auto           &dsetType = type::getH5Type<DsetType>();
+                    std::vector<DsetType> buffer;
+                    forEachBlock(dsetInfo, plists, sizeof(DsetType), [&](const hid::h5s &memSpace, const hid::h5s &dsetSpace, hsize_t offset, hsize_t size) {
+                        buffer.resize(size);
+                        if(H5Dread(dsetInfo.h5Dset->unchecked(), dsetType, memSpace, dsetSpace, plists.dsetXfer, buffer.data()) < 0)
+                            throw h5pp::runtime_error("Failed to read block at element {} from dataset [{}]", offset, dsetInfo.dsetPath.value());
+                        type::convert::convert(buffer.data(), dataPtr + offset, size);
+                    });
+                }
+            });
+        }
+
+        /*! True if the hyperslab selects a block with unit stride and unit blocks */
+        [[nodiscard]] inline bool isBlock(const Hyperslab &slab) {
+            auto isOnes = [](const OptDimsType &dims) {
+                return not dims or std::all_of(dims->begin(), dims->end(), [](hsize_t d) { return d == 1; });
+            };
+            return isOnes(slab.stride) and isOnes(slab.blocks);
+        }
+
+        /*! Reads the block at offset with dimensions extent of a dataset into buf, a column-major buffer of the same dimensions.
+         *
+         * HDF5 transfers elements in row-major order. A column-major buffer is a row-major buffer with reversed dimensions,
+         * so a line of the block along one axis maps onto a line of the buffer. The block is read one line at a time along its
+         * longest axis, directly into buf: there is no temporary and no shuffle afterwards.
+         */
+        inline void readColMajorLines(void                       *buf,
+                                      hid_t                       memType,
+                                      const DsetInfo             &dsetInfo,
+                                      const std::vector<hsize_t> &offset,
+                                      const std::vector<hsize_t> &extent,
+                                      const PropertyLists        &plists) {
+            auto rank  = extent.size();
+            auto total = util::getSizeFromDimensions(extent);
+            if(total == 0) return;
+            auto                 axis = type::safe_cast<size_t>(std::distance(extent.begin(), std::max_element(extent.begin(), extent.end())));
+            std::vector<hsize_t> memDims(extent.rbegin(), extent.rend());
+            hid::h5s             memSpace  = H5Screate_simple(type::safe_cast<int>(rank), memDims.data(), nullptr);
+            hid::h5s             dsetSpace = H5Scopy(dsetInfo.h5Space.value());
+            std::vector<hsize_t> index(rank, 0), dsetOffset(rank, 0), dsetCount(rank, 1), memOffset(rank, 0), memCount(rank, 1);
+            dsetCount[axis]           = extent[axis];
+            memCount[rank - 1 - axis] = extent[axis];
+            h5pp::logger::log->debug("Reading [{}] into a column-major buffer in {} lines of {} elements",
+                                     dsetInfo.dsetPath.value(),
+                                     total / extent[axis],
+                                     extent[axis]);
+            auto xfer = getXferPlist(plists, dsetInfo.xferBufferPolicy, memType, dsetInfo.h5Type->unchecked(), extent[axis]);
+            for(hsize_t line = 0; line < total / extent[axis]; line++) {
+                for(size_t d = 0; d < rank; d++) {
+                    dsetOffset[d]           = offset[d] + index[d];
+                    memOffset[rank - 1 - d] = index[d];
+                }
+                if(H5Sselect_hyperslab(dsetSpace, H5S_SELECT_SET, dsetOffset.data(), nullptr, dsetCount.data(), nullptr) < 0 or
+                   H5Sselect_hyperslab(memSpace, H5S_SELECT_SET, memOffset.data(), nullptr, memCount.data(), nullptr) < 0)
+                    throw h5pp::runtime_error("Failed to select line {} of dataset [{}]", line, dsetInfo.dsetPath.value());
+                if(H5Dread(dsetInfo.h5Dset->unchecked(), memType, memSpace, dsetSpace, xfer.plist, buf) < 0)
+                    throw h5pp::runtime_error("Failed to read line {} of dataset [{}]", line, dsetInfo.dsetPath.value());
+                // Advance the index over all axes but the line axis, last axis fastest
+                for(size_t d = rank; d-- > 0;) {
+                    if(d == axis) continue;
+                    if(++index[d] < extent[d]) break;
+                    index[d] = 0;
+                }
+            }
+        }
+    }
+
+    namespace internal {
+        /*! True for containers whose elements are whole strings, such as std::vector<std::string>, but not std::vector<char> */
+        template<typename DataType>
+        constexpr bool has_string_elements() {
+            if constexpr(type::sfinae::has_text_v<DataType> and type::sfinae::is_iterable_v<DataType>) {
+                using ElemType = std::decay_t<decltype(*std::begin(std::declval<const DataType &>()))>;
+                return std::is_constructible_v<std::string_view, const ElemType &> and not std::is_same_v<ElemType, char>;
+            }
+            return false;
+        }
+        template<typename DataType>
+        inline constexpr bool has_string_elements_v = has_string_elements<DataType>();
+
+        /*!
+         * Joins count strings into text, one per line. getString(i) returns the i'th string as a std::string_view.
+         * The total length is counted first, so that text is sized once and each string is copied straight into place.
+         */
+        template<typename TextType, typename GetString>
+        void joinLines(TextType &text, size_t count, GetString &&getString) {
+            size_t length = count > 0 ? count - 1 : 0; // The new-lines
+            for(size_t i = 0; i < count; ++i) length += getString(i).size();
+            text.resize(length);
+            char *pos = text.data();
+            for(size_t i = 0; i < count; ++i) {
+                std::string_view str = getString(i);
+                if(not str.empty()) std::memcpy(pos, str.data(), str.size());
+                pos += str.size();
+                if(i + 1 < count) *pos++ = '\n';
+            }
+            *pos = '\0'; // h5pp::vstr_t does not terminate on resize
+        }
+
+        /*! Length of the fixed-length string at str, up to its null terminator or all of bytesPerString */
+        [[nodiscard]] inline size_t getFixedLength(const char *str, size_t bytesPerString) {
+            const auto *end = static_cast<const char *>(std::memchr(str, '\0', bytesPerString));
+            return end == nullptr ? bytesPerString : static_cast<size_t>(end - str);
+        }
+
+        /*!
+         * True if compactLines can join count fixed-length strings in text in place. That fails only if strings fill all
+         * their bytes, so that a new-line would overwrite the next string before it is moved.
+         */
+        [[nodiscard]] inline bool canCompactLines(const char *text, size_t count, size_t bytesPerString) {
+            // Usually every string ends with a null character, and the lengths need not be counted
+            bool anyFull = false;
+            for(size_t i = 0; i + 1 < count and not anyFull; ++i) anyFull = text[i * bytesPerString + bytesPerString - 1] != '\0';
+            if(not anyFull) return true;
+            size_t slack = 0; // Bytes freed by the strings so far
+            for(size_t i = 0; i + 1 < count; ++i) {
+                size_t len = getFixedLength(text + i * bytesPerString, bytesPerString);
+                if(len == bytesPerString and slack == 0) return false;
+                slack += bytesPerString - len - 1; // Room left after the string and its new-line
+            }
+            return true;
+        }
+
+        /*!
+         * Turns count fixed-length strings of bytesPerString bytes, back to back in text, into one string per line, in
+         * place. Returns the length of the result. Check canCompactLines first.
+         */
+        [[nodiscard]] inline size_t compactLines(char *text, size_t count, size_t bytesPerString) {
+            char *pos = text;
+            for(size_t i = 0; i < count; ++i) {
+                const char *str = text + i * bytesPerString;
+                size_t      len = getFixedLength(str, bytesPerString);
+                if(pos != str) std::memmove(pos, str, len);
+                pos += len;
+                if(i + 1 < count) *pos++ = '\n';
+            }
+            return static_cast<size_t>(pos - text);
+        }
+
+        /*! The i'th of the fixed-length strings in fdata, up to its null terminator */
+        [[nodiscard]] inline std::string_view getFixedString(const std::string &fdata, size_t bytesPerString, size_t i) {
+            const char *str = fdata.data() + i * bytesPerString;
+            return {str, getFixedLength(str, bytesPerString)};
+        }
+
+        /*! Memory type that reads strings of type fileType into fstr_t<N>: N bytes, null-terminated, in the character set of fileType */
+        template<typename DataType>
+        [[nodiscard]] hid::h5t getFstrMemType(const hid::h5t &fileType) {
+            static_assert(type::sfinae::has_fstr_v<DataType>);
+            hid::h5t memType = H5Tcopy(fileType);
+            if(H5Tset_size(memType, sizeof(typename DataType::value_type)) < 0 or H5Tset_strpad(memType, H5T_STR_NULLTERM) < 0)
+                throw h5pp::runtime_error("Failed to set the memory type for [{}]", type::sfinae::type_name<DataType>());
+            return memType;
+        }
+    }
+
     template<typename DataType>
     const void *
         getTextPtrForH5Dwrite(const DataType &data, const hid::h5t &h5Type, std::string &tempBuf, std::vector<const char *> &vlenBuf) {
         static_assert(not type::sfinae::is_h5pp_id<DataType>);
         auto dataPtr = h5pp::util::getVoidPointer<const void *>(data);
         if constexpr(type::sfinae::is_text_v<DataType> or type::sfinae::has_text_v<DataType>) {
+            bool isVarStr = H5Tis_variable_str(h5Type) > 0;
+            if constexpr(type::sfinae::has_fstr_v<DataType> and type::sfinae::has_data_v<DataType>) {
+                // A contiguous container of fstr_t<N> already has the layout of a fixed-size string array of size N
+                if(not isVarStr and H5Tget_size(h5Type) == sizeof(typename DataType::value_type)) return static_cast<const void *>(data.data());
+            }
+            if constexpr(internal::has_string_elements_v<DataType>) {
+                if(not isVarStr and util::getSize(data) != 1) {
+                    // We have a fixed-size string array now. We have to copy the strings to a contiguous array.
+                    // bytesPerStr is the size of each string including the null terminator
+                    size_t bytesPerStr = H5Tget_size(h5Type); // This is the fixed-size of a string, not a char! Includes null term
+                    size_t maxChars    = H5Tget_strpad(h5Type) == H5T_STR_NULLTERM ? bytesPerStr - 1 : bytesPerStr; // Others need no null
+                    tempBuf.assign(bytesPerStr * util::getSize(data), '\0');
+                    auto offset = tempBuf.data();
+                    for(const auto &elem : data) {
+                        // A view of the string, not including the null character
+                        auto view = std::string_view(elem);
+                        std::copy_n(view.data(), std::min(view.size(), maxChars), offset); // Do not copy null character
+                        offset += bytesPerStr;
+                    }
+                    return static_cast<const void *>(tempBuf.data());
+                }
+            }
             vlenBuf = getCharPtrVector(data);
-
-            if(H5Tis_variable_str(h5Type) > 0) {
+            if(isVarStr) {
                 // When H5T_VARIABLE, H5Dwrite function expects [const char **], which is what we get from vlenBuf.data()
                 dataPtr = reinterpret_cast<const void **>(vlenBuf.data());
             } else if(vlenBuf.size() == 1) {
                 dataPtr = static_cast<const void *>(*vlenBuf.data());
-            } else if constexpr(type::sfinae::has_text_v<DataType> and type::sfinae::is_iterable_v<DataType>) {
-                // We have a fixed-size string array now. We have to copy the strings to a contiguous array.
-                // vlenBuf already contains the pointer to each string, and bytesPerStr should be the size of each string
-                // including null terminators
-                size_t bytesPerStr = H5Tget_size(h5Type); // This is the fixed-size of a string, not a char! Includes null term
-                tempBuf.resize(bytesPerStr * vlenBuf.size());
-                for(size_t i = 0; i < vlenBuf.size(); i++) {
-                    auto offset = tempBuf.data() + type::safe_cast<long>(i * bytesPerStr);
-                    // Construct a view of the null-terminated character string, not including the null character.
-                    auto view   = std::string_view(vlenBuf[i]); // view.size() will not include null term here!
-                    std::copy_n(std::begin(view), std::min(view.size(), bytesPerStr - 1), offset); // Do not copy null character
-                }
-                dataPtr = static_cast<const void *>(tempBuf.data());
             }
         }
         return dataPtr;
@@ -2237,7 +2599,7 @@ namespace h5pp::hdf5 {
     void writeDataset(const DataType      &data,
                       const DataInfo      &dataInfo,
                       const DsetInfo      &dsetInfo,
-                      const PropertyLists &plists = PropertyLists()) {
+                      const PropertyLists &plists = PropertyLists::defaults()) {
         static_assert(not type::sfinae::is_h5pp_id<DataType>);
 #ifdef H5PP_USE_EIGEN3
         if constexpr(type::sfinae::is_eigen_colmajor_v<DataType> and not type::sfinae::is_eigen_1d_v<DataType>) {
@@ -2247,6 +2609,7 @@ namespace h5pp::hdf5 {
             return;
         }
 #endif
+        auto conversion = internal::Conversion::none;
         try {
             dsetInfo.assertWriteReady();
             dataInfo.assertWriteReady();
@@ -2255,11 +2618,15 @@ namespace h5pp::hdf5 {
             if(dsetInfo.dsetSlab) selectHyperslab(dsetInfo.h5Space.value(), dsetInfo.dsetSlab.value());
             if(dataInfo.dataSlab) selectHyperslab(dataInfo.h5Space.value(), dataInfo.dataSlab.value());
             h5pp::hdf5::assertWriteBufferIsLargeEnough(data, dataInfo.h5Space.value(), dsetInfo.h5Type.value());
-            h5pp::hdf5::assertBytesPerElemMatch<DataType>(dsetInfo.h5Type.value());
+            conversion = internal::getConversion<DataType>(dataInfo, dsetInfo);
+            if(conversion == internal::Conversion::none) h5pp::hdf5::assertBytesPerElemMatch<DataType>(dsetInfo.h5Type.value());
             h5pp::hdf5::assertSpacesEqual<DataType>(dataInfo.h5Space.value(), dsetInfo.h5Space.value(), dsetInfo.h5Type.value());
         } catch(const std::exception &ex) {
             throw h5pp::runtime_error("Error writing to dataset [{}]:\n{}", dsetInfo.dsetPath.value(), ex.what());
         }
+        if constexpr(not std::is_void_v<typename decltype(type::convert::getNumericElement<DataType>())::type>) {
+            if(conversion == internal::Conversion::h5pp) return internal::writeDatasetConverted(data, dsetInfo, plists);
+        }
 
         // Get the memory address to the data buffer
         [[maybe_unused]] auto                      dataPtr = h5pp::util::getVoidPointer<const void *>(data);
@@ -2279,11 +2646,22 @@ namespace h5pp::hdf5 {
 
         // Write to file
 
-        herr_t retval = H5Dwrite(dsetInfo.h5Dset.value(),
-                                 dsetInfo.h5Type.value(),
-                                 dataInfo.h5Space.value(),
-                                 dsetInfo.h5Space.value(),
-                                 plists.dsetXfer,
+        // Let HDF5 convert numeric data that h5pp does not convert itself
+        hid_t  memType = dsetInfo.h5Type->unchecked();
+        if constexpr(not std::is_void_v<typename decltype(type::convert::getNumericElement<DataType>())::type>) {
+            using ElemType = typename decltype(type::convert::getNumericElement<DataType>())::type;
+            if(conversion == internal::Conversion::hdf5) memType = type::getH5Type<ElemType>().unchecked();
+        }
+        auto   xfer   = internal::getXferPlist(plists,
+                                           dsetInfo.xferBufferPolicy,
+                                           memType,
+                                           dsetInfo.h5Type->unchecked(),
+                                           type::safe_cast<hsize_t>(H5Sget_select_npoints(dataInfo.h5Space->unchecked())));
+        herr_t retval = H5Dwrite(dsetInfo.h5Dset->unchecked(),
+                                 memType,
+                                 dataInfo.h5Space->unchecked(),
+                                 dsetInfo.h5Space->unchecked(),
+                                 xfer.plist,
                                  dataPtr);
         if(retval < 0)
             throw h5pp::runtime_error("Failed to write into dataset \n\t {} \n from memory \n\t {}", dsetInfo.string(), dataInfo.string());
@@ -2293,7 +2671,7 @@ namespace h5pp::hdf5 {
     void writeDataset_chunkwise([[maybe_unused]] const DataType            &data,
                                 [[maybe_unused]] DataInfo                  &dataInfo,
                                 [[maybe_unused]] DsetInfo                  &dsetInfo,
-                                [[maybe_unused]] const h5pp::PropertyLists &plists = PropertyLists()) {
+                                [[maybe_unused]] const h5pp::PropertyLists &plists = PropertyLists::defaults()) {
         if constexpr(type::sfinae::is_text_v<DataType> or type::sfinae::has_text_v<DataType>) {
             h5pp::logger::log->warn("writeDataset_chunkwise: text data is not supported, defaulting to normal writeDataset");
             writeDataset(data, dataInfo, dsetInfo, plists);
@@ -2360,12 +2738,33 @@ namespace h5pp::hdf5 {
     }
 
     template<typename DataType>
-    void readDataset(DataType &data, const DataInfo &dataInfo, const DsetInfo &dsetInfo, const PropertyLists &plists = PropertyLists()) {
+    void readDataset(DataType &data, const DataInfo &dataInfo, const DsetInfo &dsetInfo, const PropertyLists &plists = PropertyLists::defaults()) {
         static_assert(not std::is_const_v<DataType>);
         static_assert(not type::sfinae::is_h5pp_id<DataType>);
         // Transpose the data container before reading
 #ifdef H5PP_USE_EIGEN3
         if constexpr(type::sfinae::is_eigen_colmajor_v<DataType> and not type::sfinae::is_eigen_1d_v<DataType>) {
+            if constexpr(type::sfinae::is_eigen_map_v<DataType> or type::sfinae::is_eigen_tensormap_v<DataType>) {
+                // A map views a buffer owned by the caller, which is read into directly instead of through a row-major temporary
+                dsetInfo.assertReadReady();
+                if(not dataInfo.dataSlab and (not dsetInfo.dsetSlab or internal::isBlock(dsetInfo.dsetSlab.value()))) {
+                    auto extent = dsetInfo.dsetDims.value();
+                    auto offset = std::vector<hsize_t>(extent.size(), 0);
+                    if(dsetInfo.dsetSlab and dsetInfo.dsetSlab->extent) extent = dsetInfo.dsetSlab->extent.value();
+                    if(dsetInfo.dsetSlab and dsetInfo.dsetSlab->offset) offset = dsetInfo.dsetSlab->offset.value();
+                    if(util::getSizeFromDimensions(extent) != util::getSize(data) or extent.size() != offset.size())
+                        throw h5pp::runtime_error("Error reading dataset [{}]: Cannot read {} elements into map of size {}",
+                                                  dsetInfo.dsetPath.value(),
+                                                  util::getSizeFromDimensions(extent),
+                                                  util::getSize(data));
+                    return internal::readColMajorLines(util::getVoidPointer<void *>(data),
+                                                       type::getH5Type<DataType>().unchecked(),
+                                                       dsetInfo,
+                                                       offset,
+                                                       extent,
+                                                       plists);
+                }
+            }
             h5pp::logger::log->debug("Converting data to row-major storage order");
             auto tempRowMajor = eigen::to_RowMajor(data); // Convert to Row Major first;
             h5pp::hdf5::readDataset(tempRowMajor, dataInfo, dsetInfo, plists);
@@ -2373,6 +2772,7 @@ namespace h5pp::hdf5 {
             return;
         }
 #endif
+        auto conversion = internal::Conversion::none;
         try {
             dsetInfo.assertReadReady();
             dataInfo.assertReadReady();
@@ -2380,7 +2780,8 @@ namespace h5pp::hdf5 {
             h5pp::logger::log->trace("Reading from dataset {}", dsetInfo.string(h5pp::logger::logIf(LogLevel::trace)));
             if(dsetInfo.dsetSlab) selectHyperslab(dsetInfo.h5Space.value(), dsetInfo.dsetSlab.value());
             if(dataInfo.dataSlab) selectHyperslab(dataInfo.h5Space.value(), dataInfo.dataSlab.value());
-            h5pp::hdf5::assertReadTypeIsLargeEnough<DataType>(dsetInfo.h5Type.value());
+            conversion = internal::getConversion<DataType>(dataInfo, dsetInfo);
+            if(conversion == internal::Conversion::none) h5pp::hdf5::assertReadTypeIsLargeEnough<DataType>(dsetInfo.h5Type.value());
             h5pp::hdf5::assertReadSpaceIsLargeEnough(data, dataInfo.h5Space.value(), dsetInfo.h5Type.value());
             h5pp::hdf5::assertSpacesEqual<DataType>(dataInfo.h5Space.value(), dsetInfo.h5Space.value(), dsetInfo.h5Type.value());
         } catch(const std::exception &ex) {
@@ -2406,29 +2807,81 @@ namespace h5pp::hdf5 {
                 if(size < 0) throw h5pp::runtime_error("H5S_select_npoints: failed on dataset [{}]", dsetInfo.dsetPath.value());
                 std::vector<h5pp::vstr_t> vdata(type::safe_cast<size_t>(size));
                 // HDF5 allocates space for each string in vdata
-                retval = H5Dread(dsetInfo.h5Dset.value(),
-                                 dsetInfo.h5Type.value(),
+                retval = H5Dread(dsetInfo.h5Dset->unchecked(),
+                                 dsetInfo.h5Type->unchecked(),
                                  H5S_ALL,
-                                 dsetInfo.h5Space.value(),
+                                 dsetInfo.h5Space->unchecked(),
                                  plists.dsetXfer,
                                  vdata.data());
                 // Now vdata contains the whole dataset, and we need to put the data into the user-given container.
                 if constexpr(std::is_same_v<DataType, std::string> or type::sfinae::is_vstr_v<DataType>) {
                     // A vector of strings (vdata) can be put into a single string (data) with entries separated by new-lines
-                    data.clear();
-                    for(size_t i = 0; i < vdata.size(); i++) {
-                        if(!vdata.empty() and vdata[i].data() != nullptr) data.append(vdata[i].c_str());
-                        if(i < vdata.size() - 1) data.append("\n");
-                    }
+                    internal::joinLines(data, vdata.size(), [&vdata](size_t i) {
+                        return vdata[i].data() == nullptr ? std::string_view() : std::string_view(vdata[i].c_str());
+                    });
                 } else if constexpr(type::sfinae::has_resize_v<DataType> and (type::sfinae::is_container_of_v<DataType, h5pp::vstr_t> or
                                                                               type::sfinae::is_container_of_v<DataType, std::string>)) {
                     data.clear();
                     data.resize(vdata.size());
                     for(size_t i = 0; i < data.size(); i++) data[i] = vdata[i];
+                } else if constexpr(type::sfinae::has_resize_v<DataType> and type::sfinae::has_fstr_v<DataType>) {
+                    data.resize(vdata.size());
+                    for(size_t i = 0; i < data.size(); i++) {
+                        if(vdata[i].data() == nullptr) data[i].clear();
+                        else data[i] = vdata[i].c_str(); // Truncated to fit fstr_t<N>
+                    }
                 } else {
                     static_assert(type::sfinae::unrecognized_type_v<DataType> and
                                   "To read text-data, please use h5pp::vstr_t, std::string or a container of them such as std::vector");
                 }
+            } else if constexpr(type::sfinae::has_fstr_v<DataType> and type::sfinae::has_data_v<DataType>) {
+                // The fstr_t<N> elements are contiguous, so the dataset is read straight into them. If the strings in the
+                // dataset have another size than N, HDF5 truncates or pads them on the way.
+                auto size = H5Sget_select_npoints(dsetInfo.h5Space.value());
+                if(util::getSize(data) < type::safe_cast<size_t>(size)) {
+                    throw h5pp::runtime_error("Given container of strings is too small: dset size {} | container size {}",
+                                              size,
+                                              util::getSize(data));
+                }
+                hid::h5t memType = internal::getFstrMemType<DataType>(dsetInfo.h5Type.value());
+                auto     xfer    = internal::getXferPlist(plists,
+                                                   dsetInfo.xferBufferPolicy,
+                                                   memType.unchecked(),
+                                                   dsetInfo.h5Type->unchecked(),
+                                                   type::safe_cast<hsize_t>(size));
+                retval           = H5Dread(dsetInfo.h5Dset->unchecked(),
+                                 memType.unchecked(),
+                                 dataInfo.h5Space->unchecked(),
+                                 dsetInfo.h5Space->unchecked(),
+                                 xfer.plist,
+                                 data.data());
+                if(retval < 0)
+                    throw h5pp::runtime_error("Failed to read from dataset \n\t {} \n into memory \n\t {}", dsetInfo.string(), dataInfo.string());
+            } else if constexpr(std::is_same_v<DataType, std::string> or type::sfinae::is_vstr_v<DataType>) {
+                // All the elements in the dataset have the same string size. They are read into data itself, which is then
+                // compacted in place into one string per line.
+                size_t   bytesPerString = H5Tget_size(dsetInfo.h5Type.value()); // Includes null terminator
+                auto     size           = type::safe_cast<hsize_t>(H5Sget_select_npoints(dsetInfo.h5Space.value()));
+                auto     count          = type::safe_cast<size_t>(size);
+                hid::h5s memSpace       = H5Screate_simple(1, &size, nullptr);
+                data.resize(count * bytesPerString);
+                retval = H5Dread(dsetInfo.h5Dset->unchecked(),
+                                 dsetInfo.h5Type->unchecked(),
+                                 memSpace,
+                                 dsetInfo.h5Space->unchecked(),
+                                 plists.dsetXfer,
+                                 data.data());
+                if(retval < 0)
+                    throw h5pp::runtime_error("Failed to read from dataset \n\t {} \n into memory \n\t {}", dsetInfo.string(), dataInfo.string());
+                if(internal::canCompactLines(data.data(), count, bytesPerString)) {
+                    auto length = internal::compactLines(data.data(), count, bytesPerString);
+                    data.resize(length);
+                    data.data()[length] = '\0'; // h5pp::vstr_t does not terminate on resize
+                } else {
+                    // Some strings fill all their bytes, and there is no room for the new-lines
+                    std::string fdata(data.data(), count * bytesPerString);
+                    internal::joinLines(data, count, [&](size_t i) { return internal::getFixedString(fdata, bytesPerString, i); });
+                }
             } else {
                 // All the elements in the dataset have the same string size
                 // The whole dataset is read into a contiguous block of memory.
@@ -2436,48 +2889,44 @@ namespace h5pp::hdf5 {
                 auto        size           = H5Sget_select_npoints(dsetInfo.h5Space.value());
                 std::string fdata;
                 fdata.resize(type::safe_cast<size_t>(size) * bytesPerString);
-                retval = H5Dread(dsetInfo.h5Dset.value(),
-                                 dsetInfo.h5Type.value(),
-                                 dataInfo.h5Space.value(),
-                                 dsetInfo.h5Space.value(),
+                retval = H5Dread(dsetInfo.h5Dset->unchecked(),
+                                 dsetInfo.h5Type->unchecked(),
+                                 dataInfo.h5Space->unchecked(),
+                                 dsetInfo.h5Space->unchecked(),
                                  plists.dsetXfer,
                                  fdata.data());
                 // Now fdata contains the whole dataset, and we need to put the data into the user-given container.
-                if constexpr(std::is_same_v<DataType, std::string> or type::sfinae::is_vstr_v<DataType>) {
-                    // A vector of strings (fdata) can be put into a single string (data) with entries separated by new-lines
-                    data.clear();
-                    for(size_t i = 0; i < type::safe_cast<size_t>(size); i++) {
-                        data.append(fdata.substr(i * bytesPerString, bytesPerString));
-                        if(data.size() < fdata.size() - 1) data.append("\n");
-                    }
-                    data.erase(std::find(data.begin(), data.end(), '\0'), data.end()); // Prune all but the last null terminator
-                } else if constexpr(type::sfinae::has_resize_v<DataType> and (type::sfinae::is_container_of_v<DataType, h5pp::vstr_t> or
+                if constexpr(type::sfinae::has_resize_v<DataType> and (type::sfinae::is_container_of_v<DataType, h5pp::vstr_t> or
                                                                               type::sfinae::is_container_of_v<DataType, std::string>)) {
                     if(data.size() != type::safe_cast<size_t>(size)) {
                         throw h5pp::runtime_error("Given container of strings has the wrong size: dset size {} | container size {}",
                                                   size,
                                                   data.size());
                     }
-                    for(size_t i = 0; i < type::safe_cast<size_t>(size); i++) {
-                        // Each data[i] has type std::string, so we can use the std::string constructor to copy data
-                        data[i] = std::string(fdata.data() + i * bytesPerString, bytesPerString);
-                        // Prune away all null terminators except the last one
-                        data[i].erase(std::find(data[i].begin(), data[i].end(), '\0'), data[i].end());
-                    }
+                    // Copy each string up to its null terminator, straight into data[i]
+                    for(size_t i = 0; i < type::safe_cast<size_t>(size); i++) data[i] = internal::getFixedString(fdata, bytesPerString, i);
                 } else {
                     static_assert(type::sfinae::unrecognized_type_v<DataType> and
                                   "To read text-data, please use h5pp::vstr_t, std::string or a container of them such as std::vector");
                 }
             }
         } else {
+            if constexpr(not std::is_void_v<typename decltype(type::convert::getNumericElement<DataType>())::type>) {
+                if(conversion == internal::Conversion::h5pp) return internal::readDatasetConverted(data, dsetInfo, plists);
+            }
             auto isOpaque = H5Tget_class(dataInfo.h5Type.value()) == H5T_class_t::H5T_OPAQUE;
             auto isStdVectorOfBytes = std::is_same_v<DataType, std::vector<std::byte>>;
-            hid::h5t h5ttype = isOpaque or isStdVectorOfBytes ? dsetInfo.h5Type.value() : dataInfo.h5Type.value();
-            retval = H5Dread(dsetInfo.h5Dset.value(),
+            const hid::h5t &h5ttype = isOpaque or isStdVectorOfBytes ? dsetInfo.h5Type.value() : dataInfo.h5Type.value();
+            auto            xfer    = internal::getXferPlist(plists,
+                                                 dsetInfo.xferBufferPolicy,
+                                                 h5ttype.unchecked(),
+                                                 dsetInfo.h5Type->unchecked(),
+                                                 type::safe_cast<hsize_t>(H5Sget_select_npoints(dataInfo.h5Space->unchecked())));
+            retval = H5Dread(dsetInfo.h5Dset->unchecked(),
                 h5ttype,
-                dataInfo.h5Space.value(),
-                dsetInfo.h5Space.value(),
-                plists.dsetXfer,
+                dataInfo.h5Space->unchecked(),
+                dsetInfo.h5Space->unchecked(),
+                xfer.plist,
                 dataPtr);
 
 
@@ -2497,6 +2946,111 @@ namespace h5pp::hdf5 {
         }
     }
 
+    /*! Reads a hyperslab of a dataset into data, a preallocated buffer that is never resized.
+     *
+     * Data must have as many elements as the hyperslab. Row-major and 1D buffers are read with a single H5Dread. Column-major
+     * Eigen types, such as a default Eigen::TensorMap or Eigen::Map, are read in place one line at a time. Neither makes
+     * temporary copies of the data, so repeated reads with the same dsetInfo do not allocate buffers.
+     */
+    template<typename DataType>
+    void readHyperslab(DataType &data, const DsetInfo &dsetInfo, const Hyperslab &hyperslab, const PropertyLists &plists = PropertyLists::defaults()) {
+        static_assert(not std::is_const_v<DataType>);
+        static_assert((not type::sfinae::is_text_v<DataType> and not type::sfinae::has_text_v<DataType>) or type::sfinae::has_fstr_v<DataType>,
+                      "readHyperslab into a buffer does not support text data other than containers of h5pp::fstr_t<N>");
+        dsetInfo.assertReadReady();
+        if(not hyperslab.extent) throw h5pp::runtime_error("Cannot read hyperslab from dataset [{}]: No extent given", dsetInfo.dsetPath.value());
+        const auto &memType = type::getH5Type<DataType>();
+#ifdef H5PP_USE_EIGEN3
+        if constexpr(type::sfinae::is_eigen_colmajor_v<DataType> and not type::sfinae::is_eigen_1d_v<DataType>) {
+            const auto &extent = hyperslab.extent.value();
+            if(not internal::isBlock(hyperslab))
+                throw h5pp::runtime_error("Cannot read hyperslab {} with stride or blocks into column-major data. Use a row-major map instead",
+                                          hyperslab.string());
+            auto offset = hyperslab.offset ? hyperslab.offset.value() : std::vector<hsize_t>(extent.size(), 0);
+            if(extent.size() != dsetInfo.dsetDims->size() or offset.size() != extent.size())
+                throw h5pp::runtime_error("Hyperslab {} does not have the rank of dataset [{}]", hyperslab.string(), dsetInfo.dsetPath.value());
+            if(util::getSizeFromDimensions(extent) != util::getSize(data))
+                throw h5pp::runtime_error("Cannot read hyperslab {} of {} elements into [{}] of size {}",
+                                          hyperslab.string(),
+                                          util::getSizeFromDimensions(extent),
+                                          type::sfinae::type_name<DataType>(),
+                                          util::getSize(data));
+            return internal::readColMajorLines(util::getVoidPointer<void *>(data), memType.unchecked(), dsetInfo, offset, extent, plists);
+        }
+#endif
+        hid::h5s dsetSpace = H5Scopy(dsetInfo.h5Space.value());
+        selectHyperslab(dsetSpace, hyperslab);
+        auto numElems = type::safe_cast<hsize_t>(H5Sget_select_npoints(dsetSpace));
+        if(numElems != util::getSize(data))
+            throw h5pp::runtime_error("Cannot read hyperslab {} of {} elements into [{}] of size {}",
+                                      hyperslab.string(),
+                                      numElems,
+                                      type::sfinae::type_name<DataType>(),
+                                      util::getSize(data));
+        hid::h5s memSpace = H5Screate_simple(1, &numElems, nullptr);
+        auto     xfer     = internal::getXferPlist(plists, dsetInfo.xferBufferPolicy, memType.unchecked(), dsetInfo.h5Type->unchecked(), numElems);
+        if(H5Dread(dsetInfo.h5Dset->unchecked(), memType.unchecked(), memSpace, dsetSpace, xfer.plist, util::getVoidPointer<void *>(data)) < 0)
+            throw h5pp::runtime_error("Failed to read hyperslab {} from dataset [{}]", hyperslab.string(), dsetInfo.dsetPath.value());
+    }
+
+    /*! Reads the elements of a dataset given by selection into data, in a single H5Dread.
+     *  Data is used as a contiguous 1D buffer, and is resized to the number of selected elements if it has a different size.
+     */
+    template<typename DataType>
+    void readSelection(DataType &data, const DsetInfo &dsetInfo, const Selection &selection, const PropertyLists &plists = PropertyLists::defaults()) {
+        static_assert(not std::is_const_v<DataType>);
+        static_assert((not type::sfinae::is_text_v<DataType> and not type::sfinae::has_text_v<DataType>) or type::sfinae::has_fstr_v<DataType>,
+                      "readSelection does not support text data other than containers of h5pp::fstr_t<N>");
+        dsetInfo.assertReadReady();
+        hid::h5s dsetSpace = H5Scopy(dsetInfo.h5Space.value());
+        selection.applySelection(dsetSpace);
+        auto numElems = type::safe_cast<hsize_t>(H5Sget_select_npoints(dsetSpace));
+        if constexpr(type::sfinae::has_resize_v<DataType>)
+            if(util::getSize(data) != numElems) util::resizeData(data, {numElems});
+        if(util::getSize(data) != numElems)
+            throw h5pp::runtime_error("Cannot read {} selected elements of dataset [{}] into [{}] of size {}",
+                                      numElems,
+                                      dsetInfo.dsetPath.value(),
+                                      type::sfinae::type_name<DataType>(),
+                                      util::getSize(data));
+        h5pp::logger::log->debug("Reading {} elements of dataset [{}] {}", numElems, dsetInfo.dsetPath.value(), selection.string());
+        if(numElems == 0) return;
+        hid::h5s    memSpace = H5Screate_simple(1, &numElems, nullptr);
+        const auto &memType  = type::getH5Type<DataType>();
+        auto        xfer     = internal::getXferPlist(plists, dsetInfo.xferBufferPolicy, memType.unchecked(), dsetInfo.h5Type->unchecked(), numElems);
+        if(H5Dread(dsetInfo.h5Dset->unchecked(), memType.unchecked(), memSpace, dsetSpace, xfer.plist, util::getVoidPointer<void *>(data)) < 0)
+            throw h5pp::runtime_error("Failed to read selection{} from dataset [{}]", selection.string(), dsetInfo.dsetPath.value());
+    }
+
+    /*! Writes data into the elements of a dataset given by selection, in a single H5Dwrite.
+     *  Data is used as a contiguous 1D buffer, and must have as many elements as the selection.
+     */
+    template<typename DataType>
+    void writeSelection(const DataType      &data,
+                        const DsetInfo      &dsetInfo,
+                        const Selection     &selection,
+                        const PropertyLists &plists = PropertyLists::defaults()) {
+        static_assert(not type::sfinae::is_text_v<DataType> and not type::sfinae::has_text_v<DataType>,
+                      "writeSelection does not support text data");
+        dsetInfo.assertWriteReady();
+        hid::h5s dsetSpace = H5Scopy(dsetInfo.h5Space.value());
+        selection.applySelection(dsetSpace);
+        auto numElems = type::safe_cast<hsize_t>(H5Sget_select_npoints(dsetSpace));
+        if(util::getSize(data) != numElems)
+            throw h5pp::runtime_error("Cannot write [{}] of size {} into {} selected elements of dataset [{}]",
+                                      type::sfinae::type_name<DataType>(),
+                                      util::getSize(data),
+                                      numElems,
+                                      dsetInfo.dsetPath.value());
+        h5pp::logger::log->debug("Writing {} elements of dataset [{}] {}", numElems, dsetInfo.dsetPath.value(), selection.string());
+        if(numElems == 0) return;
+        hid::h5s    memSpace = H5Screate_simple(1, &numElems, nullptr);
+        const auto &memType  = type::getH5Type<DataType>();
+        auto        xfer     = internal::getXferPlist(plists, dsetInfo.xferBufferPolicy, memType.unchecked(), dsetInfo.h5Type->unchecked(), numElems);
+        if(H5Dwrite(dsetInfo.h5Dset->unchecked(), memType.unchecked(), memSpace, dsetSpace, xfer.plist, util::getVoidPointer<const void *>(data)) < 0)
+            throw h5pp::runtime_error("Failed to write selection{} into dataset [{}]", selection.string(), dsetInfo.dsetPath.value());
+    }
+
     template<typename DataType>
     void writeAttribute(const DataType &data, const DataInfo &dataInfo, const AttrInfo &attrInfo) {
         static_assert(not type::sfinae::is_h5pp_id<DataType>);
@@ -2531,12 +3085,12 @@ namespace h5pp::hdf5 {
         [[maybe_unused]] auto dataPtr = h5pp::util::getVoidPointer<const void *>(data);
 
         if constexpr(type::sfinae::is_text_v<DataType> or type::sfinae::has_text_v<DataType>) {
-            auto vec = getCharPtrVector(data);
-            if(H5Tis_variable_str(attrInfo.h5Type->value()) > 0)
-                retval = H5Awrite(attrInfo.h5Attr.value(), attrInfo.h5Type.value(), vec.data());
-            else retval = H5Awrite(attrInfo.h5Attr.value(), attrInfo.h5Type.value(), *vec.data());
+            std::string               tempBuf; // A buffer in case we need to make text data contiguous
+            std::vector<const char *> vlenBuf;
+            dataPtr = getTextPtrForH5Dwrite(data, attrInfo.h5Type.value(), tempBuf, vlenBuf);
+            retval  = H5Awrite(attrInfo.h5Attr->unchecked(), attrInfo.h5Type->unchecked(), dataPtr);
         } else {
-            retval = H5Awrite(attrInfo.h5Attr.value(), attrInfo.h5Type.value(), dataPtr);
+            retval = H5Awrite(attrInfo.h5Attr->unchecked(), attrInfo.h5Type->unchecked(), dataPtr);
         }
 
         if(retval < 0) {
@@ -2547,7 +3101,7 @@ namespace h5pp::hdf5 {
     }
 
     template<typename DataType, typename = std::enable_if_t<not std::is_const_v<DataType>>>
-    void readAttribute(DataType &data, const DataInfo &dataInfo, const AttrInfo &attrInfo, const PropertyLists &plists = PropertyLists()) {
+    void readAttribute(DataType &data, const DataInfo &dataInfo, const AttrInfo &attrInfo, const PropertyLists &plists = PropertyLists::defaults()) {
         // Transpose the data container before reading
 #ifdef H5PP_USE_EIGEN3
         if constexpr(type::sfinae::is_eigen_colmajor_v<DataType> and not type::sfinae::is_eigen_1d_v<DataType>) {
@@ -2591,19 +3145,23 @@ namespace h5pp::hdf5 {
                 auto                size = H5Sget_select_npoints(attrInfo.h5Space.value());
                 std::vector<char *> vdata(type::safe_cast<size_t>(size)); // Allocate pointers for "size" number of strings
                 // HDF5 allocates space for each string
-                retval = H5Aread(attrInfo.h5Attr.value(), attrInfo.h5Type.value(), vdata.data());
+                retval = H5Aread(attrInfo.h5Attr->unchecked(), attrInfo.h5Type->unchecked(), vdata.data());
                 // Now vdata contains the whole dataset, and we need to put the data into the user-given container.
                 if constexpr(std::is_same_v<DataType, std::string>) {
                     // A vector of strings (vdata) can be put into a single string (data) with entries separated by new-lines
-                    data.clear();
-                    for(size_t i = 0; i < vdata.size(); i++) {
-                        if(!vdata.empty() and vdata[i] != nullptr) data.append(vdata[i]);
-                        if(i < vdata.size() - 1) data.append("\n");
-                    }
+                    internal::joinLines(data, vdata.size(), [&vdata](size_t i) {
+                        return vdata[i] == nullptr ? std::string_view() : std::string_view(vdata[i]);
+                    });
                 } else if constexpr(type::sfinae::is_container_of_v<DataType, std::string> and type::sfinae::has_resize_v<DataType>) {
                     data.clear();
                     data.resize(vdata.size());
                     for(size_t i = 0; i < data.size(); i++) data[i] = std::string(vdata[i]);
+                } else if constexpr(type::sfinae::has_fstr_v<DataType> and type::sfinae::has_resize_v<DataType>) {
+                    data.resize(vdata.size());
+                    for(size_t i = 0; i < data.size(); i++) {
+                        if(vdata[i] == nullptr) data[i].clear();
+                        else data[i] = vdata[i]; // Truncated to fit fstr_t<N>
+                    }
                 } else {
                     throw h5pp::runtime_error(
                         "To read text-data, please use std::string or a container of std::string like std::vector<std::string>");
@@ -2615,6 +3173,17 @@ namespace h5pp::hdf5 {
                 herr_t reclaim_err = H5Dvlen_reclaim(attrInfo.h5Type.value(), attrInfo.h5Space.value(), H5P_DEFAULT, vdata.data());
 #endif
                 if(reclaim_err < 0) h5pp::runtime_error("readAttribute: failed to reclaim variable-length array buffer");
+            } else if constexpr(type::sfinae::has_fstr_v<DataType> and type::sfinae::has_data_v<DataType>) {
+                // The fstr_t<N> elements are contiguous, so the attribute is read straight into them
+                auto size = H5Sget_select_npoints(attrInfo.h5Space.value());
+                if constexpr(type::sfinae::has_resize_v<DataType>) data.resize(type::safe_cast<size_t>(size));
+                if(util::getSize(data) < type::safe_cast<size_t>(size)) {
+                    throw h5pp::runtime_error("Given container of strings is too small: attribute size {} | container size {}",
+                                              size,
+                                              util::getSize(data));
+                }
+                hid::h5t memType = internal::getFstrMemType<DataType>(attrInfo.h5Type.value());
+                retval           = H5Aread(attrInfo.h5Attr->unchecked(), memType.unchecked(), data.data());
             } else {
                 // All the elements in the dataset have the same string size
                 // The whole dataset is read into a contiguous block of memory.
@@ -2622,28 +3191,25 @@ namespace h5pp::hdf5 {
                 auto        size           = H5Sget_select_npoints(attrInfo.h5Space.value());
                 std::string fdata;
                 fdata.resize(type::safe_cast<size_t>(size) * bytesPerString);
-                retval = H5Aread(attrInfo.h5Attr.value(), attrInfo.h5Type.value(), fdata.data());
+                retval = H5Aread(attrInfo.h5Attr->unchecked(), attrInfo.h5Type->unchecked(), fdata.data());
                 // Now fdata contains the whole dataset, and we need to put the data into the user-given container.
                 if constexpr(std::is_same_v<DataType, std::string>) {
                     // A vector of strings (fdata) can be put into a single string (data) with entries separated by new-lines
-                    data.clear();
-                    for(size_t i = 0; i < type::safe_cast<size_t>(size); i++) {
-                        data.append(fdata.substr(i * bytesPerString, bytesPerString));
-                        if(data.size() < fdata.size() - 1) data.append("\n");
-                    }
+                    internal::joinLines(data, type::safe_cast<size_t>(size), [&](size_t i) {
+                        return internal::getFixedString(fdata, bytesPerString, i);
+                    });
                 } else if constexpr(type::sfinae::is_container_of_v<DataType, std::string> and type::sfinae::has_resize_v<DataType>) {
                     data.clear();
                     data.resize(type::safe_cast<size_t>(size));
-                    for(size_t i = 0; i < type::safe_cast<size_t>(size); i++) data[i] = fdata.substr(i * bytesPerString, bytesPerString);
+                    // Copy each string up to its null terminator
+                    for(size_t i = 0; i < type::safe_cast<size_t>(size); i++) data[i] = internal::getFixedString(fdata, bytesPerString, i);
                 } else {
                     throw h5pp::runtime_error(
                         "To read text-data, please use std::string or a container of std::string like std::vector<std::string>");
                 }
             }
-            if constexpr(std::is_same_v<DataType, std::string>)
-                data.erase(std::find(data.begin(), data.end(), '\0'), data.end()); // Prune all but the last null terminator
         } else {
-            retval = H5Aread(attrInfo.h5Attr.value(), attrInfo.h5Type.value(), dataPtr);
+            retval = H5Aread(attrInfo.h5Attr->unchecked(), attrInfo.h5Type->unchecked(), dataPtr);
             /* Detect if any VLEN arrays were read, that would have to be reclaimed/free'd later */
             if(util::should_track_vlen_reclaims<DataType>(attrInfo.h5Type.value(), plists)) {
                 attrInfo.reclaimInfo =
@@ -2662,6 +3228,16 @@ namespace h5pp::hdf5 {
         return fs::exists(filePath) and H5Fis_hdf5(filePath.string().c_str()) > 0;
     }
 
+    /*! Copies the image of an open file, as it would be stored on disk, into image. Reuses the capacity of image */
+    inline void getFileImage(const hid::h5f &file, std::vector<std::byte> &image) {
+        H5Fflush(file, H5F_SCOPE_LOCAL);
+        ssize_t bytes = H5Fget_file_image(file, nullptr, 0);
+        if(bytes < 0) throw h5pp::runtime_error("Failed to get the size of a file image");
+        image.resize(type::safe_cast<size_t>(bytes));
+        if(H5Fget_file_image(file, image.data(), image.size()) < 0)
+            throw h5pp::runtime_error("Failed to get a file image of {} bytes", image.size());
+    }
+
     [[nodiscard]] inline fs::path getAvailableFileName(const fs::path &filePath) {
         int      i           = 1;
         fs::path newFileName = filePath;
@@ -2699,7 +3275,7 @@ namespace h5pp::hdf5 {
     }
 
     [[nodiscard]] inline fs::path
-        createFile(const h5pp::fs::path &filePath_, const h5pp::FileAccess &access, const PropertyLists &plists = PropertyLists()) {
+        createFile(const h5pp::fs::path &filePath_, const h5pp::FileAccess &access, const PropertyLists &plists = PropertyLists::defaults()) {
         fs::path filePath = fs::absolute(filePath_);
         fs::path fileName = filePath_.filename();
         if(fs::exists(filePath)) {
@@ -2754,7 +3330,7 @@ namespace h5pp::hdf5 {
         return fs::canonical(filePath);
     }
 
-    inline void createTable(TableInfo &info, const PropertyLists &plists = PropertyLists()) {
+    inline void createTable(TableInfo &info, const PropertyLists &plists = PropertyLists::defaults()) {
         info.assertCreateReady();
         h5pp::logger::log->debug("Creating table [{}] | num fields {} | record size {} bytes | compression {}",
                                  info.tablePath.value(),
@@ -2813,7 +3389,7 @@ namespace h5pp::hdf5 {
                                  const TableInfo      &info,
                                  std::optional<size_t> offset = std::nullopt,
                                  std::optional<size_t> extent = std::nullopt,
-                                 const PropertyLists  &plists = PropertyLists()) {
+                                 const PropertyLists  &plists = PropertyLists::defaults()) {
         /*
          *  This function replaces H5TBread_records() and avoids creating expensive temporaries for the dataset id and type id for the
          * compound table type.
@@ -2865,8 +3441,10 @@ namespace h5pp::hdf5 {
                 data.resize(newsize);
             }
         } else {
-            size_t dtypeSize = util::getBytesPerElem<DataType>();
-            if(dtypeSize != info.recordBytes.value()) {
+            // Registered structs are converted from the record type on file by HDF5, so their size may differ
+            constexpr bool isRegistered = not std::is_void_v<typename decltype(internal::getRegisteredElement<DataType>())::type>;
+            size_t         dtypeSize    = util::getBytesPerElem<DataType>();
+            if(not isRegistered and dtypeSize != info.recordBytes.value()) {
                 throw h5pp::runtime_error("readTableRecords: Type size mismatch:\n"
                                           "Buffer [{}] has {} bytes/element\n"
                                           "Table [{}] has {} bytes/record",
@@ -2905,7 +3483,9 @@ namespace h5pp::hdf5 {
         /* Step 3: read the records */
         // Get the memory address to the data buffer
         auto   dataPtr = h5pp::util::getVoidPointer<void *>(data);
-        herr_t retval  = H5Dread(info.h5Dset.value(), info.h5Type.value(), dataSpace, dsetSpace, plists.dsetXfer, dataPtr);
+        hid_t  memType = internal::getTableMemType<DataType>(info);
+        auto   xfer    = internal::getXferPlist(plists, std::nullopt, memType, info.h5Type->unchecked(), extent.value());
+        herr_t retval  = H5Dread(info.h5Dset.value(), memType, dataSpace, dsetSpace, xfer.plist, dataPtr);
         if(retval < 0) throw h5pp::runtime_error("Failed to read data from table [{}]", info.tablePath.value());
 
         /* Step 4: Detect if any VLEN arrays were read, that would have to be reclaimed/free'd later */
@@ -2918,7 +3498,7 @@ namespace h5pp::hdf5 {
                                   TableInfo             &info,
                                   hsize_t                offset = 0,
                                   std::optional<hsize_t> extent = std::nullopt,
-                                  const PropertyLists   &plists = PropertyLists()) {
+                                  const PropertyLists   &plists = PropertyLists::defaults()) {
         /*
          *  This function replaces H5TBwrite_records() and avoids creating expensive temporaries for the dataset id and type id for the
          * compound table type. In addition, it has the ability to extend the existing the dataset if the incoming data larger than the
@@ -2974,8 +3554,10 @@ namespace h5pp::hdf5 {
         } else {
             // Make sure the given data type size matches the table record type size.
             // If there is a mismatch here it can cause horrible bugs/segfaults
-            size_t dtypeSize = util::getBytesPerElem<DataType>();
-            if(dtypeSize != info.recordBytes.value()) {
+            // Registered structs are converted to the record type on file by HDF5, so their size may differ
+            constexpr bool isRegistered = not std::is_void_v<typename decltype(internal::getRegisteredElement<DataType>())::type>;
+            size_t         dtypeSize    = util::getBytesPerElem<DataType>();
+            if(not isRegistered and dtypeSize != info.recordBytes.value()) {
                 throw h5pp::runtime_error("writeTableRecords: Type size mismatch:\n"
                                           "Buffer [{}] has {} bytes/element\n"
                                           "Table [{}] has {} bytes/record",
@@ -3014,8 +3596,10 @@ namespace h5pp::hdf5 {
                 numRecordsNew);
         }
 
+        hid_t memType = internal::getTableMemType<DataType>(info);
         if constexpr(has_direct_chunk) {
-            if(use_direct_chunk) {
+            // Chunks are written as they are in memory, so the layout in memory must be that of the records on file
+            if(use_direct_chunk and (memType == info.h5Type->unchecked() or H5Tequal(memType, info.h5Type.value()) > 0)) {
                 /* Step 3: write the records */
                 H5Dwrite_chunkwise(data,
                                    info.h5Dset.value(),
@@ -3039,7 +3623,8 @@ namespace h5pp::hdf5 {
                 /* Step 4: write the records */
                 // Get the memory address to the data buffer
                 auto dataPtr = h5pp::util::getVoidPointer<const void *>(data);
-                retval       = H5Dwrite(info.h5Dset.value(), info.h5Type.value(), dataSpace, dsetSpace, plists.dsetXfer, dataPtr);
+                auto xfer    = internal::getXferPlist(plists, std::nullopt, memType, info.h5Type->unchecked(), numRecordsWrt);
+                retval       = H5Dwrite(info.h5Dset.value(), memType, dataSpace, dsetSpace, xfer.plist, dataPtr);
             }
 
         } else {
@@ -3055,7 +3640,8 @@ namespace h5pp::hdf5 {
             /* Step 4: write the records */
             // Get the memory address to the data buffer
             auto dataPtr = h5pp::util::getVoidPointer<const void *>(data);
-            retval       = H5Dwrite(info.h5Dset.value(), info.h5Type.value(), dataSpace, dsetSpace, plists.dsetXfer, dataPtr);
+            auto xfer    = internal::getXferPlist(plists, std::nullopt, memType, info.h5Type->unchecked(), numRecordsWrt);
+            retval       = H5Dwrite(info.h5Dset.value(), memType, dataSpace, dsetSpace, xfer.plist, dataPtr);
         }
 
         if(retval < 0) {
@@ -3090,7 +3676,7 @@ namespace h5pp::hdf5 {
                                  hsize_t                srcExtent,
                                  h5pp::TableInfo       &tgtInfo,
                                  hsize_t                tgtOffset,
-                                 const PropertyLists   &plists = PropertyLists()) {
+                                 const PropertyLists   &plists = PropertyLists::defaults()) {
         srcInfo.assertReadReady();
         tgtInfo.assertWriteReady();
         srcOffset = util::wrapUnsigned(srcOffset, srcInfo.numRecords.value()); // Allows python style negative indexing
@@ -3172,20 +3758,45 @@ namespace h5pp::hdf5 {
     inline bool checkIfTableFieldsExists(const hid::h5f       &h5File,
                                          std::string_view      tablePath,
                                          const std::vector<T> &fields,
-                                         const PropertyLists  &plists = PropertyLists()) {
+                                         const PropertyLists  &plists = PropertyLists::defaults()) {
         auto exists = checkIfLinkExists(h5File, tablePath, plists.linkAccess);
         if(not exists) return false;
         auto h5Dset = hdf5::openLink<hid::h5d>(h5File, tablePath, exists, plists.dsetAccess);
         return checkIfTableFieldsExists(h5Dset, fields);
     }
 
+    namespace internal {
+        /*! Returns the members of the compound type memType that are named in the compound type fields, at their offsets in memType.
+         *  Returns std::nullopt if some field is not a member of memType.
+         */
+        [[nodiscard]] inline std::optional<hid::h5t> selectCompoundMembers(const hid::h5t &memType, const hid::h5t &fields) {
+            std::vector<std::string> memNames;
+            for(unsigned int idx = 0; idx < type::safe_cast<unsigned int>(H5Tget_nmembers(memType)); idx++) {
+                char *name = H5Tget_member_name(memType, idx);
+                memNames.emplace_back(name);
+                H5free_memory(name);
+            }
+            hid::h5t selection = H5Tcreate(H5T_COMPOUND, H5Tget_size(memType));
+            for(unsigned int idx = 0; idx < type::safe_cast<unsigned int>(H5Tget_nmembers(fields)); idx++) {
+                char *name   = H5Tget_member_name(fields, idx);
+                auto  memIt  = std::find(memNames.begin(), memNames.end(), name);
+                H5free_memory(name);
+                if(memIt == memNames.end()) return std::nullopt;
+                auto     memIdx     = type::safe_cast<unsigned int>(std::distance(memNames.begin(), memIt));
+                hid::h5t memberType = H5Tget_member_type(memType, memIdx);
+                H5Tinsert(selection, memIt->c_str(), H5Tget_member_offset(memType, memIdx), memberType);
+            }
+            return selection;
+        }
+    }
+
     template<typename DataType>
     inline void readTableField(DataType              &data,
                                const TableInfo       &info,
                                const hid::h5t        &h5t_fields,
                                std::optional<hsize_t> offset = std::nullopt,
                                std::optional<hsize_t> extent = std::nullopt,
-                               const PropertyLists   &plists = PropertyLists()) {
+                               const PropertyLists   &plists = PropertyLists::defaults()) {
         static_assert(not std::is_const_v<DataType>);
         static_assert(not type::sfinae::is_h5pp_id<DataType>);
         // If none of offset or extent are given:
@@ -3268,6 +3879,7 @@ namespace h5pp::hdf5 {
         selectHyperslab(dsetSpace, slab, H5S_SELECT_SET);
 
         /* Step 3: Resize the recipient data buffer */
+        std::optional<hid::h5t> memType; // Replaces h5t_fields as the memory type when reading into registered structs
         if(detect_vlen > 0) {
             auto               size = h5pp::hdf5::getSizeSelected(dsetSpace);
             std::vector<hvl_t> vdata(type::safe_cast<size_t>(size)); // Allocate len/ptr pairs for "size" number of vlen arrays
@@ -3349,11 +3961,14 @@ namespace h5pp::hdf5 {
             data.resize(fieldSizeSum * extent.value());
         } else {
             h5pp::util::resizeData(data, {extent.value()});
-            // Make sure the data type of the given read buffer matches the size computed above.
+            // Registered structs are read member by member, by name, regardless of padding and member order
+            using RegisteredType = typename decltype(internal::getRegisteredElement<DataType>())::type;
+            if constexpr(not std::is_void_v<RegisteredType>) memType = internal::selectCompoundMembers(type::getH5Type<RegisteredType>(), h5t_fields);
+            // Otherwise, make sure the data type of the given read buffer matches the size computed above.
             // If there is a mismatch here it can cause horrible bugs/segfaults
             size_t dtypeSize    = util::getBytesPerElem<DataType>();
             auto   fieldSizeSum = getBytesPerElem(h5t_fields);
-            if(dtypeSize != fieldSizeSum) {
+            if(not memType and dtypeSize != fieldSizeSum) {
                 auto        h5t_info = getH5TInfo(h5t_fields);
                 std::string error_msg;
                 for(size_t idx = 0; idx < type::safe_cast<size_t>(h5t_info.numMembers.value()); idx++) {
@@ -3382,7 +3997,9 @@ namespace h5pp::hdf5 {
         auto dataPtr = h5pp::util::getVoidPointer<void *>(data);
 
         /* Read data */
-        herr_t retval = H5Dread(info.h5Dset.value(), h5t_fields, dataSpace, dsetSpace, H5P_DEFAULT, dataPtr);
+        hid_t  readType = memType ? memType->unchecked() : h5t_fields.unchecked();
+        auto   xfer     = internal::getXferPlist(plists, std::nullopt, readType, info.h5Type->unchecked(), extent.value());
+        herr_t retval   = H5Dread(info.h5Dset.value(), readType, dataSpace, dsetSpace, xfer.plist, dataPtr);
         if(retval < 0) throw h5pp::runtime_error("Could not read table fields on table [{}]", info.tablePath.value());
     }
 
@@ -3392,7 +4009,7 @@ namespace h5pp::hdf5 {
                                const std::vector<size_t> &fieldIndices, // Field indices for the table on file
                                std::optional<hsize_t>     offset = std::nullopt,
                                std::optional<hsize_t>     extent = std::nullopt,
-                               const PropertyLists       &plists = PropertyLists()) {
+                               const PropertyLists       &plists = PropertyLists::defaults()) {
         static_assert(not std::is_const_v<DataType>);
         hid::h5t tgtTypeId = util::getFieldTypeId(info, fieldIndices);
         readTableField(data, info, tgtTypeId, offset, extent, plists);
@@ -3404,12 +4021,56 @@ namespace h5pp::hdf5 {
                                const std::vector<std::string> &fieldNames,
                                std::optional<hsize_t>          offset = std::nullopt,
                                std::optional<hsize_t>          extent = std::nullopt,
-                               const PropertyLists            &plists = PropertyLists()) {
+                               const PropertyLists            &plists = PropertyLists::defaults()) {
         static_assert(not std::is_const_v<DataType>);
         hid::h5t tgtTypeId = util::getFieldTypeId(info, fieldNames);
         readTableField(data, info, tgtTypeId, offset, extent, plists);
     }
 
+    template<typename h5x_src, typename h5x_tgt>
+    inline void copyAttributes(const h5x_src       &srcLocId,
+                               std::string_view     srcLinkPath,
+                               const h5x_tgt       &tgtLocId,
+                               std::string_view     tgtLinkPath,
+                               const PropertyLists &plists = PropertyLists::defaults()) {
+        /*! Copies all attributes on the object at srcLinkPath onto the object at tgtLinkPath, which may be on another file.
+         * H5Ocopy already copies the attributes of the objects it copies, so this is only needed for objects that
+         * cannot be copied with H5Ocopy, such as the root group of a file.
+         */
+        static_assert(type::sfinae::is_hdf5_loc_id<h5x_src>,
+                      "Template function [h5pp::hdf5::copyAttributes(const h5x_src & srcLocId, ...)] requires type h5x_src to be: "
+                      "[h5pp::hid::h5f], [h5pp::hid::h5g], [h5pp::hid::h5o] or [hid_t]");
+        static_assert(type::sfinae::is_hdf5_loc_id<h5x_tgt>,
+                      "Template function [h5pp::hdf5::copyAttributes(..., ..., const h5x_tgt & tgtLocId, ...)] requires type h5x_tgt to be: "
+                      "[h5pp::hid::h5f], [h5pp::hid::h5g], [h5pp::hid::h5o] or [hid_t]");
+        auto srcLink = openLink<hid::h5o>(srcLocId, srcLinkPath, std::nullopt, plists.linkAccess);
+        auto tgtLink = openLink<hid::h5o>(tgtLocId, tgtLinkPath, std::nullopt, plists.linkAccess);
+        for(const auto &attrName : getAttributeNames(srcLink)) {
+            h5pp::logger::log->trace("Copying attribute [{}] on link [{}] --> [{}]", attrName, srcLinkPath, tgtLinkPath);
+            hid::h5a srcAttr = H5Aopen_name(srcLink, attrName.c_str());
+            hid::h5t type    = H5Tcopy(H5Aget_type(srcAttr)); // Transient copy, in case the type is committed to the source file
+            hid::h5s space   = H5Aget_space(srcAttr);
+            auto     bytes   = H5Tget_size(type) * std::max<size_t>(1, h5pp::hdf5::getSize(space));
+            std::vector<std::byte> buffer(bytes);
+            if(H5Aread(srcAttr, type, buffer.data()) < 0)
+                throw h5pp::runtime_error("Failed to read attribute [{}] on link [{}]", attrName, srcLinkPath);
+            if(H5Aexists(tgtLink, attrName.c_str()) > 0) H5Adelete(tgtLink, attrName.c_str());
+            hid_t tgtAttrId = H5Acreate(tgtLink, attrName.c_str(), type, space, H5P_DEFAULT, H5P_DEFAULT);
+            if(tgtAttrId < 0) throw h5pp::runtime_error("Failed to create attribute [{}] on link [{}]", attrName, tgtLinkPath);
+            hid::h5a tgtAttr = tgtAttrId;
+            herr_t   err     = H5Awrite(tgtAttr, type, buffer.data());
+            // Free memory allocated by HDF5 for variable-length members
+            if(H5Tdetect_class(type, H5T_VLEN) > 0 or H5Tis_variable_str(type) > 0) {
+#if H5_VERSION_GE(1, 12, 0)
+                H5Treclaim(type, space, H5P_DEFAULT, buffer.data());
+#else
+                H5Dvlen_reclaim(type, space, H5P_DEFAULT, buffer.data());
+#endif
+            }
+            if(err < 0) throw h5pp::runtime_error("Failed to write attribute [{}] on link [{}]", attrName, tgtLinkPath);
+        }
+    }
+
     template<typename h5x_src,
              typename h5x_tgt,
              // enable_if so the compiler doesn't think it can use overload with std::string those arguments
@@ -3419,7 +4080,7 @@ namespace h5pp::hdf5 {
                          std::string_view     srcLinkPath,
                          const h5x_tgt       &tgtLocId,
                          std::string_view     tgtLinkPath,
-                         const PropertyLists &plists = PropertyLists()) {
+                         const PropertyLists &plists = PropertyLists::defaults()) {
         static_assert(type::sfinae::is_hdf5_loc_id<h5x_src>,
                       "Template function [h5pp::hdf5::copyLink(const h5x_src & srcLocId, ...)] requires type h5x_src to be: "
                       "[h5pp::hid::h5f], [h5pp::hid::h5g], [h5pp::hid::h5o] or [hid_t]");
@@ -3450,7 +4111,7 @@ namespace h5pp::hdf5 {
                          const h5x_tgt       &tgtLocId,
                          std::string_view     tgtLinkPath,
                          LocationMode         locationMode = LocationMode::DETECT,
-                         const PropertyLists &plists       = PropertyLists()) {
+                         const PropertyLists &plists       = PropertyLists::defaults()) {
         static_assert(type::sfinae::is_hdf5_loc_id<h5x_src>,
                       "Template function [h5pp::hdf5::moveLink(const h5x_src & srcLocId, ...)] requires type h5x_src to be: "
                       "[h5pp::hid::h5f], [h5pp::hid::h5g], [h5pp::hid::h5o] or [hid_t]");
@@ -3493,7 +4154,7 @@ namespace h5pp::hdf5 {
                          const h5pp::fs::path &tgtFilePath,
                          std::string_view      tgtLinkPath,
                          FileAccess            tgtFileAccess = FileAccess::READWRITE,
-                         const PropertyLists  &plists        = PropertyLists()) {
+                         const PropertyLists  &plists        = PropertyLists::defaults()) {
         h5pp::logger::log->trace("Copying link: source link [{}] | source file [{}]  -->  target link [{}] | target file [{}]",
                                  srcLinkPath,
                                  srcFilePath.string(),
@@ -3524,10 +4185,14 @@ namespace h5pp::hdf5 {
         }
     }
 
-    inline fs::path copyFile(const h5pp::fs::path &srcFilePath,
-                             const h5pp::fs::path &tgtFilePath,
-                             FileAccess            tgtFileAccess = FileAccess::COLLISION_FAIL,
-                             const PropertyLists  &plists        = PropertyLists()) {
+    inline fs::path copyFile(const h5pp::fs::path                                        &srcFilePath,
+                             const h5pp::fs::path                                        &tgtFilePath,
+                             FileAccess                                                   tgtFileAccess = FileAccess::COLLISION_FAIL,
+                             const PropertyLists                                         &plists        = PropertyLists::defaults(),
+                             const std::function<void(size_t, size_t, std::string_view)> &progress      = nullptr) {
+        /*! Copies the contents of srcFilePath into a new file tgtFilePath.
+         * If given, progress(done, total, link) is called after each link in the file root has been copied.
+         */
         h5pp::logger::log->trace("Copying file [{}] --> [{}]", srcFilePath.string(), tgtFilePath.string());
         auto tgtPath = h5pp::hdf5::createFile(tgtFilePath, tgtFileAccess, plists);
         auto srcPath = fs::absolute(srcFilePath);
@@ -3558,8 +4223,11 @@ namespace h5pp::hdf5 {
 
             // Copy all the groups in the file root recursively. Note that H5Ocopy does this recursively, so we don't need
             // to iterate links recursively here. Therefore, maxDepth = 0
-            long maxDepth = 0;
-            for(const auto &link : getContentsOfLink<H5O_TYPE_UNKNOWN>(srcFile, "/", maxDepth, plists)) {
+            long   maxDepth = 0;
+            auto   links    = getContentsOfLink<H5O_TYPE_UNKNOWN>(srcFile, "/", maxDepth, plists);
+            size_t total    = static_cast<size_t>(std::count_if(links.begin(), links.end(), [](const auto &l) { return l != "."; }));
+            size_t done     = 0;
+            for(const auto &link : links) {
                 if(link == ".") continue;
                 h5pp::logger::log->trace("Copying recursively: [{}]", link);
                 auto retval = H5Ocopy(srcFile, link.c_str(), tgtFile, link.c_str(), ocpypl, lcpl);
@@ -3569,12 +4237,338 @@ namespace h5pp::hdf5 {
                         link,
                         link);
                 }
+                if(progress) progress(++done, total, link);
             }
-            // ... Find out how to copy attributes that are written on the root itself
+            // The root group itself cannot be copied with H5Ocopy, so its attributes are copied separately
+            copyAttributes(srcFile, "/", tgtFile, "/", plists);
             return tgtPath;
         } catch(const std::exception &ex) {
-            throw h5pp::runtime_error("Could not copy file [{}] --> [{}]: ", srcFilePath.string(), tgtFilePath.string(), ex.what());
+            throw h5pp::runtime_error("Could not copy file [{}] --> [{}]: {}", srcFilePath.string(), tgtFilePath.string(), ex.what());
+        }
+    }
+
+    namespace internal {
+        struct FilterInfo {
+            H5Z_filter_t              id    = H5Z_FILTER_NONE;
+            unsigned int              flags = 0;
+            std::vector<unsigned int> cdValues;
+            bool operator==(const FilterInfo &other) const { return id == other.id and flags == other.flags and cdValues == other.cdValues; }
+        };
+
+        [[nodiscard]] inline std::vector<FilterInfo> getFilterPipeline(hid_t dcpl /* dataset creation property list */) {
+            std::vector<FilterInfo> pipeline;
+            int                     nfilter = H5Pget_nfilters(dcpl);
+            for(int idx = 0; idx < nfilter; idx++) {
+                FilterInfo                   filter;
+                std::array<unsigned int, 32> cdValues  = {};
+                size_t                       cd_nelmts = cdValues.size();
+                filter.id = H5Pget_filter2(dcpl, type::safe_cast<unsigned>(idx), &filter.flags, &cd_nelmts, cdValues.data(), 0, nullptr, nullptr);
+                if(filter.id < 0) throw h5pp::runtime_error("Failed to get filter {} of the dataset creation property list", idx);
+                filter.cdValues.assign(cdValues.begin(), cdValues.begin() + static_cast<long>(std::min(cd_nelmts, cdValues.size())));
+                pipeline.emplace_back(std::move(filter));
+            }
+            return pipeline;
+        }
+
+        /*! Returns the deflate level of a pipeline with deflate as its only filter, -1 if it has no filters, or nullopt otherwise */
+        [[nodiscard]] inline std::optional<int> getDeflateOnlyLevel(const std::vector<FilterInfo> &pipeline) {
+            if(pipeline.empty()) return -1;
+            if(pipeline.size() == 1 and pipeline.front().id == H5Z_FILTER_DEFLATE and not pipeline.front().cdValues.empty())
+                return type::safe_cast<int>(pipeline.front().cdValues.front());
+            return std::nullopt;
+        }
+
+        /*! Calls func(i) for i = 0...n-1 on numThreads threads, and rethrows the first exception thrown by func */
+        inline void parallelFor(size_t n, size_t numThreads, const std::function<void(size_t)> &func) {
+            numThreads = std::min(n, std::max<size_t>(1, numThreads));
+            if(numThreads <= 1) {
+                for(size_t i = 0; i < n; ++i) func(i);
+                return;
+            }
+            std::atomic<size_t>      next = 0;
+            std::exception_ptr       error;
+            std::mutex               errorMutex;
+            std::vector<std::thread> workers;
+            workers.reserve(numThreads);
+            for(size_t t = 0; t < numThreads; ++t) {
+                workers.emplace_back([&]() {
+                    for(size_t i = next++; i < n; i = next++) {
+                        try {
+                            func(i);
+                        } catch(...) {
+                            std::lock_guard<std::mutex> lock(errorMutex);
+                            if(not error) error = std::current_exception();
+                            next = n;
+                        }
+                    }
+                });
+            }
+            for(auto &worker : workers) worker.join();
+            if(error) std::rethrow_exception(error);
+        }
+
+#if H5PP_HAS_DIRECT_CHUNK == 1
+        /*! Copies the allocated chunks of srcDset into tgtDset, which must have the same type, dimensions and chunk dimensions.
+         *
+         * Chunks are copied verbatim when both datasets have the same filter pipeline. When both pipelines consist of deflate
+         * alone (or nothing), chunks are read and written directly and (re)compressed with zlib on numThreads threads.
+         * Otherwise, chunks are passed through the HDF5 filter pipeline with a hyperslab read and write each.
+         * Calls to HDF5 are always made from the calling thread, since the library is not thread-safe in general.
+         */
+        inline void copyDatasetChunks(const hid::h5d      &srcDset,
+                                      const hid::h5d      &tgtDset,
+                                      const RepackOptions &repackOptions,
+                                      CopyReport          &report,
+                                      const PropertyLists &plists = PropertyLists::defaults()) {
+            hid::h5p srcDcpl     = H5Dget_create_plist(srcDset);
+            hid::h5p tgtDcpl     = H5Dget_create_plist(tgtDset);
+            hid::h5t type        = H5Dget_type(srcDset);
+            hid::h5s space       = H5Dget_space(srcDset);
+            auto     srcPipeline = getFilterPipeline(srcDcpl);
+            auto     tgtPipeline = getFilterPipeline(tgtDcpl);
+            auto     dims        = getDimensions(space);
+            auto     chunkDims   = getChunkDimensions(srcDcpl).value();
+            auto     chunkBytes  = H5Tget_size(type) * util::getSizeFromDimensions(chunkDims);
+            auto     numThreads  = repackOptions.numThreads > 0 ? repackOptions.numThreads : std::thread::hardware_concurrency();
+
+            hsize_t numChunks = 0;
+            if(H5Dget_num_chunks(srcDset, space, &numChunks) < 0) throw h5pp::runtime_error("Failed to get the number of chunks");
+
+            struct Chunk {
+                std::vector<hsize_t>   offset;
+                uint32_t               mask        = 0;
+                hsize_t                storageSize = 0;
+                std::vector<std::byte> buffer;
+            };
+            auto getChunk = [&](hsize_t index) -> Chunk {
+                Chunk   chunk;
+                haddr_t addr = 0;
+                chunk.offset.resize(dims.size());
+                if(H5Dget_chunk_info(srcDset, space, index, chunk.offset.data(), &chunk.mask, &addr, &chunk.storageSize) < 0)
+                    throw h5pp::runtime_error("Failed to get info on chunk {}", index);
+                return chunk;
+            };
+            auto readChunk = [&](Chunk &chunk) {
+                chunk.buffer.resize(chunk.storageSize);
+                if(H5Dread_chunk(srcDset, plists.dsetXfer, chunk.offset.data(), &chunk.mask, chunk.buffer.data()) < 0)
+                    throw h5pp::runtime_error("Failed to read chunk at offset {}", chunk.offset);
+            };
+            auto writeChunk = [&](const Chunk &chunk) {
+                if(H5Dwrite_chunk(tgtDset, plists.dsetXfer, chunk.mask, chunk.offset.data(), chunk.buffer.size(), chunk.buffer.data()) < 0)
+                    throw h5pp::runtime_error("Failed to write chunk at offset {}", chunk.offset);
+            };
+
+            if(repackOptions.rawChunkCopy and srcPipeline == tgtPipeline) {
+                for(hsize_t index = 0; index < numChunks; ++index) {
+                    auto chunk = getChunk(index);
+                    readChunk(chunk);
+                    writeChunk(chunk);
+                    report.numRawChunks++;
+                }
+                return;
+            }
+    #if H5PP_HAS_FILTER_DEFLATE == 1 && H5PP_HAS_ZLIB_H == 1
+            auto srcLevel = getDeflateOnlyLevel(srcPipeline);
+            auto tgtLevel = getDeflateOnlyLevel(tgtPipeline);
+            if(repackOptions.rawChunkCopy and srcLevel and tgtLevel) {
+                // Bit 0 of a chunk filter mask is set when the first (here the only) filter was skipped for that chunk
+                auto recompress = [&](Chunk &chunk) {
+                    if(srcLevel.value() >= 0 and (chunk.mask & 1u) == 0) {
+                        std::vector<std::byte> data(chunkBytes);
+                        auto                   dataBytes = static_cast<uLongf>(chunkBytes);
+                        int                    z_err     = uncompress(reinterpret_cast<Bytef *>(data.data()),
+                                                   &dataBytes,
+                                                   reinterpret_cast<const Bytef *>(chunk.buffer.data()),
+                                                   static_cast<uLong>(chunk.buffer.size()));
+                        if(z_err != Z_OK or dataBytes != chunkBytes)
+                            throw h5pp::runtime_error("Failed to uncompress chunk at offset {}: zlib error {}", chunk.offset, z_err);
+                        chunk.buffer = std::move(data);
+                    }
+                    chunk.mask = 0;
+                    if(tgtLevel.value() >= 0) {
+                        auto                   zipBytes = compressBound(static_cast<uLong>(chunk.buffer.size()));
+                        std::vector<std::byte> zip(zipBytes);
+                        int                    z_err = compress2(reinterpret_cast<Bytef *>(zip.data()),
+                                                &zipBytes,
+                                                reinterpret_cast<const Bytef *>(chunk.buffer.data()),
+                                                static_cast<uLong>(chunk.buffer.size()),
+                                                tgtLevel.value());
+                        if(z_err != Z_OK) throw h5pp::runtime_error("Failed to compress chunk at offset {}: zlib error {}", chunk.offset, z_err);
+                        zip.resize(zipBytes);
+                        chunk.buffer = std::move(zip);
+                    }
+                };
+                // Work on batches of chunks to bound the memory footprint
+                size_t batchSize = std::max<size_t>(4 * numThreads, constants::maxChunkBytes * 64 / std::max<size_t>(1, chunkBytes));
+                std::vector<Chunk> batch;
+                for(hsize_t first = 0; first < numChunks; first += batchSize) {
+                    batch.clear();
+                    for(hsize_t index = first; index < std::min<hsize_t>(numChunks, first + batchSize); ++index) {
+                        batch.emplace_back(getChunk(index));
+                        readChunk(batch.back());
+                    }
+                    parallelFor(batch.size(), numThreads, [&](size_t i) { recompress(batch[i]); });
+                    for(const auto &chunk : batch) writeChunk(chunk);
+                    report.numRecompressedChunks += batch.size();
+                }
+                return;
+            }
+    #endif
+            // Pass each chunk through the HDF5 filter pipeline
+            hid::h5s               fileSpace = H5Dget_space(srcDset);
+            std::vector<std::byte> buffer;
+            for(hsize_t index = 0; index < numChunks; ++index) {
+                auto                 chunk = getChunk(index);
+                std::vector<hsize_t> count(dims.size());
+                for(size_t i = 0; i < dims.size(); ++i) count[i] = std::min(chunkDims[i], dims[i] - chunk.offset[i]);
+                hid::h5s memSpace = H5Screate_simple(type::safe_cast<int>(count.size()), count.data(), nullptr);
+                if(H5Sselect_hyperslab(fileSpace, H5S_SELECT_SET, chunk.offset.data(), nullptr, count.data(), nullptr) < 0)
+                    throw h5pp::runtime_error("Failed to select chunk at offset {}", chunk.offset);
+                buffer.resize(H5Tget_size(type) * util::getSizeFromDimensions(count));
+                if(H5Dread(srcDset, type, memSpace, fileSpace, plists.dsetXfer, buffer.data()) < 0)
+                    throw h5pp::runtime_error("Failed to read chunk at offset {}", chunk.offset);
+                if(H5Dwrite(tgtDset, type, memSpace, fileSpace, plists.dsetXfer, buffer.data()) < 0)
+                    throw h5pp::runtime_error("Failed to write chunk at offset {}", chunk.offset);
+                report.numFilteredChunks++;
+            }
+        }
+#endif
+    }
+
+    inline CopyReport repackFile(const h5pp::fs::path                                        &srcFilePath,
+                                 const h5pp::fs::path                                        &tgtFilePath,
+                                 FileAccess                                                   tgtFileAccess = FileAccess::COLLISION_FAIL,
+                                 const RepackOptions                                         &repackOptions = RepackOptions(),
+                                 const PropertyLists                                         &plists        = PropertyLists::defaults(),
+                                 const std::function<void(size_t, size_t, std::string_view)> &progress      = nullptr) {
+        /*! Copies the contents of srcFilePath into a new file tgtFilePath, one link at a time, and returns a report.
+         *
+         * Unlike copyFile, which hands each top-level link to H5Ocopy, chunked datasets are copied chunk by chunk, so that
+         * the target datasets can get a new compression level (see RepackOptions). Other objects, and datasets with
+         * variable-length or reference types, are copied with H5Ocopy. Soft and external links are recreated as such.
+         * Objects reachable through several hard links are copied once per link.
+         * If given, progress(done, total, link) is called after each link has been copied.
+         */
+        h5pp::logger::log->trace("Repacking file [{}] --> [{}]", srcFilePath.string(), tgtFilePath.string());
+        auto       t0      = std::chrono::steady_clock::now();
+        auto       srcPath = fs::absolute(srcFilePath);
+        CopyReport report;
+        if(not fs::exists(srcPath))
+            throw h5pp::runtime_error("Could not repack file [{}]: source file does not exist [{}]", srcFilePath.string(), srcPath.string());
+        auto tgtPath = h5pp::hdf5::createFile(tgtFilePath, tgtFileAccess, plists);
+        if(tgtPath == srcPath) throw h5pp::runtime_error("Could not repack file [{}] onto itself", srcPath.string());
+        if(repackOptions.compression and not isCompressionAvaliable())
+            throw h5pp::runtime_error("Could not repack file [{}]: compression is not available", srcPath.string());
+
+        try {
+            hid_t hidSrc = H5Fopen(srcPath.string().c_str(), H5F_ACC_RDONLY, plists.fileAccess);
+            if(hidSrc < 0) throw h5pp::runtime_error("Failed to open source file [{}] in read-only mode", srcPath.string());
+            hid::h5f srcFile = hidSrc;
+            hid_t    hidTgt  = H5Fopen(tgtPath.string().c_str(), H5F_ACC_RDWR, plists.fileAccess);
+            if(hidTgt < 0) throw h5pp::runtime_error("Failed to open target file [{}] in read-write mode", tgtPath.string());
+            hid::h5f tgtFile = hidTgt;
+            hid::h5p lcpl    = H5Pcopy(plists.linkCreate);
+            hid::h5p ocpypl  = H5Pcreate(H5P_OBJECT_COPY);
+            if(H5Pset_create_intermediate_group(lcpl, 1) < 0) // Set to create intermediate groups
+                throw h5pp::runtime_error("H5Pset_create_intermediate_group failed");
+            if(H5Pset_copy_object(ocpypl, H5O_COPY_MERGE_COMMITTED_DTYPE_FLAG) < 0) throw h5pp::runtime_error("H5Pset_copy_object failed");
+
+            copyAttributes(srcFile, "/", tgtFile, "/", plists);
+            auto   links = findLinks<H5O_TYPE_UNKNOWN>(srcFile, "", "/", -1, -1, true, plists);
+            size_t total = static_cast<size_t>(std::count_if(links.begin(), links.end(), [](const auto &l) { return l != "."; }));
+            for(const auto &link : links) {
+                if(link == ".") continue;
+                H5L_info_t lInfo;
+                if(H5Lget_info(srcFile, link.c_str(), &lInfo, plists.linkAccess) < 0)
+                    throw h5pp::runtime_error("H5Lget_info failed on link [{}]", link);
+                if(lInfo.type == H5L_TYPE_SOFT or lInfo.type == H5L_TYPE_EXTERNAL) {
+                    std::vector<char> value(lInfo.u.val_size);
+                    if(H5Lget_val(srcFile, link.c_str(), value.data(), value.size(), plists.linkAccess) < 0)
+                        throw h5pp::runtime_error("H5Lget_val failed on link [{}]", link);
+                    herr_t err = 0;
+                    if(lInfo.type == H5L_TYPE_SOFT) {
+                        err = H5Lcreate_soft(value.data(), tgtFile, link.c_str(), lcpl, plists.linkAccess);
+                    } else {
+                        unsigned    flags    = 0;
+                        const char *fileName = nullptr;
+                        const char *objPath  = nullptr;
+                        if(H5Lunpack_elink_val(value.data(), value.size(), &flags, &fileName, &objPath) < 0)
+                            throw h5pp::runtime_error("H5Lunpack_elink_val failed on link [{}]", link);
+                        err = H5Lcreate_external(fileName, objPath, tgtFile, link.c_str(), lcpl, plists.linkAccess);
+                    }
+                    if(err < 0) throw h5pp::runtime_error("Failed to recreate symbolic link [{}]", link);
+                } else if(lInfo.type == H5L_TYPE_HARD) {
+                    /* clang-format off */
+                    H5O_info_t oInfo;
+#if defined(H5Oget_info_vers) && H5Oget_info_vers >= 2
+                    herr_t err = H5Oget_info_by_name(srcFile, link.c_str(), &oInfo, H5O_INFO_BASIC, plists.linkAccess);
+#else
+                    herr_t err = H5Oget_info_by_name(srcFile, link.c_str(), &oInfo, plists.linkAccess);
+#endif
+                    /* clang-format on */
+                    if(err < 0) throw h5pp::runtime_error("H5Oget_info_by_name failed on link [{}]", link);
+                    bool chunkwise = false;
+                    if(oInfo.type == H5O_TYPE_GROUP) {
+                        // Groups are created empty, since their members are visited as well
+                        if(not checkIfLinkExists(tgtFile, link, plists.linkAccess)) {
+                            hid_t gid = H5Gcreate(tgtFile, link.c_str(), lcpl, plists.groupCreate, plists.groupAccess);
+                            if(gid < 0) throw h5pp::runtime_error("Failed to create group [{}]", link);
+                            hid::h5g group = gid;
+                        }
+                        copyAttributes(srcFile, link, tgtFile, link, plists);
+                    } else if(oInfo.type == H5O_TYPE_DATASET) {
+                        auto     srcDset = openLink<hid::h5d>(srcFile, link, true, plists.dsetAccess);
+                        hid::h5p dcpl    = H5Dget_create_plist(srcDset);
+                        hid::h5t type    = H5Dget_type(srcDset);
+                        chunkwise        = has_direct_chunk and H5Pget_layout(dcpl) == H5D_CHUNKED and H5Tdetect_class(type, H5T_VLEN) <= 0 and
+                                    H5Tis_variable_str(type) <= 0 and H5Tdetect_class(type, H5T_REFERENCE) <= 0;
+#if H5PP_HAS_DIRECT_CHUNK == 1
+                        if(chunkwise) {
+                            hid::h5p tgtDcpl = H5Pcopy(dcpl);
+                            if(repackOptions.compression) {
+                                if(getDeflateLevel(tgtDcpl) >= 0) H5Premove_filter(tgtDcpl, H5Z_FILTER_DEFLATE);
+                                auto level = getValidCompressionLevel(repackOptions.compression);
+                                if(level > 0) H5Pset_deflate(tgtDcpl, type::safe_cast<unsigned>(level));
+                            }
+                            hid::h5t tgtType = H5Tcopy(type); // Transient copy, in case the type is committed to the source file
+                            hid::h5s space   = H5Dget_space(srcDset);
+                            hid_t    did     = H5Dcreate(tgtFile, link.c_str(), tgtType, space, lcpl, tgtDcpl, plists.dsetAccess);
+                            if(did < 0) throw h5pp::runtime_error("Failed to create dataset [{}]", link);
+                            hid::h5d tgtDset = did;
+                            copyAttributes(srcFile, link, tgtFile, link, plists);
+                            internal::copyDatasetChunks(srcDset, tgtDset, repackOptions, report, plists);
+                            report.numDatasets++;
+                            report.bytesRead += H5Dget_storage_size(srcDset);
+                            report.bytesWritten += H5Dget_storage_size(tgtDset);
+                        }
+#endif
+                        if(not chunkwise) {
+                            report.bytesRead += H5Dget_storage_size(srcDset);
+                            if(repackOptions.compression and H5Pget_layout(dcpl) == H5D_CHUNKED)
+                                h5pp::logger::log->debug("Copying dataset [{}] with its original filters", link);
+                        }
+                    }
+                    if(oInfo.type != H5O_TYPE_GROUP and not chunkwise) {
+                        if(H5Ocopy(srcFile, link.c_str(), tgtFile, link.c_str(), ocpypl, lcpl) < 0)
+                            throw h5pp::runtime_error("Failed to copy object [{}] with H5Ocopy", link);
+                        if(oInfo.type == H5O_TYPE_DATASET) {
+                            auto tgtDset = openLink<hid::h5d>(tgtFile, link, true, plists.dsetAccess);
+                            report.bytesWritten += H5Dget_storage_size(tgtDset);
+                        }
+                        report.numObjectCopies++;
+                    }
+                } else {
+                    h5pp::logger::log->warn("Skipped copying link [{}]: user-defined links are not supported", link);
+                }
+                report.numLinks++;
+                if(progress) progress(report.numLinks, total, link);
+            }
+        } catch(const std::exception &ex) {
+            throw h5pp::runtime_error("Could not repack file [{}] --> [{}]: {}", srcFilePath.string(), tgtFilePath.string(), ex.what());
         }
+        report.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+        h5pp::logger::log->debug("Repacked file [{}] --> [{}]: {}", srcFilePath.string(), tgtFilePath.string(), report.string());
+        return report;
     }
 
     inline void moveLink(const h5pp::fs::path &srcFilePath,
@@ -3582,7 +4576,7 @@ namespace h5pp::hdf5 {
                          const h5pp::fs::path &tgtFilePath,
                          std::string_view      tgtLinkPath,
                          FileAccess            tgtFileAccess = FileAccess::READWRITE,
-                         const PropertyLists  &plists        = PropertyLists()) {
+                         const PropertyLists  &plists        = PropertyLists::defaults()) {
         h5pp::logger::log->trace("Moving link: source link [{}] | source file [{}]  -->  target link [{}] | target file [{}]",
                                  srcLinkPath,
                                  srcFilePath.string(),
@@ -3617,7 +4611,7 @@ namespace h5pp::hdf5 {
     inline fs::path moveFile(const h5pp::fs::path &src,
                              const h5pp::fs::path &tgt,
                              FileAccess            tgtFileAccess = FileAccess::COLLISION_FAIL,
-                             const PropertyLists  &plists        = PropertyLists()) {
+                             const PropertyLists  &plists        = PropertyLists::defaults()) {
         h5pp::logger::log->trace("Moving file by copy+remove: [{}] --> [{}]", src.string(), tgt.string());
         auto tgtPath = h5pp::hdf5::copyFile(src, tgt, tgtFileAccess, plists); // Returns the path to the newly created file
         auto srcPath = fs::absolute(src);
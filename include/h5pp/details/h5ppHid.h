@@ -4,7 +4,27 @@
 #include <stdexcept>
 #include <string>
 
+/*! Policy for validating identifiers in h5pp::hid::hid_base::value() and the implicit conversion to hid_t.
+ *  Set H5PP_HID_CHECK to one of the values below, e.g. with the CMake option H5PP_HID_CHECK=always|debug|never.
+ *  - H5PP_HID_CHECK_ALWAYS: call H5Iis_valid every time the identifier is used.
+ *  - H5PP_HID_CHECK_DEBUG:  as ALWAYS, but only when NDEBUG is not defined (default).
+ *  - H5PP_HID_CHECK_NEVER:  never check. Invalid identifiers are passed on and rejected by HDF5 instead.
+ *  Explicit calls to valid() and operator bool always check.
+ */
+#define H5PP_HID_CHECK_NEVER 0
+#define H5PP_HID_CHECK_DEBUG 1
+#define H5PP_HID_CHECK_ALWAYS 2
+#if !defined(H5PP_HID_CHECK)
+    #define H5PP_HID_CHECK H5PP_HID_CHECK_DEBUG
+#endif
+
 namespace h5pp::hid {
+#if H5PP_HID_CHECK == H5PP_HID_CHECK_ALWAYS || (H5PP_HID_CHECK == H5PP_HID_CHECK_DEBUG && !defined(NDEBUG))
+    inline constexpr bool checkOnAccess = true;
+#else
+    inline constexpr bool checkOnAccess = false;
+#endif
+
     class h5d;
     class h5a;
     class h5o;
@@ -115,6 +135,7 @@ namespace h5pp::hid {
         }
 
         [[nodiscard]] const hid_t &value() const {
+            if constexpr(not checkOnAccess) return val;
             if constexpr(zeroValueIsOK) {
                 if(val == 0) return val;
             }
@@ -126,6 +147,9 @@ namespace h5pp::hid {
             }
         }
 
+        // Returns the identifier without checking its validity. Use on hot paths where validity has been asserted already
+        [[nodiscard]] const hid_t &unchecked() const noexcept { return val; }
+
         [[nodiscard]] auto refcount() const {
             if constexpr(zeroValueIsOK) {
                 if(val == 0) return 0;
@@ -42,7 +42,7 @@ namespace h5pp {
                 if(is_regular < 0) throw h5pp::runtime_error("Failed to query hyperslab type in space");
                 if(not is_regular) {
                     throw h5pp::runtime_error("The space has irregular (non-rectangular) hyperslab selection.\n"
-                                              "This is not yet supported by h5pp");
+                                              "Use h5pp::Selection to read it instead");
                 }
 #endif
                 offset = std::vector<hsize_t>(type::safe_cast<size_t>(rank), 0);
@@ -6,6 +6,7 @@
 #include "h5ppHyperslab.h"
 #include "h5ppLogger.h"
 #include "h5ppOptional.h"
+#include "h5ppPropertyLists.h"
 #include "h5ppType.h"
 #include <hdf5.h>
 #include <numeric>
@@ -99,7 +100,11 @@ namespace h5pp {
         std::optional<hid::h5t>         h5Type        = std::nullopt; /*!< (On create) Type of dataset. Override automatic type detection. */
         std::optional<H5D_layout_t>     h5Layout      = std::nullopt; /*!< (On create) Layout of dataset. Choose between H5D_CHUNKED,H5D_COMPACT and H5D_CONTIGUOUS */
         std::optional<int>              compression   = std::nullopt; /*!< (On create) Compression level 0-9, 0 = off, 9 is gives best compression and is slowest */
-        std::optional<h5pp::ResizePolicy> resizePolicy    = std::nullopt; /*!< Type of resizing if needed. Choose GROW, TO_FIT,OFF */
+        std::optional<h5pp::ResizePolicy> resizePolicy    = std::nullopt; /*!< Type of resizing if needed. Choose GROW, FIT, OFF, REPLACE */
+        std::optional<h5pp::AccessHint> accessHint    = std::nullopt; /*!< (On create) Expected access pattern. Used to choose chunk dimensions */
+        std::optional<size_t>           accessAxis    = std::nullopt; /*!< (On create) Axis along which data is appended, for AccessHint::APPEND (default 0) */
+        std::optional<h5pp::LayoutPolicy> layoutPolicy  = std::nullopt; /*!< (On create) Overrides the layout policy of the file, used when h5Layout is not given */
+        std::optional<h5pp::XferBufferPolicy> xferBufferPolicy = std::nullopt; /*!< Overrides the type-conversion buffer policy of the file in this transfer */
         /* clang-format on */
         [[nodiscard]] std::string string(bool enable = true) const {
             if(not enable) return {};
@@ -116,6 +121,8 @@ namespace h5pp {
                 }
             }
             if(dsetChunkDims) msg.append(h5pp::format(" | chunk dims {}", dsetChunkDims.value()));
+            if(accessHint) msg.append(h5pp::format(" | access hint {}", enum2str(accessHint.value())));
+            if(accessAxis) msg.append(h5pp::format(" | access axis {}", accessAxis.value()));
             if (dataSlab) msg.append(h5pp::format(" | memory hyperslab {}", dataSlab->string()));
             if (dsetSlab) msg.append(h5pp::format(" | file hyperslab {}", dsetSlab->string()));
             return msg;
@@ -336,6 +343,8 @@ namespace h5pp {
         std::optional<Hyperslab>          dsetSlab     = std::nullopt;
         std::optional<h5pp::ResizePolicy> resizePolicy = std::nullopt;
         std::optional<int>                compression  = std::nullopt;
+        std::optional<XferBufferPolicy>   xferBufferPolicy = std::nullopt; // overrides PropertyLists::xferBufferPolicy
+        std::optional<std::string>        layoutReason = std::nullopt; // why h5Layout was chosen for a new dataset
         std::optional<std::string>        cppTypeName  = std::nullopt;
         std::optional<size_t>             cppTypeSize  = std::nullopt;
         std::optional<std::type_index>    cppTypeIndex = std::nullopt;
@@ -457,6 +466,7 @@ namespace h5pp {
                     default: break;
                 }
             }
+            if(layoutReason) msg.append(h5pp::format(" ({})", layoutReason.value()));
             if(dsetChunk)   msg.append(h5pp::format(" | chunk dims {}", dsetChunk.value()));
             if(dsetDimsMax){
                 std::vector<long> dsetDimsMaxPretty;
@@ -480,6 +490,7 @@ namespace h5pp {
                     case ResizePolicy::FIT: msg.append(h5pp::format("FIT")); break;
                     case ResizePolicy::GROW: msg.append(h5pp::format("GROW")); break;
                     case ResizePolicy::OFF: msg.append(h5pp::format("OFF")); break;
+                    case ResizePolicy::REPLACE: msg.append(h5pp::format("REPLACE")); break;
                     default: break;
                 }
             }
@@ -897,4 +908,43 @@ namespace h5pp {
             return msg;
         }
     };
+
+    /*! Controls how h5pp::hdf5::repackFile copies chunked datasets */
+    struct RepackOptions {
+        std::optional<int> compression  = std::nullopt; /*!< Deflate level (0-9) of the copied datasets. Default keeps the source filters */
+        size_t             numThreads   = 0;            /*!< Threads used to (re)compress chunks. 0 uses std::thread::hardware_concurrency() */
+        bool               rawChunkCopy = true;         /*!< Copy chunks verbatim when the filters match. Disable to always pass data through HDF5 */
+    };
+
+    /*! Summary of a file copy made by h5pp::hdf5::repackFile */
+    struct CopyReport {
+        size_t numLinks              = 0; /*!< Number of links copied */
+        size_t numDatasets           = 0; /*!< Number of datasets copied chunk by chunk */
+        size_t numObjectCopies       = 0; /*!< Number of objects copied whole with H5Ocopy */
+        size_t numRawChunks          = 0; /*!< Number of chunks copied verbatim */
+        size_t numRecompressedChunks = 0; /*!< Number of chunks recompressed in worker threads */
+        size_t numFilteredChunks     = 0; /*!< Number of chunks passed through the HDF5 filter pipeline */
+        size_t bytesRead             = 0; /*!< Storage bytes of the copied datasets in the source file */
+        size_t bytesWritten          = 0; /*!< Storage bytes of the copied datasets in the target file */
+        double seconds               = 0; /*!< Wall time of the copy */
+        /*! Returns the number of source bytes copied per second */
+        [[nodiscard]] double throughput() const {
+            return seconds > 0 ? static_cast<double>(bytesRead) / seconds : 0.0;
+        }
+        [[nodiscard]] std::string string(bool enable = true) const {
+            if(not enable) return {};
+            return h5pp::format("links {} | datasets {} | objects {} | chunks raw {} recompressed {} filtered {} | read {} bytes | "
+                                "written {} bytes | time {} s | throughput {} MB/s",
+                                numLinks,
+                                numDatasets,
+                                numObjectCopies,
+                                numRawChunks,
+                                numRecompressedChunks,
+                                numFilteredChunks,
+                                bytesRead,
+                                bytesWritten,
+                                seconds,
+                                throughput() / 1e6);
+        }
+    };
 }
@@ -0,0 +1,319 @@
+#pragma once
+#include "h5ppEnums.h"
+#include "h5ppExcept.h"
+#include "h5ppFilesystem.h"
+#include "h5ppFormat.h"
+#include "h5ppHdf5.h"
+#include "h5ppHid.h"
+#include "h5ppLinkSearch.h"
+#include "h5ppLogger.h"
+#include "h5ppPathPattern.h"
+#include "h5ppPropertyLists.h"
+#include "h5ppType.h"
+#include "h5ppTypeCast.h"
+#include <algorithm>
+#include <cstdint>
+#include <fstream>
+#include <hdf5.h>
+#include <numeric>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace h5pp {
+    /*! Summary of one link in a h5pp::LinkIndex */
+    struct LinkIndexEntry {
+        std::string              path;                        /*!< Path relative to the file root, as returned by File::findLinks */
+        H5O_type_t               objType  = H5O_TYPE_UNKNOWN; /*!< Type of the linked object. H5O_TYPE_UNKNOWN for dangling and external links */
+        H5L_type_t               linkType = H5L_TYPE_HARD;    /*!< Hard, soft or external link */
+        std::vector<hsize_t>     dims;                        /*!< Dimensions of a dataset */
+        std::string              typeName;                    /*!< HDF5 type of a dataset, e.g. H5T_NATIVE_DOUBLE */
+        std::vector<std::string> attributes;                  /*!< Names of the attributes on the object */
+
+        /*! Number of '/' in the path */
+        [[nodiscard]] long depth() const { return static_cast<long>(std::count(path.begin(), path.end(), '/')); }
+    };
+
+    /*! A search in a h5pp::LinkIndex. The fields mirror h5pp::LinkSearch */
+    struct LinkQuery {
+        std::string pattern;                      /*!< Text to match. Empty matches all */
+        LinkMatch   match          = LinkMatch::SUBSTRING; /*!< How pattern is matched */
+        H5O_type_t  objType        = H5O_TYPE_UNKNOWN;     /*!< Type of object to match. H5O_TYPE_UNKNOWN matches any type */
+        std::string searchRoot     = "/";         /*!< Group to search from */
+        long        maxHits        = -1;          /*!< Stop after this many matches. Negative for no limit */
+        long        maxDepth       = -1;          /*!< Levels to descend below searchRoot. 0 searches searchRoot only. Negative for no limit */
+        bool        followSymlinks = false;       /*!< Also match soft and external links */
+    };
+
+    namespace internal {
+        /*! Orders paths like a depth-first traversal in name order: '/' sorts before every other character */
+        [[nodiscard]] inline bool pathLess(std::string_view lhs, std::string_view rhs) {
+            return std::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end(), [](char l, char r) {
+                auto rank = [](char c) { return c == '/' ? 0u : static_cast<unsigned>(static_cast<unsigned char>(c)) + 1u; };
+                return rank(l) < rank(r);
+            });
+        }
+
+        template<typename T>
+        void writePod(std::ostream &out, const T &value) {
+            out.write(reinterpret_cast<const char *>(&value), sizeof(T));
+        }
+        template<typename T>
+        void readPod(std::istream &in, T &value) {
+            in.read(reinterpret_cast<char *>(&value), sizeof(T));
+        }
+        inline void writeString(std::ostream &out, std::string_view str) {
+            writePod(out, static_cast<uint32_t>(str.size()));
+            out.write(str.data(), static_cast<std::streamsize>(str.size()));
+        }
+        inline void readString(std::istream &in, std::string &str) {
+            uint32_t len = 0;
+            readPod(in, len);
+            if(not in) return;
+            str.resize(len);
+            in.read(str.data(), static_cast<std::streamsize>(len));
+        }
+    }
+
+    /*!
+     * \brief An index of all the links in a file, for fast repeated searches.
+     *
+     * The index records the path, object type, link type, dataset dimensions and type, and attribute names of every link
+     * found by File::findLinks with followSymlinks. Searches then only look at the index, which keeps the paths sorted such
+     * that the links under a group, or with a common prefix, are adjacent. A group that is reached through several hard links is
+     * indexed once, under the first path found.
+     *
+     * The index can be saved next to the file, and is only loaded again if the size and modification time of the file are
+     * unchanged. Normally one gets it from h5pp::File::getLinkIndex, which does this.
+     */
+    class LinkIndex {
+        public:
+        uintmax_t fileSize = 0; /*!< Size of the file when the index was built */
+        int64_t   fileTime = 0; /*!< Modification time of the file when the index was built */
+
+        /*! Returns all entries, in the order File::findLinks finds them */
+        [[nodiscard]] const std::vector<LinkIndexEntry> &getEntries() const { return entries; }
+
+        /*! Returns the path of the index file saved next to filePath */
+        [[nodiscard]] static fs::path sidecarPath(const fs::path &filePath) { return fs::path(filePath.string() + ".h5pp-index"); }
+
+        /*! Returns the size and modification time of a file */
+        [[nodiscard]] static std::pair<uintmax_t, int64_t> fileStamp(const fs::path &filePath) {
+            return {fs::file_size(filePath), static_cast<int64_t>(fs::last_write_time(filePath).time_since_epoch().count())};
+        }
+
+        /*! True if filePath has not changed since the index was built */
+        [[nodiscard]] bool isCurrent(const fs::path &filePath) const {
+            if(not fs::exists(filePath)) return false;
+            return fileStamp(filePath) == std::make_pair(fileSize, fileTime);
+        }
+
+        /*! Indexes every link in the file that filePath refers to */
+        [[nodiscard]] static LinkIndex build(const hid::h5f &file, const fs::path &filePath, const PropertyLists &plists = PropertyLists::defaults()) {
+            LinkIndex index;
+            std::tie(index.fileSize, index.fileTime) = fileStamp(filePath);
+            LinkSearch search;
+            search.followSymlinks = true;
+            hdf5::findLinks<H5O_TYPE_UNKNOWN>(
+                file,
+                search,
+                [&](std::string_view linkPath) {
+                    index.entries.emplace_back(describe(file, std::string(linkPath), plists));
+                    return true;
+                },
+                plists);
+            index.sortPaths();
+            h5pp::logger::log->debug("Indexed {} links in file [{}]", index.entries.size(), filePath.string());
+            return index;
+        }
+
+        /*! Writes the index to indexPath */
+        void save(const fs::path &indexPath) const {
+            std::ofstream out(indexPath, std::ios::binary | std::ios::trunc);
+            if(not out) throw h5pp::runtime_error("Failed to open link index [{}] for writing", indexPath.string());
+            out.write(magic.data(), static_cast<std::streamsize>(magic.size()));
+            internal::writePod(out, static_cast<uint64_t>(fileSize));
+            internal::writePod(out, fileTime);
+            internal::writePod(out, static_cast<uint64_t>(entries.size()));
+            for(const auto &entry : entries) {
+                internal::writeString(out, entry.path);
+                internal::writePod(out, static_cast<int32_t>(entry.objType));
+                internal::writePod(out, static_cast<int32_t>(entry.linkType));
+                internal::writePod(out, static_cast<uint32_t>(entry.dims.size()));
+                for(const auto &dim : entry.dims) internal::writePod(out, static_cast<uint64_t>(dim));
+                internal::writeString(out, entry.typeName);
+                internal::writePod(out, static_cast<uint32_t>(entry.attributes.size()));
+                for(const auto &attr : entry.attributes) internal::writeString(out, attr);
+            }
+            if(not out) throw h5pp::runtime_error("Failed to write link index [{}]", indexPath.string());
+        }
+
+        /*! Reads an index from indexPath. Returns std::nullopt if it is missing, unreadable, or older than filePath */
+        [[nodiscard]] static std::optional<LinkIndex> load(const fs::path &indexPath, const fs::path &filePath) {
+            std::ifstream in(indexPath, std::ios::binary);
+            if(not in) return std::nullopt;
+            std::string header(magic.size(), '\0');
+            in.read(header.data(), static_cast<std::streamsize>(header.size()));
+            if(not in or header != magic) return std::nullopt;
+            LinkIndex index;
+            uint64_t  size = 0, num = 0;
+            internal::readPod(in, size);
+            internal::readPod(in, index.fileTime);
+            internal::readPod(in, num);
+            index.fileSize = type::safe_cast<uintmax_t>(size);
+            if(not in or not index.isCurrent(filePath)) return std::nullopt;
+            for(uint64_t i = 0; i < num and in; ++i) {
+                LinkIndexEntry entry;
+                int32_t        objType = 0, linkType = 0;
+                uint32_t       rank = 0, numAttrs = 0;
+                internal::readString(in, entry.path);
+                internal::readPod(in, objType);
+                internal::readPod(in, linkType);
+                internal::readPod(in, rank);
+                entry.objType  = static_cast<H5O_type_t>(objType);
+                entry.linkType = static_cast<H5L_type_t>(linkType);
+                for(uint32_t d = 0; d < rank and in; ++d) {
+                    uint64_t dim = 0;
+                    internal::readPod(in, dim);
+                    entry.dims.push_back(type::safe_cast<hsize_t>(dim));
+                }
+                internal::readString(in, entry.typeName);
+                internal::readPod(in, numAttrs);
+                for(uint32_t a = 0; a < numAttrs and in; ++a) internal::readString(in, entry.attributes.emplace_back());
+                index.entries.emplace_back(std::move(entry));
+            }
+            if(not in or index.entries.size() != num) return std::nullopt;
+            index.sortPaths();
+            return index;
+        }
+
+        /*! Returns the entry of linkPath, or nullptr if there is none */
+        [[nodiscard]] const LinkIndexEntry *get(std::string_view linkPath) const {
+            linkPath = trimSlashes(linkPath);
+            auto it  = lowerBound(linkPath);
+            return it != sorted.end() and entries[*it].path == linkPath ? &entries[*it] : nullptr;
+        }
+
+        /*! Returns the entries that match query, in the same order as File::findLinks */
+        [[nodiscard]] std::vector<const LinkIndexEntry *> find(const LinkQuery &query) const {
+            std::vector<const LinkIndexEntry *> matches;
+            auto                                root = trimSlashes(query.searchRoot);
+            if(not root.empty() and get(root) == nullptr)
+                throw h5pp::runtime_error("Cannot find links inside group [{}]: it is not in the index", query.searchRoot);
+            std::string prefix(root);
+            if(not prefix.empty()) prefix.push_back('/');
+            // Prefix, glob and regex patterns narrow down the range of entries to look at
+            PathPattern pattern;
+            if(query.match == LinkMatch::PREFIX) prefix.append(trimSlashes(query.pattern, true));
+            if(query.match == LinkMatch::GLOB or query.match == LinkMatch::REGEX) {
+                pattern = PathPattern(query.pattern, query.match);
+                prefix.append(pattern.literalPrefix());
+            }
+            std::vector<size_t> found;
+            for(auto it = lowerBound(prefix); it != sorted.end() and std::string_view(entries[*it].path).substr(0, prefix.size()) == prefix; ++it) {
+                const auto      &entry   = entries[*it];
+                std::string_view relPath = std::string_view(entry.path).substr(root.empty() ? 0 : root.size() + 1);
+                if(not query.followSymlinks and entry.linkType != H5L_TYPE_HARD) continue;
+                if(query.objType != H5O_TYPE_UNKNOWN and entry.objType != query.objType) continue;
+                auto depth = std::count(relPath.begin(), relPath.end(), '/');
+                if(query.maxDepth >= 0 and depth > query.maxDepth) continue;
+                if(not isMatch(query, pattern, relPath)) continue;
+                found.emplace_back(*it);
+            }
+            // Back to the order of the traversal
+            std::sort(found.begin(), found.end());
+            if(query.maxHits > 0 and type::safe_cast<long>(found.size()) > query.maxHits) found.resize(type::safe_cast<size_t>(query.maxHits));
+            for(const auto &idx : found) matches.emplace_back(&entries[idx]);
+            return matches;
+        }
+
+        /*! As File::findLinks, answered from the index */
+        [[nodiscard]] std::vector<std::string> findLinks(std::string_view searchKey      = "",
+                                                         std::string_view searchRoot     = "/",
+                                                         long             maxHits        = -1,
+                                                         long             maxDepth       = -1,
+                                                         bool             followSymlinks = false,
+                                                         H5O_type_t       objType        = H5O_TYPE_UNKNOWN) const {
+            LinkQuery query;
+            query.pattern        = searchKey;
+            query.searchRoot     = searchRoot;
+            query.maxHits        = maxHits;
+            query.maxDepth       = maxDepth;
+            query.followSymlinks = followSymlinks;
+            query.objType        = objType;
+            auto                     root = trimSlashes(searchRoot);
+            std::vector<std::string> paths;
+            for(const auto *entry : find(query)) paths.emplace_back(entry->path.substr(root.empty() ? 0 : root.size() + 1));
+            return paths;
+        }
+
+        private:
+        static constexpr std::string_view magic = "h5pp-link-index-v1";
+        std::vector<LinkIndexEntry>       entries; /*!< In the order File::findLinks finds them */
+        std::vector<size_t>               sorted;  /*!< Indices of entries, sorted by path with internal::pathLess */
+
+        void sortPaths() {
+            sorted.resize(entries.size());
+            std::iota(sorted.begin(), sorted.end(), 0);
+            std::sort(sorted.begin(), sorted.end(), [this](size_t lhs, size_t rhs) { return internal::pathLess(entries[lhs].path, entries[rhs].path); });
+        }
+
+        [[nodiscard]] std::vector<size_t>::const_iterator lowerBound(std::string_view path) const {
+            return std::lower_bound(sorted.begin(), sorted.end(), path, [this](size_t idx, std::string_view p) {
+                return internal::pathLess(entries[idx].path, p);
+            });
+        }
+
+        [[nodiscard]] static std::string_view trimSlashes(std::string_view path, bool keepTrailing = false) {
+            while(not path.empty() and path.front() == '/') path.remove_prefix(1);
+            if(path == ".") path.remove_prefix(1);
+            while(not keepTrailing and not path.empty() and path.back() == '/') path.remove_suffix(1);
+            return path;
+        }
+
+        /*! Matches relPath, the path relative to the search root, against the query pattern, compiled in pattern for globs and regexes */
+        [[nodiscard]] static bool isMatch(const LinkQuery &query, const PathPattern &pattern, std::string_view relPath) {
+            if(query.pattern.empty()) return true;
+            switch(query.match) {
+                case LinkMatch::SUBSTRING: {
+                    // As findLinks: the last path component, including its leading '/' below the first level
+                    auto slash = relPath.rfind('/');
+                    return relPath.substr(slash == std::string_view::npos ? 0 : slash).find(query.pattern) != std::string_view::npos;
+                }
+                case LinkMatch::PREFIX: return relPath.substr(0, trimSlashes(query.pattern, true).size()) == trimSlashes(query.pattern, true);
+                case LinkMatch::GLOB:
+                case LinkMatch::REGEX: return pattern.matches(relPath);
+            }
+            return false;
+        }
+
+        [[nodiscard]] static LinkIndexEntry describe(const hid::h5f &file, std::string linkPath, const PropertyLists &plists) {
+            LinkIndexEntry entry;
+            entry.path = std::move(linkPath);
+            H5L_info_t lInfo;
+            if(H5Lget_info(file, entry.path.c_str(), &lInfo, plists.linkAccess) < 0)
+                throw h5pp::runtime_error("Failed to read link info of [{}]", entry.path);
+            entry.linkType = lInfo.type;
+            // External links are not followed: that would open other files
+            if(entry.linkType == H5L_TYPE_EXTERNAL) return entry;
+            H5O_info_t oInfo;
+            if(hdf5::internal::getObjInfoBasic(file, entry.path.c_str(), oInfo, plists.linkAccess) < 0) return entry; // Dangling
+            entry.objType = oInfo.type;
+            hid::h5o obj  = H5Oopen(file, entry.path.c_str(), plists.linkAccess);
+            if(entry.objType == H5O_TYPE_DATASET) {
+                hid::h5s space = H5Dget_space(obj);
+                hid::h5t dtype = H5Dget_type(obj);
+                int      rank  = H5Sget_simple_extent_ndims(space);
+                if(rank < 0) throw h5pp::runtime_error("Failed to read the rank of dataset [{}]", entry.path);
+                entry.dims.resize(type::safe_cast<size_t>(rank));
+                if(rank > 0 and H5Sget_simple_extent_dims(space, entry.dims.data(), nullptr) < 0)
+                    throw h5pp::runtime_error("Failed to read the dimensions of dataset [{}]", entry.path);
+                entry.typeName = type::getH5TypeName(dtype);
+                if(entry.typeName.empty()) entry.typeName = type::getH5ClassName(dtype);
+            }
+            entry.attributes = hdf5::getAttributeNames(obj);
+            return entry;
+        }
+    };
+}
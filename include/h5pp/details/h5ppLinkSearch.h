@@ -0,0 +1,445 @@
+#pragma once
+#include "h5ppExcept.h"
+#include "h5ppFormat.h"
+#include "h5ppHid.h"
+#include "h5ppLinkView.h"
+#include "h5ppLogger.h"
+#include "h5ppPathPattern.h"
+#include "h5ppPropertyLists.h"
+#include "h5ppTypeCast.h"
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <exception>
+#include <functional>
+#include <hdf5.h>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <unordered_set>
+#include <vector>
+
+#if !defined(H5PP_HAS_FORK)
+    #if(defined(__unix__) || defined(__APPLE__)) && __has_include(<unistd.h>) && __has_include(<sys/mman.h>)
+        #define H5PP_HAS_FORK 1
+    #else
+        #define H5PP_HAS_FORK 0
+    #endif
+#endif
+
+#if H5PP_HAS_FORK == 1
+    #include <atomic>
+    #include <cerrno>
+    #include <csignal>
+    #include <new>
+    #include <poll.h>
+    #include <sys/mman.h>
+    #include <sys/wait.h>
+    #include <unistd.h>
+#endif
+
+namespace h5pp {
+    /*! Receives the path of each link found by a search, relative to the search root. Return false to stop the search */
+    using LinkCallback = std::function<bool(std::string_view linkPath)>;
+
+    /*!
+     * \brief Options for searching links with h5pp::File::findLinks, findDatasets and findGroups.
+     *
+     * With numWorkers > 1 the groups directly under searchRoot are handed out to forked worker processes, which search
+     * them and stream their matches back through pipes. The callback always runs in the calling process, but the matches
+     * then arrive in no particular order, and an object that is hard-linked under two of those groups may be reported once
+     * for each. The workers only read the file, which is flushed before they start, and other threads must not use HDF5
+     * while they are forked. Worker processes are only used on POSIX systems, for files opened with the sec2 or core
+     * drivers. Otherwise the search runs serially.
+     *
+     * A pattern is matched one level at a time while the search descends: groups that cannot lead to a match are not
+     * entered, and levels where the pattern names fixed links are looked up directly instead of iterated over.
+     */
+    struct LinkSearch {
+        std::string searchKey;              /*!< Matches links whose name (last path component) contains this. Empty matches all */
+        std::string searchRoot     = "/";   /*!< Group to search from */
+        long        maxHits        = -1;    /*!< Stop after this many matches. Negative for no limit */
+        long        maxDepth       = -1;    /*!< Levels to descend below searchRoot. 0 searches searchRoot only. Negative for no limit */
+        bool        followSymlinks = false; /*!< Also match soft and external links. Their targets are never searched */
+        size_t      numWorkers     = 1;     /*!< Worker processes. 1 searches serially, 0 uses std::thread::hardware_concurrency() */
+        PathPattern pattern;                /*!< Matches the whole path relative to searchRoot, together with searchKey. Empty matches all */
+    };
+}
+
+namespace h5pp::hdf5::internal {
+    /*! Returns a key that identifies the object of info within its file */
+    [[nodiscard]] inline std::string getObjKey(const H5O_info_t &info) {
+#if defined(H5Oget_info_vers) && H5Oget_info_vers >= 3
+        return {reinterpret_cast<const char *>(&info.token), sizeof(info.token)};
+#else
+        return {reinterpret_cast<const char *>(&info.addr), sizeof(info.addr)};
+#endif
+    }
+
+    inline herr_t getObjInfoBasic(hid_t loc, const char *name, H5O_info_t &info, hid_t lapl) {
+#if defined(H5Oget_info_vers) && H5Oget_info_vers >= 2
+        return H5Oget_info_by_name(loc, name, &info, H5O_INFO_BASIC, lapl);
+#else
+        return H5Oget_info_by_name(loc, name, &info, lapl);
+#endif
+    }
+
+    /*! Key of a group in LinkVisitor::visited. A group reached again in another pattern state may hold other matches */
+    [[nodiscard]] inline std::string getVisitKey(const H5O_info_t &info, const PathPattern::State &state) {
+        auto key = getObjKey(info);
+        key.append(reinterpret_cast<const char *>(state.data()), state.size() * sizeof(size_t));
+        return key;
+    }
+
+    /*! State of one search through the link hierarchy. Each search has its own, which keeps searches reentrant */
+    struct LinkVisitor {
+        const LinkSearch                &search;
+        H5O_type_t                       objType; /*!< Type of object to match. H5O_TYPE_UNKNOWN matches any type */
+        const LinkViewCallback          &callback;
+        const PropertyLists             &plists;
+        std::string                      path;               /*!< Path of the current link, relative to the search root */
+        long                             depth = 0;          /*!< Number of '/' in path */
+        long                             hits  = 0;          /*!< Matches passed to the callback */
+        std::vector<PathPattern::State>  states;             /*!< Pattern state of the search root and each group on the current path */
+        std::unordered_set<std::string>  visited;            /*!< Groups with several hard links that have been entered already */
+        std::vector<std::string>        *deferred = nullptr; /*!< When set, groups directly under the root are collected here instead of entered */
+        std::exception_ptr               error;
+    };
+
+    inline herr_t visitLink(hid_t group, const char *name, const H5L_info_t *info, void *opdata);
+
+    /*! Visits the links in group. When the pattern allows only fixed names at this level, just those links are looked up */
+    inline herr_t iterateGroup(hid_t group, LinkVisitor &v) {
+        const auto &pattern = v.search.pattern;
+        if(pattern.empty()) return H5Literate(group, H5_INDEX_NAME, H5_ITER_NATIVE, nullptr, visitLink, &v);
+        auto literals = pattern.nextLiterals(v.states.back());
+        if(not literals) return H5Literate(group, H5_INDEX_NAME, H5_ITER_NATIVE, nullptr, visitLink, &v);
+        for(const auto &literal : literals.value()) {
+            std::string name(literal);
+            htri_t      exists = H5Lexists(group, name.c_str(), v.plists.linkAccess);
+            if(exists < 0) throw h5pp::runtime_error("Failed to check link [{}] in [{}]", name, v.path);
+            if(exists == 0) continue;
+            H5L_info_t info;
+            if(H5Lget_info(group, name.c_str(), &info, v.plists.linkAccess) < 0)
+                throw h5pp::runtime_error("Failed to read link info of [{}] in [{}]", name, v.path);
+            herr_t ret = visitLink(group, name.c_str(), &info, &v);
+            if(ret != 0) return ret;
+        }
+        return 0;
+    }
+
+    /*! Searches the group at loc/name, whose path relative to the search root is already in v.path */
+    inline herr_t visitGroup(hid_t loc, const char *name, LinkVisitor &v) {
+        hid_t gid = H5Gopen(loc, name, v.plists.groupAccess);
+        if(gid < 0) throw h5pp::runtime_error("Failed to open group [{}]", v.path);
+        hid::h5g group = gid;
+        v.path.push_back('/');
+        v.depth++;
+        herr_t ret = iterateGroup(group, v);
+        v.depth--;
+        v.path.pop_back();
+        return ret;
+    }
+
+    inline herr_t visitObject(hid_t group, const char *name, const H5L_info_t *info, LinkVisitor &v) {
+        bool isSymlink = info->type == H5L_TYPE_SOFT or info->type == H5L_TYPE_EXTERNAL;
+        // The key is matched against the last path component, including its leading '/' below the first level
+        std::string_view linkName = v.path;
+        linkName.remove_prefix(v.path.size() - std::strlen(name) - (v.depth > 0 ? 1 : 0));
+        bool nameMatch  = v.search.searchKey.empty() or linkName.find(v.search.searchKey) != std::string_view::npos;
+        bool canDescend = not isSymlink and (v.search.maxDepth < 0 or v.depth < v.search.maxDepth);
+
+        // The pattern prunes groups that cannot lead to a match, before their object header is even read
+        const auto        &pattern = v.search.pattern;
+        PathPattern::State state;
+        if(not pattern.empty()) {
+            state      = pattern.advance(v.states.back(), name);
+            nameMatch  = nameMatch and pattern.accepts(state);
+            canDescend = canDescend and pattern.canContinue(state);
+        } else if(canDescend) {
+            state = v.states.back();
+        }
+
+        // Peeking at the object type costs an object header read: skip it when neither the match nor the descent needs it
+        H5O_info_t oInfo;
+        bool       hasInfo = false;
+        if((nameMatch and v.objType != H5O_TYPE_UNKNOWN) or canDescend) {
+            hasInfo = getObjInfoBasic(group, name, oInfo, v.plists.linkAccess) >= 0;
+            if(not hasInfo and not isSymlink) throw h5pp::runtime_error("Failed to read object info of link [{}]", v.path);
+            if(not hasInfo) return 0; // A dangling soft or external link
+        }
+        if(nameMatch and (v.objType == H5O_TYPE_UNKNOWN or oInfo.type == v.objType)) {
+            v.hits++;
+            if(not v.callback(LinkView(group, name, v.path, v.plists.linkAccess, info, hasInfo ? &oInfo : nullptr))) return 1;
+            if(v.search.maxHits > 0 and v.hits >= v.search.maxHits) return 1;
+        }
+        if(canDescend and hasInfo and oInfo.type == H5O_TYPE_GROUP) {
+            // Groups with more than one hard link may be reached twice, or form a cycle
+            if(oInfo.rc > 1 and not v.visited.insert(getVisitKey(oInfo, state)).second) return 0;
+            if(v.deferred != nullptr and v.depth == 0) {
+                v.deferred->emplace_back(name);
+                return 0;
+            }
+            v.states.emplace_back(std::move(state));
+            auto ret = visitGroup(group, name, v);
+            v.states.pop_back();
+            return ret;
+        }
+        return 0;
+    }
+
+    inline herr_t visitLink(hid_t group, const char *name, const H5L_info_t *info, void *opdata) {
+        auto &v         = *static_cast<LinkVisitor *>(opdata);
+        bool  isSymlink = info->type == H5L_TYPE_SOFT or info->type == H5L_TYPE_EXTERNAL;
+        if(isSymlink and not v.search.followSymlinks) return 0;
+        auto prefixSize = v.path.size();
+        v.path.append(name);
+        herr_t ret = -1;
+        try {
+            ret = visitObject(group, name, info, v);
+        } catch(...) { v.error = std::current_exception(); }
+        v.path.resize(prefixSize);
+        return ret;
+    }
+
+    /*! Searches the group root/name, one of the groups directly under the search root */
+    inline herr_t visitTopGroup(hid_t root, const std::string &name, LinkVisitor &v) {
+        const auto &pattern = v.search.pattern;
+        v.path              = name;
+        v.states.emplace_back(pattern.empty() ? v.states.back() : pattern.advance(v.states.back(), name));
+        auto ret = visitGroup(root, name.c_str(), v);
+        v.states.pop_back();
+        v.path.clear();
+        if(v.error) std::rethrow_exception(v.error);
+        if(ret < 0) throw h5pp::runtime_error("Failed to search links in group [{}]", name);
+        return ret;
+    }
+
+#if H5PP_HAS_FORK == 1
+    /*! Worker processes of a forked link search. Any that are still running when this goes out of scope are killed */
+    class LinkWorkers {
+        public:
+        struct Worker {
+            pid_t       pid = -1;
+            int         fd  = -1;
+            std::string buffer;
+        };
+        std::vector<Worker>  workers;
+        std::atomic<size_t> *next = nullptr; /*!< Index of the next group to search, shared by all the workers */
+
+        LinkWorkers() {
+            void *shared = mmap(nullptr, sizeof(std::atomic<size_t>), PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+            if(shared == MAP_FAILED) throw h5pp::runtime_error("Failed to map memory for link search workers: {}", std::strerror(errno));
+            next = new(shared) std::atomic<size_t>(0);
+        }
+        LinkWorkers(const LinkWorkers &)            = delete;
+        LinkWorkers &operator=(const LinkWorkers &) = delete;
+        ~LinkWorkers() {
+            wait(true);
+            munmap(static_cast<void *>(next), sizeof(std::atomic<size_t>));
+        }
+
+        /*! Reaps the workers, killing them first if asked. Returns false if a worker ended abnormally */
+        bool wait(bool kill) {
+            bool ok = true;
+            for(auto &w : workers) {
+                if(w.fd >= 0) close(w.fd);
+                w.fd = -1;
+                if(w.pid <= 0) continue;
+                if(kill) ::kill(w.pid, SIGKILL);
+                int status = 0;
+                while(waitpid(w.pid, &status, 0) < 0 and errno == EINTR) {}
+                ok = ok and WIFEXITED(status) and WEXITSTATUS(status) == 0;
+                w.pid = -1;
+            }
+            return ok;
+        }
+    };
+
+    // Records sent from the workers: a tag byte, a 32-bit length and the payload
+    inline constexpr char linkRecord  = 'L';
+    inline constexpr char errorRecord = 'E';
+
+    inline void appendRecord(std::string &out, char tag, std::string_view payload) {
+        auto len = static_cast<uint32_t>(payload.size());
+        out.push_back(tag);
+        out.append(reinterpret_cast<const char *>(&len), sizeof(len));
+        out.append(payload);
+    }
+
+    inline bool writeAll(int fd, std::string &out) {
+        size_t pos = 0;
+        while(pos < out.size()) {
+            auto n = ::write(fd, out.data() + pos, out.size() - pos);
+            if(n < 0 and errno == EINTR) continue;
+            if(n <= 0) return false;
+            pos += static_cast<size_t>(n);
+        }
+        out.clear();
+        return true;
+    }
+
+    /*! Body of a worker process: searches groups until there are none left, and never returns */
+    [[noreturn]] inline void runLinkWorker(hid_t root, const std::vector<std::string> &groups, LinkWorkers &pool, const LinkVisitor &parent, int fd) {
+        std::string      out;
+        bool             open = true;
+        LinkViewCallback emit = [&](const LinkView &link) {
+            appendRecord(out, linkRecord, link.path());
+            if(out.size() >= 65536) open = writeAll(fd, out);
+            return open;
+        };
+        LinkVisitor v{parent.search, parent.objType, emit, parent.plists};
+        v.hits    = parent.hits;
+        v.states  = parent.states;
+        v.visited = parent.visited;
+        int status = 0;
+        try {
+            for(size_t i = pool.next->fetch_add(1); i < groups.size(); i = pool.next->fetch_add(1))
+                if(visitTopGroup(root, groups[i], v) > 0) break;
+        } catch(const std::exception &ex) {
+            appendRecord(out, errorRecord, ex.what());
+            status = 1;
+        }
+        if(open) writeAll(fd, out);
+        _exit(status);
+    }
+
+    /*! Forking is only safe when the file driver reads with pread, or from memory */
+    [[nodiscard]] inline bool canForkLinkSearch(hid_t loc) {
+    #if defined(H5_HAVE_PREADWRITE)
+        hid::h5f file   = H5Iget_file_id(loc);
+        hid::h5p fapl   = H5Fget_access_plist(file);
+        hid_t    driver = H5Pget_driver(fapl);
+        return driver == H5FD_SEC2 or driver == H5FD_CORE;
+    #else
+        return false;
+    #endif
+    }
+
+    /*! Searches the links directly under root here, and the groups among them in worker processes */
+    inline size_t forkLinkSearch(const hid::h5g &root, LinkVisitor &v, size_t numWorkers) {
+        std::vector<std::string> groups;
+        v.deferred = &groups;
+        herr_t ret = iterateGroup(root, v);
+        v.deferred = nullptr;
+        if(v.error) std::rethrow_exception(v.error);
+        if(ret < 0) throw h5pp::runtime_error("Failed to search links in [{}]", v.search.searchRoot);
+        if(ret > 0) return type::safe_cast<size_t>(v.hits);
+        numWorkers = std::min(numWorkers, groups.size());
+        if(numWorkers < 2) {
+            for(const auto &name : groups)
+                if(visitTopGroup(root, name, v) > 0) break;
+            return type::safe_cast<size_t>(v.hits);
+        }
+
+        // The workers read the file as it is on disk, so flush anything the metadata cache holds first
+        hid::h5f file   = H5Iget_file_id(root);
+        unsigned intent = 0;
+        if(H5Fget_intent(file, &intent) < 0) throw h5pp::runtime_error("Failed to read the file intent");
+        if((intent & H5F_ACC_RDWR) != 0 and H5Fflush(file, H5F_SCOPE_LOCAL) < 0)
+            throw h5pp::runtime_error("Failed to flush the file before searching links");
+
+        LinkWorkers pool;
+        for(size_t w = 0; w < numWorkers; ++w) {
+            int fds[2];
+            if(pipe(fds) != 0) throw h5pp::runtime_error("Failed to create a pipe for a link search worker: {}", std::strerror(errno));
+            pid_t pid = fork();
+            if(pid < 0) {
+                close(fds[0]);
+                close(fds[1]);
+                throw h5pp::runtime_error("Failed to fork a link search worker: {}", std::strerror(errno));
+            }
+            if(pid == 0) {
+                close(fds[0]);
+                runLinkWorker(root, groups, pool, v, fds[1]);
+            }
+            close(fds[1]);
+            pool.workers.push_back({pid, fds[0], {}});
+        }
+
+        std::string           error;
+        std::string           linkPath; // Null-terminated copy of each path, for the LinkView
+        bool                  stop = false;
+        std::vector<pollfd>   polls;
+        std::vector<char>     chunk(65536);
+        while(not stop) {
+            polls.clear();
+            for(const auto &w : pool.workers)
+                if(w.fd >= 0) polls.push_back({w.fd, POLLIN, 0});
+            if(polls.empty()) break;
+            if(poll(polls.data(), polls.size(), -1) < 0) {
+                if(errno == EINTR) continue;
+                throw h5pp::runtime_error("Failed to poll link search workers: {}", std::strerror(errno));
+            }
+            for(auto &w : pool.workers) {
+                if(stop or w.fd < 0) continue;
+                auto p = std::find_if(polls.begin(), polls.end(), [&w](const pollfd &pfd) { return pfd.fd == w.fd; });
+                if(p == polls.end() or p->revents == 0) continue;
+                auto n = ::read(w.fd, chunk.data(), chunk.size());
+                if(n < 0 and errno == EINTR) continue;
+                if(n <= 0) {
+                    close(w.fd);
+                    w.fd = -1;
+                    continue;
+                }
+                w.buffer.append(chunk.data(), static_cast<size_t>(n));
+                size_t pos = 0;
+                while(not stop and w.buffer.size() - pos > sizeof(uint32_t)) {
+                    uint32_t len = 0;
+                    std::memcpy(&len, w.buffer.data() + pos + 1, sizeof(len));
+                    if(w.buffer.size() - pos - 1 - sizeof(len) < len) break;
+                    char             tag = w.buffer[pos];
+                    std::string_view payload(w.buffer.data() + pos + 1 + sizeof(len), len);
+                    pos += 1 + sizeof(len) + len;
+                    if(tag == errorRecord) {
+                        error = payload;
+                        stop  = true;
+                    } else {
+                        v.hits++;
+                        linkPath.assign(payload);
+                        if(not v.callback(LinkView(root, linkPath.c_str(), linkPath, v.plists.linkAccess))) stop = true;
+                        if(v.search.maxHits > 0 and v.hits >= v.search.maxHits) stop = true;
+                    }
+                }
+                w.buffer.erase(0, pos);
+            }
+        }
+        bool ok = pool.wait(stop);
+        if(not error.empty()) throw h5pp::runtime_error("Link search worker failed: {}", error);
+        if(not stop and not ok) throw h5pp::runtime_error("A link search worker ended abnormally");
+        return type::safe_cast<size_t>(v.hits);
+    }
+#endif
+
+    /*! Searches links under search.searchRoot, and passes each match to callback. Returns the number of matches */
+    template<typename h5x>
+    inline size_t searchLinks(const h5x              &loc,
+                              H5O_type_t              objType,
+                              const LinkSearch       &search,
+                              const LinkViewCallback &callback,
+                              const PropertyLists    &plists) {
+        hid_t gid = H5Gopen(loc, search.searchRoot.c_str(), plists.groupAccess);
+        if(gid < 0) throw h5pp::runtime_error("Failed to open group [{}] to search links", search.searchRoot);
+        hid::h5g    root = gid;
+        LinkVisitor v{search, objType, callback, plists};
+        v.states.emplace_back(search.pattern.start());
+
+        // A hard link back to the root must not enter it again
+        H5O_info_t rootInfo;
+        if(getObjInfoBasic(root, ".", rootInfo, plists.linkAccess) < 0)
+            throw h5pp::runtime_error("Failed to read object info of group [{}]", search.searchRoot);
+        if(rootInfo.rc > 1) v.visited.insert(getVisitKey(rootInfo, v.states.back()));
+
+        size_t numWorkers = search.numWorkers == 0 ? std::thread::hardware_concurrency() : search.numWorkers;
+        if(numWorkers > 1 and search.maxDepth != 0) {
+#if H5PP_HAS_FORK == 1
+            if(canForkLinkSearch(root)) return forkLinkSearch(root, v, numWorkers);
+#endif
+            h5pp::logger::log->debug("Searching links serially: worker processes are not supported for this file");
+        }
+        herr_t ret = iterateGroup(root, v);
+        if(v.error) std::rethrow_exception(v.error);
+        if(ret < 0) throw h5pp::runtime_error("Failed to search links in [{}]", search.searchRoot);
+        return type::safe_cast<size_t>(v.hits);
+    }
+}
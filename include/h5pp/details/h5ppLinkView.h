@@ -0,0 +1,140 @@
+#pragma once
+#include "h5ppExcept.h"
+#include "h5ppFormat.h"
+#include "h5ppHid.h"
+#include <algorithm>
+#include <functional>
+#include <hdf5.h>
+#include <optional>
+#include <string_view>
+#include <vector>
+
+namespace h5pp {
+    /*!
+     * \brief A link met by File::visitLinks. It refers to the visit in progress and is only valid inside the callback.
+     *
+     * The path points into the buffer of the visit, so nothing is allocated per link. Link and object properties are read
+     * from the file the first time they are asked for, unless the visit has read them already, and then kept.
+     */
+    class LinkView {
+        public:
+        /*! The link named name in loc, found at path relative to the root of the visit. Both strings must outlive the view */
+        LinkView(hid_t loc, const char *name, std::string_view path, hid_t linkAccess, const H5L_info_t *lInfo = nullptr, const H5O_info_t *oInfo = nullptr)
+            : loc(loc), linkName(name), linkPath(path), linkAccess(linkAccess) {
+            if(lInfo != nullptr) this->lInfo = *lInfo;
+            if(oInfo != nullptr) this->oInfo = *oInfo;
+        }
+
+        /*! Path relative to the root of the visit */
+        [[nodiscard]] std::string_view path() const { return linkPath; }
+
+        /*! Last component of the path */
+        [[nodiscard]] std::string_view name() const {
+            auto slash = linkPath.rfind('/');
+            return slash == std::string_view::npos ? linkPath : linkPath.substr(slash + 1);
+        }
+
+        /*! Number of groups between the root of the visit and the link */
+        [[nodiscard]] long depth() const { return static_cast<long>(std::count(linkPath.begin(), linkPath.end(), '/')); }
+
+        [[nodiscard]] H5L_type_t linkType() const { return readLinkInfo().type; }
+        [[nodiscard]] bool       isSymlink() const { return linkType() == H5L_TYPE_SOFT or linkType() == H5L_TYPE_EXTERNAL; }
+
+        /*! Type of the linked object. H5O_TYPE_UNKNOWN if a soft or external link dangles */
+        [[nodiscard]] H5O_type_t objType() const {
+            // Check first, so that reading the header of a missing target does not print an error stack
+            if(not oInfo and isSymlink() and H5Oexists_by_name(loc, linkName, linkAccess) <= 0) return H5O_TYPE_UNKNOWN;
+            return readObjInfo(false).type;
+        }
+
+        /*! Number of hard links to the object */
+        [[nodiscard]] unsigned refCount() const { return readObjInfo(false).rc; }
+
+        /*! Number of attributes on the object */
+        [[nodiscard]] hsize_t numAttrs() const { return readObjInfo(true).num_attrs; }
+
+        /*! Opens the linked object */
+        [[nodiscard]] hid::h5o open() const {
+            hid_t oid = H5Oopen(loc, linkName, linkAccess);
+            if(oid < 0) throw h5pp::runtime_error("Failed to open link [{}]", linkPath);
+            return oid;
+        }
+
+        private:
+        hid_t                             loc;
+        const char                       *linkName;
+        std::string_view                  linkPath;
+        hid_t                             linkAccess;
+        mutable std::optional<H5L_info_t> lInfo;
+        mutable std::optional<H5O_info_t> oInfo;
+        mutable bool                      hasNumAttrs = false;
+
+        [[nodiscard]] const H5L_info_t &readLinkInfo() const {
+            if(lInfo) return lInfo.value();
+            H5L_info_t info;
+            if(H5Lget_info(loc, linkName, &info, linkAccess) < 0) throw h5pp::runtime_error("Failed to read link info of [{}]", linkPath);
+            return lInfo.emplace(info);
+        }
+
+        [[nodiscard]] const H5O_info_t &readObjInfo(bool numAttrs) const {
+            if(oInfo and (hasNumAttrs or not numAttrs)) return oInfo.value();
+            H5O_info_t info;
+#if defined(H5Oget_info_vers) && H5Oget_info_vers >= 2
+            unsigned fields = numAttrs ? H5O_INFO_BASIC | H5O_INFO_NUM_ATTRS : H5O_INFO_BASIC;
+            herr_t   err    = H5Oget_info_by_name(loc, linkName, &info, fields, linkAccess);
+#else
+            herr_t err = H5Oget_info_by_name(loc, linkName, &info, linkAccess);
+            numAttrs   = true;
+#endif
+            if(err < 0) throw h5pp::runtime_error("Failed to read object info of link [{}]", linkPath);
+            hasNumAttrs = hasNumAttrs or numAttrs;
+            return oInfo.emplace(info);
+        }
+    };
+
+    /*!
+     * \brief An attribute met by File::visitAttributes. It refers to the visit in progress and is only valid inside the callback.
+     *
+     * The name and data size come with the iteration. The attribute itself is only opened when its type or dimensions
+     * are asked for.
+     */
+    class AttrView {
+        public:
+        AttrView(hid_t link, const char *name, const H5A_info_t &info) : link(link), attrName(name), info(info) {}
+
+        [[nodiscard]] std::string_view name() const { return attrName; }
+        [[nodiscard]] hsize_t          dataSize() const { return info.data_size; } /*!< Bytes of data stored in the attribute */
+        [[nodiscard]] H5T_cset_t       cset() const { return info.cset; }          /*!< Character set of the name */
+
+        /*! Opens the attribute. The handle is kept for later calls */
+        [[nodiscard]] const hid::h5a &open() const {
+            if(attribute) return attribute.value();
+            hid_t aid = H5Aopen(link, attrName, H5P_DEFAULT);
+            if(aid < 0) throw h5pp::runtime_error("Failed to open attribute [{}]", attrName);
+            return attribute.emplace(aid);
+        }
+
+        [[nodiscard]] hid::h5t type() const { return H5Aget_type(open()); }
+
+        [[nodiscard]] std::vector<hsize_t> dims() const {
+            hid::h5s space = H5Aget_space(open());
+            int      rank  = H5Sget_simple_extent_ndims(space);
+            if(rank < 0) throw h5pp::runtime_error("Failed to read the dimensions of attribute [{}]", attrName);
+            std::vector<hsize_t> dims(static_cast<size_t>(rank));
+            H5Sget_simple_extent_dims(space, dims.data(), nullptr);
+            return dims;
+        }
+
+        private:
+        hid_t                           link;
+        const char                     *attrName;
+        H5A_info_t                      info;
+        mutable std::optional<hid::h5a> attribute;
+    };
+
+    /*! Receives each link of File::visitLinks. Return false to stop the visit */
+    using LinkViewCallback = std::function<bool(const LinkView &link)>;
+
+    /*! Receives each attribute of File::visitAttributes. Return false to stop the visit */
+    using AttrViewCallback = std::function<bool(const AttrView &attr)>;
+}
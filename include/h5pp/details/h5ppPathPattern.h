@@ -0,0 +1,207 @@
+#pragma once
+#include "h5ppEnums.h"
+#include "h5ppExcept.h"
+#include "h5ppFormat.h"
+#include <algorithm>
+#include <optional>
+#include <regex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace h5pp {
+    /*!
+     * \brief A compiled pattern for link paths, matched one group level at a time.
+     *
+     * The pattern is split at '/' into one component per level, and each component must match the whole name of a link
+     * at that level. With LinkMatch::GLOB the components are shell patterns with '*', '?' and bracket expressions such as
+     * [0-9] or [!a-z]. With LinkMatch::REGEX they are ECMAScript regular expressions. In both cases a component "**"
+     * matches any number of levels, including none.
+     *
+     * Because the pattern is matched level by level, a search can skip every group whose path cannot lead to a match,
+     * and look up components without wildcards directly instead of iterating over their group.
+     *
+     * Example
+     * \code
+     *  h5pp::LinkSearch search;
+     *  search.pattern = h5pp::PathPattern("run_[0-9]/step_1?/energy");
+     *  search.pattern = h5pp::PathPattern("run_\\d+/step_\\d+/energy", h5pp::LinkMatch::REGEX);
+     * \endcode
+     */
+    class PathPattern {
+        public:
+        /*! Positions in the list of components that a partially matched path can continue from */
+        using State = std::vector<size_t>;
+
+        PathPattern() = default;
+        explicit PathPattern(std::string_view pattern, LinkMatch syntax = LinkMatch::GLOB) : text(pattern) {
+            if(syntax != LinkMatch::GLOB and syntax != LinkMatch::REGEX)
+                throw h5pp::runtime_error("PathPattern [{}]: the syntax must be LinkMatch::GLOB or LinkMatch::REGEX", pattern);
+            while(not pattern.empty() and pattern.front() == '/') pattern.remove_prefix(1);
+            while(not pattern.empty() and pattern.back() == '/') pattern.remove_suffix(1);
+            while(not pattern.empty()) {
+                auto             slash = pattern.find('/');
+                std::string_view part  = pattern.substr(0, slash);
+                pattern.remove_prefix(slash == std::string_view::npos ? pattern.size() : slash + 1);
+                if(part.empty()) continue;
+                Component comp;
+                comp.text = part;
+                if(part == "**") {
+                    comp.kind = Component::Kind::ANY_DEPTH;
+                    if(not components.empty() and components.back().kind == Component::Kind::ANY_DEPTH) continue;
+                } else if(syntax == LinkMatch::GLOB) {
+                    comp.kind = part.find_first_of("*?[") == std::string_view::npos ? Component::Kind::LITERAL : Component::Kind::GLOB;
+                } else {
+                    try {
+                        comp.regex = std::regex(comp.text, std::regex::ECMAScript | std::regex::optimize);
+                    } catch(const std::regex_error &ex) { throw h5pp::runtime_error("PathPattern [{}]: invalid regex [{}]: {}", text, part, ex.what()); }
+                    comp.kind = Component::Kind::REGEX;
+                }
+                components.emplace_back(std::move(comp));
+            }
+        }
+
+        [[nodiscard]] bool               empty() const { return components.empty(); }
+        [[nodiscard]] const std::string &string() const { return text; }
+
+        /*! The state before any level has been matched */
+        [[nodiscard]] State start() const { return closure({0}); }
+
+        /*! The state after matching one more level, named name */
+        [[nodiscard]] State advance(const State &state, std::string_view name) const {
+            State next;
+            for(auto pos : state) {
+                if(pos == components.size()) continue;
+                const auto &comp = components[pos];
+                if(comp.kind == Component::Kind::ANY_DEPTH) next.push_back(pos);
+                else if(matchComponent(comp, name)) next.push_back(pos + 1);
+            }
+            return closure(std::move(next));
+        }
+
+        /*! True if a path that reached state matches the whole pattern */
+        [[nodiscard]] bool accepts(const State &state) const { return std::find(state.begin(), state.end(), components.size()) != state.end(); }
+
+        /*! True if a path that reached state can still match with more levels, i.e. its group is worth entering */
+        [[nodiscard]] bool canContinue(const State &state) const { return not state.empty() and state.front() < components.size(); }
+
+        /*! The names that the next level must have, if they are all fixed. Returns std::nullopt if any name could match */
+        [[nodiscard]] std::optional<std::vector<std::string_view>> nextLiterals(const State &state) const {
+            std::vector<std::string_view> names;
+            for(auto pos : state) {
+                if(pos == components.size()) continue;
+                if(components[pos].kind != Component::Kind::LITERAL) return std::nullopt;
+                names.emplace_back(components[pos].text);
+            }
+            std::sort(names.begin(), names.end());
+            names.erase(std::unique(names.begin(), names.end()), names.end());
+            return names;
+        }
+
+        /*! True if path, relative to where the search started, matches the pattern */
+        [[nodiscard]] bool matches(std::string_view path) const {
+            auto state = start();
+            while(not path.empty() and path.front() == '/') path.remove_prefix(1);
+            while(not path.empty() and not state.empty()) {
+                auto slash = path.find('/');
+                state      = advance(state, path.substr(0, slash));
+                path.remove_prefix(slash == std::string_view::npos ? path.size() : slash + 1);
+            }
+            return path.empty() and accepts(state);
+        }
+
+        /*! Text that every matching path starts with: the leading components without wildcards, and the start of the next */
+        [[nodiscard]] std::string literalPrefix() const {
+            std::string prefix;
+            for(const auto &comp : components) {
+                if(comp.kind == Component::Kind::LITERAL) {
+                    prefix.append(comp.text).push_back('/');
+                    continue;
+                }
+                if(comp.kind == Component::Kind::GLOB) prefix.append(comp.text.substr(0, comp.text.find_first_of("*?[")));
+                // A trailing "**" also matches no level at all
+                if(comp.kind == Component::Kind::ANY_DEPTH and &comp == &components.back() and not prefix.empty()) prefix.pop_back();
+                return prefix;
+            }
+            if(not prefix.empty()) prefix.pop_back();
+            return prefix;
+        }
+
+        private:
+        struct Component {
+            enum class Kind { LITERAL, GLOB, REGEX, ANY_DEPTH };
+            Kind                      kind = Kind::LITERAL;
+            std::string               text;
+            std::optional<std::regex> regex;
+        };
+        std::string            text;
+        std::vector<Component> components;
+
+        /*! Adds the positions after "**" components, which may match no level at all, and sorts the positions */
+        [[nodiscard]] State closure(State state) const {
+            for(size_t i = 0; i < state.size(); ++i)
+                if(state[i] < components.size() and components[state[i]].kind == Component::Kind::ANY_DEPTH) state.push_back(state[i] + 1);
+            std::sort(state.begin(), state.end());
+            state.erase(std::unique(state.begin(), state.end()), state.end());
+            return state;
+        }
+
+        [[nodiscard]] static bool matchComponent(const Component &comp, std::string_view name) {
+            switch(comp.kind) {
+                case Component::Kind::LITERAL: return comp.text == name;
+                case Component::Kind::GLOB: return globMatch(comp.text, name);
+                case Component::Kind::REGEX: return std::regex_match(name.begin(), name.end(), comp.regex.value());
+                case Component::Kind::ANY_DEPTH: return true;
+            }
+            return false;
+        }
+
+        /*! Matches a bracket expression such as [a-z] or [!0-9] at the start of pattern. Returns its length, or 0 if it is incomplete */
+        [[nodiscard]] static size_t globClass(std::string_view pattern, char c, bool &matched) {
+            size_t i      = 1;
+            bool   negate = i < pattern.size() and (pattern[i] == '!' or pattern[i] == '^');
+            if(negate) i++;
+            bool found = false;
+            for(bool first = true; i < pattern.size() and (first or pattern[i] != ']'); first = false) {
+                if(i + 2 < pattern.size() and pattern[i + 1] == '-' and pattern[i + 2] != ']') {
+                    found = found or (pattern[i] <= c and c <= pattern[i + 2]);
+                    i += 3;
+                } else {
+                    found = found or pattern[i] == c;
+                    i += 1;
+                }
+            }
+            if(i >= pattern.size()) return 0;
+            matched = found != negate;
+            return i + 1;
+        }
+
+        /*! Shell-style matching of a single name */
+        [[nodiscard]] static bool globMatch(std::string_view pattern, std::string_view name) {
+            while(not pattern.empty()) {
+                if(pattern.front() == '*') {
+                    pattern.remove_prefix(std::min(pattern.size(), pattern.find_first_not_of('*')));
+                    if(pattern.empty()) return true;
+                    for(size_t i = 0; i < name.size(); ++i)
+                        if(globMatch(pattern, name.substr(i))) return true;
+                    return false;
+                }
+                if(name.empty()) return false;
+                if(pattern.front() == '[') {
+                    bool   matched = false;
+                    size_t len     = globClass(pattern, name.front(), matched);
+                    if(len > 0) {
+                        if(not matched) return false;
+                        pattern.remove_prefix(len);
+                        name.remove_prefix(1);
+                        continue;
+                    }
+                }
+                if(pattern.front() != '?' and pattern.front() != name.front()) return false;
+                pattern.remove_prefix(1);
+                name.remove_prefix(1);
+            }
+            return name.empty();
+        }
+    };
+}
@@ -1,8 +1,85 @@
 #pragma once
+#include "h5ppConstants.h"
 #include "h5ppHid.h"
+#include <cstddef>
 #include <hdf5.h>
+#include <memory>
+#include <mutex>
+#include <optional>
 
 namespace h5pp {
+    /*!
+     * Rules used to choose the layout of new datasets when none is given explicitly.
+     * Extendable datasets (i.e. with max dimensions larger than the dimensions) are always H5D_CHUNKED.
+     * Otherwise the total byte size of the dataset is compared against the thresholds below.
+     * */
+    struct LayoutPolicy {
+        size_t maxSizeCompact    = h5pp::constants::maxSizeCompact;    /*!< Datasets smaller than this many bytes get H5D_COMPACT layout */
+        size_t maxSizeContiguous = h5pp::constants::maxSizeContiguous; /*!< Datasets smaller than this many bytes get H5D_CONTIGUOUS layout */
+        bool   chunkIfCompressed = true; /*!< Use H5D_CHUNKED for non-compact datasets when compression is requested, since filters require chunks */
+        bool   compactIfSmall    = true; /*!< Use H5D_COMPACT for small, attribute-like datasets. If false they get H5D_CONTIGUOUS */
+    };
+
+    /*!
+     * Rules used to size the type-conversion and background buffers of dataset transfers (see H5Pset_buffer).
+     * HDF5 converts data between the memory type and the type on file one buffer at a time, which matters for compound
+     * types such as table records, or a subset of their fields. The HDF5 default buffer of 1 MB makes large transfers
+     * take many small conversion passes. The buffers are only used when the types differ.
+     * */
+    struct XferBufferPolicy {
+        size_t size     = 0;     /*!< Size of the buffers in bytes. 0 keeps the HDF5 default (1 MB) */
+        bool   autoSize = false; /*!< Size the buffers to fit each transfer whole, between the HDF5 default and maxSize. Overrides size */
+        size_t maxSize  = h5pp::constants::maxXferBuffer; /*!< Largest automatically sized buffers in bytes */
+    };
+
+    /*!
+     * Type-conversion and background buffers for dataset transfers, allocated by h5pp and reused between transfers.
+     * The buffers only grow. Copies of a PropertyLists share one instance, which is locked by each transfer using it.
+     * */
+    class XferBuffers {
+        private:
+        std::mutex                   mutex;
+        std::unique_ptr<std::byte[]> tconv, bkg;
+        size_t                       tconvSize = 0, bkgSize = 0;
+        hid::h5p                     plist;  // A copy of a dataset transfer property list, pointing to the buffers above
+        hid::h5p                     source; // The list that plist was copied from. Holding it keeps its identifier from being reused
+        size_t                       plistSize = 0;
+        bool                         plistBkg  = false;
+
+        public:
+        struct Lease {
+            hid_t                        plist; /*!< Dataset transfer property list to use in H5Dread or H5Dwrite */
+            std::unique_lock<std::mutex> lock;  /*!< Keeps other transfers off the buffers until the lease is destroyed */
+        };
+
+        /*! Returns a copy of dsetXfer with buffers of size bytes, and a background buffer if background is true.
+         * Note that later changes to dsetXfer itself (rather than to a new list assigned in its place) are not copied again.
+         */
+        [[nodiscard]] Lease lease(const hid::h5p &dsetXfer, size_t size, bool background) {
+            std::unique_lock<std::mutex> lock(mutex);
+            if(size > tconvSize) {
+                tconv.reset(new std::byte[size]); // Uninitialized on purpose
+                tconvSize = size;
+            }
+            if(background and size > bkgSize) {
+                bkg.reset(new std::byte[size]);
+                bkgSize = size;
+            }
+            if(not plist.valid() or not source.valid() or source.unchecked() != dsetXfer.unchecked()) {
+                plist     = H5Pcopy(dsetXfer);
+                source    = dsetXfer;
+                plistSize = 0;
+            }
+            if(size != plistSize or background != plistBkg) {
+                if(H5Pset_buffer(plist, size, tconv.get(), background ? bkg.get() : nullptr) < 0)
+                    throw h5pp::runtime_error("H5Pset_buffer() failed for {} bytes", size);
+                plistSize = size;
+                plistBkg  = background;
+            }
+            return {plist.value(), std::move(lock)};
+        }
+    };
+
     /*!
      * Property lists that describe policies for common tasks in HDF5.
      * Note that we do not include dataset property lists here because
@@ -20,6 +97,9 @@ namespace h5pp {
         hid::h5p groupAccess       = H5Pcreate(H5P_GROUP_ACCESS);
         hid::h5p dsetXfer          = H5Pcreate(H5P_DATASET_XFER);
         bool     vlenTrackReclaims = true;
+        LayoutPolicy layoutPolicy;      /*!< Decides the layout of new datasets (not an HDF5 property list) */
+        XferBufferPolicy xferBufferPolicy; /*!< Decides the size of the type-conversion buffers of dataset transfers (not an HDF5 property list) */
+        std::shared_ptr<XferBuffers> xferBuffers = std::make_shared<XferBuffers>(); /*!< Buffers used when xferBufferPolicy asks for larger ones */
 
         PropertyLists() {
             // Set default to create missing intermediate groups if they do not exist
@@ -28,7 +108,6 @@ namespace h5pp {
             //            H5Pset_create_intermediate_group(linkCreate, 1);
 
             // h5pp uses H5F_CLOSE_STRONG by default (id's associated to a file are closed when the file is closed)
-            fileAccess = H5Pcreate(H5P_FILE_ACCESS);
             if(H5Pset_fclose_degree(fileAccess, H5F_CLOSE_STRONG) < 0) throw h5pp::runtime_error("H5Pset_fclose_degree() failed");
             // The following settings are needed to reduce group size overhead
             if(H5Pset_libver_bounds(fileAccess, H5F_libver_t::H5F_LIBVER_EARLIEST, H5F_LIBVER_LATEST) < 0)
@@ -37,5 +116,31 @@ namespace h5pp {
             if(H5Pset_link_creation_order(groupCreate, H5P_CRT_ORDER_TRACKED | H5P_CRT_ORDER_INDEXED) < 0)
                 throw h5pp::runtime_error("H5Pset_link_creation_order() failed");
         }
+
+        /*! Returns a shared instance with the default property lists, which is created on first use.
+         *
+         * This is the default argument of the free functions in h5pp::hdf5 and h5pp::scan, so that calling them
+         * does not create nine new property lists every time. Do not modify the property lists of this instance:
+         * make a copy and modify that with writable() instead.
+         */
+        [[nodiscard]] static const PropertyLists &defaults() {
+            static std::optional<PropertyLists> plists;
+            static std::mutex                   mutex;
+            if(not plists or not plists->fileAccess.valid()) { // Identifiers become invalid if the HDF5 library is closed
+                std::lock_guard<std::mutex> lock(mutex);
+                if(not plists or not plists->fileAccess.valid()) plists.emplace();
+            }
+            return plists.value();
+        }
+
+        /*! Returns plist ready to be modified, e.g. with H5Pset_*.
+         *
+         * Copies of a PropertyLists share their HDF5 property lists, so modifying a list in place would affect all the copies.
+         * If plist is shared, it is first replaced by a private copy (copy-on-write). Only this one list is copied.
+         */
+        static hid::h5p &writable(hid::h5p &plist) {
+            if(plist.valid() and plist.refcount() > 1) plist = H5Pcopy(plist);
+            return plist;
+        }
     };
 }
@@ -1,3 +1,4 @@
+#pragma once
 #include "h5ppConstants.h"
 #include "h5ppHdf5.h"
 #include "h5ppInfo.h"
@@ -15,7 +16,7 @@ namespace h5pp::scan {
      * @param plists (optional) access property for the file. Used to determine link access property when searching for the dataset.
      */
     template<typename h5x>
-    inline void readDsetInfo(h5pp::DsetInfo &info, const h5x &loc, const Options &options, const PropertyLists &plists = PropertyLists()) {
+    inline void readDsetInfo(h5pp::DsetInfo &info, const h5x &loc, const Options &options, const PropertyLists &plists = PropertyLists::defaults()) {
         static_assert(h5pp::type::sfinae::is_h5pp_loc_id<h5x>,
                       "Template function [h5pp::scan::readDsetInfo(..., const h5x & loc, ...)] requires type h5x to be: "
                       "[h5pp::hid::h5f], [h5pp::hid::h5g] or [h5pp::hid::h5o]");
@@ -24,6 +25,7 @@ namespace h5pp::scan {
         // Start by copying fields in options which override later analysis
         if(not info.h5Type) info.h5Type = options.h5Type;
         if(not info.dsetSlab) info.dsetSlab = options.dsetSlab;
+        if(not info.xferBufferPolicy) info.xferBufferPolicy = options.xferBufferPolicy;
         if(not info.dsetPath) info.dsetPath = h5pp::util::safe_str(options.linkPath.value());
         h5pp::logger::log->debug("Scanning metadata of dataset [{}]", info.dsetPath.value());
         /* clang-format off */
@@ -85,7 +87,7 @@ namespace h5pp::scan {
      */
     template<typename h5x>
     [[nodiscard]] inline h5pp::DsetInfo
-        readDsetInfo(const h5x &loc, const Options &options, const PropertyLists &plists = PropertyLists()) {
+        readDsetInfo(const h5x &loc, const Options &options, const PropertyLists &plists = PropertyLists::defaults()) {
         if(not options.linkPath) throw h5pp::runtime_error("Could not read dataset info: No dataset path was given in options");
         h5pp::DsetInfo info;
         readDsetInfo(info, loc, options, plists);
@@ -98,7 +100,7 @@ namespace h5pp::scan {
      * @param plists (optional) access property for the file. Used to determine link access property when searching for the dataset.
      */
     template<typename h5x>
-    inline h5pp::DsetInfo makeDsetInfo(const h5x &loc, const Options &options, const PropertyLists &plists = PropertyLists()) {
+    inline h5pp::DsetInfo makeDsetInfo(const h5x &loc, const Options &options, const PropertyLists &plists = PropertyLists::defaults()) {
         static_assert(h5pp::type::sfinae::is_h5pp_loc_id<h5x>,
                       "Template function [h5pp::scan::makeDsetInfo(const h5x & loc, ...)] requires type h5x to be: "
                       "[h5pp::hid::h5f], [h5pp::hid::h5g] or [h5pp::hid::h5o]");
@@ -128,9 +130,14 @@ namespace h5pp::scan {
                                       info.dsetPath.value());
         }
 
+        if(info.h5Layout and not info.layoutReason) info.layoutReason = "given in options";
+
         if(info.dsetChunk) {
             // If dsetDimsChunk has been given then the layout is supposed to be chunked
-            if(not info.h5Layout) info.h5Layout = H5D_CHUNKED;
+            if(not info.h5Layout) {
+                info.h5Layout     = H5D_CHUNKED;
+                info.layoutReason = "H5D_CHUNKED because chunk dimensions were given";
+            }
 
             // Check that chunking options are sane
             if(info.dsetDims and info.dsetDims->size() != info.dsetChunk->size()) {
@@ -153,7 +160,16 @@ namespace h5pp::scan {
         // If dsetDimsMax has been given and any of them is H5S_UNLIMITED then the layout is supposed to be chunked
         if(info.dsetDimsMax) {
             // If dsetDimsMax has been given then the layout is supposed to be chunked
-            if(not info.h5Layout) info.h5Layout = H5D_CHUNKED;
+            if(not info.h5Layout) {
+                info.h5Layout     = H5D_CHUNKED;
+                info.layoutReason = "H5D_CHUNKED because max dimensions were given";
+            }
+        }
+
+        // Appending requires an extendable dataset, which in turn requires chunked layout
+        if(options.accessHint == h5pp::AccessHint::APPEND and not info.h5Layout) {
+            info.h5Layout     = H5D_CHUNKED;
+            info.layoutReason = "H5D_CHUNKED because of access hint APPEND";
         }
 
         // Next infer the missing properties
@@ -161,9 +177,9 @@ namespace h5pp::scan {
         if(not info.dsetSize)    info.dsetSize      = h5pp::util::getSizeFromDimensions(info.dsetDims.value());
         if(not info.dsetRank)    info.dsetRank      = h5pp::util::getRankFromDimensions(info.dsetDims.value());
         if(not info.dsetByte)    info.dsetByte      = info.dsetSize.value() * h5pp::hdf5::getBytesPerElem(info.h5Type.value()); // Trick needed for strings.
-        if(not info.h5Layout)    info.h5Layout      = h5pp::util::decideLayout(info.dsetByte.value());
+        if(not info.h5Layout)    std::tie(info.h5Layout, info.layoutReason) = h5pp::util::decideLayoutWithReason(info.dsetByte.value(), h5pp::hdf5::getValidCompressionLevel(info.compression), options.layoutPolicy.value_or(plists.layoutPolicy));
         if(not info.dsetDimsMax) info.dsetDimsMax   = h5pp::util::decideDimensionsMax(info.dsetDims.value(), info.h5Layout.value());
-        if(not info.dsetChunk)   info.dsetChunk     = h5pp::util::getChunkDimensions(h5pp::hdf5::getBytesPerElem(info.h5Type.value()), info.dsetDims.value(),info.dsetDimsMax,info.h5Layout);
+        if(not info.dsetChunk)   info.dsetChunk     = h5pp::util::getChunkDimensions(h5pp::hdf5::getBytesPerElem(info.h5Type.value()), info.dsetDims.value(),info.dsetDimsMax,info.h5Layout, options.accessHint, options.accessAxis);
         if(not info.compression) info.compression   = h5pp::hdf5::getValidCompressionLevel(info.compression);
         if(not info.resizePolicy) {
             if(info.h5Layout != H5D_CHUNKED)
@@ -184,6 +200,7 @@ namespace h5pp::scan {
         if(not info.cppTypeIndex or not info.cppTypeName or not info.cppTypeSize)
             std::tie(info.cppTypeIndex, info.cppTypeName, info.cppTypeSize) = h5pp::type::getCppType(info.h5Type.value());
 
+        h5pp::logger::log->debug("Layout of new dataset [{}]: {}", info.dsetPath.value(), info.layoutReason.value_or("unknown"));
         h5pp::logger::log->trace("Created metadata {}", info.string(h5pp::logger::logIf(LogLevel::trace)));
         auto error_msg = h5pp::debug::reportCompatibility(info.h5Layout, info.dsetDims, info.dsetChunk, info.dsetDimsMax);
         if(not error_msg.empty()) throw h5pp::runtime_error("Created dataset metadata is not well defined: \n{}", error_msg);
@@ -202,7 +219,7 @@ namespace h5pp::scan {
     [[nodiscard]] inline h5pp::DsetInfo inferDsetInfo(const h5x           &loc,
                                                       const DataType      &data,
                                                       const Options       &options = Options(),
-                                                      const PropertyLists &plists  = PropertyLists()) {
+                                                      const PropertyLists &plists  = PropertyLists::defaults()) {
         static_assert(not type::sfinae::is_h5pp_id<DataType>);
         static_assert(h5pp::type::sfinae::is_h5pp_loc_id<h5x>,
                       "Template function [h5pp::scan::inferDsetInfo(const h5x & loc, ...)] requires type h5x to be: "
@@ -235,9 +252,14 @@ namespace h5pp::scan {
             }
         }
 
+        if(info.h5Layout and not info.layoutReason) info.layoutReason = "given in options";
+
         if(info.dsetChunk) {
             // If dsetDimsChunk has been given then the layout is supposed to be chunked
-            if(not info.h5Layout) info.h5Layout = H5D_CHUNKED;
+            if(not info.h5Layout) {
+                info.h5Layout     = H5D_CHUNKED;
+                info.layoutReason = "H5D_CHUNKED because chunk dimensions were given";
+            }
 
             // Check that chunking options are sane
             if(info.dsetDims and info.dsetDims->size() != info.dsetChunk->size()) {
@@ -260,7 +282,10 @@ namespace h5pp::scan {
         // If dsetDimsMax has been given and any of them is H5S_UNLIMITED then the layout is supposed to be chunked
         if(info.dsetDimsMax) {
             // If dsetDimsMax has been given then the layout is supposed to be chunked
-            if(not info.h5Layout) info.h5Layout = H5D_CHUNKED;
+            if(not info.h5Layout) {
+                info.h5Layout     = H5D_CHUNKED;
+                info.layoutReason = "H5D_CHUNKED because max dimensions were given";
+            }
             if(info.h5Layout != H5D_CHUNKED) {
                 throw h5pp::runtime_error("Error creating metadata for new dataset [{}]: "
                                           "Dataset max dimensions {} requires H5D_CHUNKED layout",
@@ -269,6 +294,12 @@ namespace h5pp::scan {
             }
         }
 
+        // Appending requires an extendable dataset, which in turn requires chunked layout
+        if(options.accessHint == h5pp::AccessHint::APPEND and not info.h5Layout) {
+            info.h5Layout     = H5D_CHUNKED;
+            info.layoutReason = "H5D_CHUNKED because of access hint APPEND";
+        }
+
         // Next infer the missing properties
         /* clang-format off */
         if(not info.h5Type)      info.h5Type        = h5pp::type::getH5Type<DataType>();
@@ -276,9 +307,9 @@ namespace h5pp::scan {
         if(not info.dsetSize)    info.dsetSize      = h5pp::util::getSizeFromDimensions(info.dsetDims.value());
         if(not info.dsetRank)    info.dsetRank      = h5pp::util::getRankFromDimensions(info.dsetDims.value());
         if(not info.dsetByte)    info.dsetByte      = h5pp::util::getBytesTotal(data,info.dsetSize);
-        if(not info.h5Layout)    info.h5Layout      = h5pp::util::decideLayout(data,info.dsetDims, info.dsetDimsMax);
+        if(not info.h5Layout)    std::tie(info.h5Layout, info.layoutReason) = h5pp::util::decideLayoutWithReason(info.dsetByte.value(), h5pp::hdf5::getValidCompressionLevel(info.compression), options.layoutPolicy.value_or(plists.layoutPolicy));
         if(not info.dsetDimsMax) info.dsetDimsMax   = h5pp::util::decideDimensionsMax(info.dsetDims.value(), info.h5Layout);
-        if(not info.dsetChunk)   info.dsetChunk     = h5pp::util::getChunkDimensions(h5pp::util::getBytesPerElem<DataType>(), info.dsetDims.value(),info.dsetDimsMax, info.h5Layout);
+        if(not info.dsetChunk)   info.dsetChunk     = h5pp::util::getChunkDimensions(h5pp::util::getBytesPerElem<DataType>(), info.dsetDims.value(),info.dsetDimsMax, info.h5Layout, options.accessHint, options.accessAxis);
         if(not info.compression) info.compression   = h5pp::hdf5::getValidCompressionLevel(info.compression);
         if(not info.resizePolicy) {
             if(info.h5Layout != H5D_CHUNKED)
@@ -301,6 +332,7 @@ namespace h5pp::scan {
         if(not info.cppTypeIndex or not info.cppTypeName or not info.cppTypeSize)
             std::tie(info.cppTypeIndex, info.cppTypeName, info.cppTypeSize) = h5pp::type::getCppType(info.h5Type.value());
 
+        h5pp::logger::log->debug("Layout of new dataset [{}]: {}", info.dsetPath.value(), info.layoutReason.value_or("unknown"));
         h5pp::logger::log->trace("Created metadata {}", info.string(h5pp::logger::logIf(LogLevel::trace)));
         auto error_msg = h5pp::debug::reportCompatibility(info.h5Layout, info.dsetDims, info.dsetChunk, info.dsetDimsMax);
         if(not error_msg.empty()) throw h5pp::runtime_error("Created dataset metadata is not well defined: \n{}", error_msg);
@@ -357,7 +389,7 @@ namespace h5pp::scan {
 
     /*! \brief Populates an AttrInfo object with properties read from file */
     template<typename h5x>
-    inline void readAttrInfo(AttrInfo &info, const h5x &loc, const Options &options, const PropertyLists &plists = PropertyLists()) {
+    inline void readAttrInfo(AttrInfo &info, const h5x &loc, const Options &options, const PropertyLists &plists = PropertyLists::defaults()) {
         static_assert(h5pp::type::sfinae::is_h5pp_loc_id<h5x>,
                       "Template function [h5pp::scan::readAttrInfo(..., const h5x & loc, ...)] requires type h5x to be: "
                       "[h5pp::hid::h5f], [h5pp::hid::h5g] or [h5pp::hid::h5o]");
@@ -424,7 +456,7 @@ namespace h5pp::scan {
     /*! \brief Creates and returns a populated AttrInfo object with properties read from file */
     template<typename h5x>
     [[nodiscard]] inline h5pp::AttrInfo
-        readAttrInfo(const h5x &loc, const Options &options, const PropertyLists &plists = PropertyLists()) {
+        readAttrInfo(const h5x &loc, const Options &options, const PropertyLists &plists = PropertyLists::defaults()) {
         h5pp::AttrInfo info;
         readAttrInfo(info, loc, options, plists);
         return info;
@@ -438,7 +470,7 @@ namespace h5pp::scan {
                               const h5x           &loc,
                               const DataType      &data,
                               const Options       &options,
-                              const PropertyLists &plists = PropertyLists()) {
+                              const PropertyLists &plists = PropertyLists::defaults()) {
         static_assert(not type::sfinae::is_h5pp_id<DataType>);
         static_assert(h5pp::type::sfinae::is_h5pp_loc_id<h5x>,
                       "Template function [h5pp::scan::readAttrInfo(..., const h5x & loc, ...)] requires type h5x to be: "
@@ -510,7 +542,7 @@ namespace h5pp::scan {
      * Otherwise properties are inferred from given data. */
     template<typename DataType, typename h5x>
     [[nodiscard]] inline h5pp::AttrInfo
-        inferAttrInfo(const h5x &loc, const DataType &data, const Options &options, const PropertyLists &plists = PropertyLists()) {
+        inferAttrInfo(const h5x &loc, const DataType &data, const Options &options, const PropertyLists &plists = PropertyLists::defaults()) {
         h5pp::AttrInfo info;
         inferAttrInfo(info, loc, data, options, plists);
         return info;
@@ -518,7 +550,7 @@ namespace h5pp::scan {
 
     /*! \brief Populates an AttrInfo object based entirely on given options */
     template<typename h5x>
-    inline void makeAttrInfo(AttrInfo &info, const h5x &loc, const Options &options, const PropertyLists &plists = PropertyLists()) {
+    inline void makeAttrInfo(AttrInfo &info, const h5x &loc, const Options &options, const PropertyLists &plists = PropertyLists::defaults()) {
         static_assert(h5pp::type::sfinae::is_h5pp_loc_id<h5x>,
                       "Template function [h5pp::scan::makeAttrInfo(..., const h5x & loc, ...)] requires type h5x to be: "
                       "[h5pp::hid::h5f], [h5pp::hid::h5g] or [h5pp::hid::h5o]");
@@ -567,14 +599,14 @@ namespace h5pp::scan {
     /*! \brief Creates and returns a populated AttrInfo object based entirely on given options */
     template<typename h5x>
     [[nodiscard]] inline h5pp::AttrInfo
-        makeAttrInfo(const h5x &loc, const Options &options, const PropertyLists &plists = PropertyLists()) {
+        makeAttrInfo(const h5x &loc, const Options &options, const PropertyLists &plists = PropertyLists::defaults()) {
         h5pp::AttrInfo info;
         inferAttrInfo(info, loc, options, plists);
         return info;
     }
 
     template<typename h5x>
-    inline void inferAttrInfo(AttrInfo &info, const h5x &loc, const Options &options, const PropertyLists &plists = PropertyLists()) {
+    inline void inferAttrInfo(AttrInfo &info, const h5x &loc, const Options &options, const PropertyLists &plists = PropertyLists::defaults()) {
         static_assert(h5pp::type::sfinae::is_h5pp_loc_id<h5x>,
                       "Template function [h5pp::scan::inferAttrInfo(..., const h5x & loc, ...)] requires type h5x to be: "
                       "[h5pp::hid::h5f], [h5pp::hid::h5g] or [h5pp::hid::h5o]");
@@ -685,7 +717,7 @@ namespace h5pp::scan {
 
     /*! \brief Populates a TableInfo object with properties read from file */
     template<typename h5x>
-    inline void readTableInfo(TableInfo &info, const h5x &loc, const Options &options, const PropertyLists &plists = PropertyLists()) {
+    inline void readTableInfo(TableInfo &info, const h5x &loc, const Options &options, const PropertyLists &plists = PropertyLists::defaults()) {
         static_assert(h5pp::type::sfinae::is_hdf5_loc_id<h5x>,
                       "Template function [h5pp::scan::readTableInfo(..., const h5x & loc, ...)] requires type h5x to be: "
                       "[h5pp::hid::h5f], [h5pp::hid::h5g], [h5pp::hid::h5o] or [hid_t]");
@@ -735,7 +767,7 @@ namespace h5pp::scan {
     }
 
     template<typename h5x>
-    [[nodiscard]] inline TableInfo readTableInfo(const h5x &loc, const Options &options, const PropertyLists &plists = PropertyLists()) {
+    [[nodiscard]] inline TableInfo readTableInfo(const h5x &loc, const Options &options, const PropertyLists &plists = PropertyLists::defaults()) {
         TableInfo info;
         readTableInfo(info, loc, options, plists);
         return info;
@@ -746,7 +778,7 @@ namespace h5pp::scan {
                               const h5x           &loc,
                               const Options       &options,
                               std::string_view     tableTitle,
-                              const PropertyLists &plists = PropertyLists()) {
+                              const PropertyLists &plists = PropertyLists::defaults()) {
         readTableInfo(info, loc, options, plists);
         if(info.tableExists.value()) return;
         if(not options.linkPath and not info.tablePath) throw h5pp::runtime_error("Could not make table info: No table path was given");
@@ -813,14 +845,14 @@ namespace h5pp::scan {
 
     template<typename h5x>
     [[nodiscard]] inline h5pp::TableInfo
-        makeTableInfo(const h5x &loc, const Options &options, std::string_view tableTitle, const PropertyLists &plists = PropertyLists()) {
+        makeTableInfo(const h5x &loc, const Options &options, std::string_view tableTitle, const PropertyLists &plists = PropertyLists::defaults()) {
         TableInfo info;
         makeTableInfo(info, loc, options, tableTitle, plists);
         return info;
     }
 
     template<typename h5x>
-    inline void inferTableInfo(TableInfo &info, const h5x &loc, const Options &options, const PropertyLists &plists = PropertyLists()) {
+    inline void inferTableInfo(TableInfo &info, const h5x &loc, const Options &options, const PropertyLists &plists = PropertyLists::defaults()) {
         static_assert(h5pp::type::sfinae::is_h5pp_loc_id<h5x>,
                       "Template function [h5pp::scan::inferTableInfo(..., const h5x & loc, ...)] requires type h5x to be: "
                       "[h5pp::hid::h5f], [h5pp::hid::h5g] or [h5pp::hid::h5o]");
@@ -838,7 +870,7 @@ namespace h5pp::scan {
 
     /*! \brief Populates an LinkInfo object with properties read from file */
     template<typename h5x>
-    inline void readLinkInfo(LinkInfo &info, const h5x &loc, const Options &options, const PropertyLists &plists = PropertyLists()) {
+    inline void readLinkInfo(LinkInfo &info, const h5x &loc, const Options &options, const PropertyLists &plists = PropertyLists::defaults()) {
         static_assert(h5pp::type::sfinae::is_h5pp_loc_id<h5x>,
                       "Template function [h5pp::scan::readLinkInfo(..., const h5x & loc, ...)] requires type h5x to be: "
                       "[h5pp::hid::h5f], [h5pp::hid::h5g] or [h5pp::hid::h5o]");
@@ -913,7 +945,7 @@ namespace h5pp::scan {
     /*! \brief Creates and returns a populated LinkInfo object with properties read from file */
     template<typename h5x>
     [[nodiscard]] inline h5pp::LinkInfo
-        readLinkInfo(const h5x &loc, const Options &options, const PropertyLists &plists = PropertyLists()) {
+        readLinkInfo(const h5x &loc, const Options &options, const PropertyLists &plists = PropertyLists::defaults()) {
         h5pp::LinkInfo info;
         readLinkInfo(info, loc, options, plists);
         return info;
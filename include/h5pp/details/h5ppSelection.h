@@ -0,0 +1,222 @@
+#pragma once
+#include "h5ppDimensionType.h"
+#include "h5ppExcept.h"
+#include "h5ppFormat.h"
+#include "h5ppHid.h"
+#include "h5ppHyperslab.h"
+#include "h5ppTypeCast.h"
+#include <algorithm>
+#include <H5Spublic.h>
+#include <numeric>
+#include <vector>
+
+namespace h5pp {
+    /*!
+     * \brief An arbitrary selection of elements in a dataset: a list of points, or a union of hyperslabs.
+     *
+     * Unlike Hyperslab, a Selection does not have to be rectangular. A read or write with a Selection transfers all the
+     * selected elements in a single H5Dread or H5Dwrite, to or from a contiguous 1D buffer in memory.
+     *
+     * The elements of a point selection are transferred in the order that the points were given.
+     * The elements of a union of hyperslabs are transferred in the order they are stored in the dataset (row-major),
+     * and elements that are selected more than once are transferred once.
+     *
+     * Example: read records 3, 4, 5 and 17 of a 1D dataset, and the rows 10 to 19 of a 2D dataset
+     * \code
+     *  auto some = file.readSelection<std::vector<double>>("events", h5pp::Selection::indices({3, 4, 5, 17}));
+     *  auto rows = file.readSelection<std::vector<double>>("matrix", h5pp::Selection({h5pp::Hyperslab({10, 0}, {10, cols})}));
+     * \endcode
+     */
+    class Selection {
+        public:
+        std::vector<Hyperslab> slabs;       /*!< A union of hyperslabs. Each needs offset and extent, and may have stride and blocks */
+        std::vector<hsize_t>   points;      /*!< Coordinates of points, rank numbers per point. Used when slabs is empty */
+        size_t                 pointRank = 1; /*!< Number of coordinates per point */
+
+        Selection() = default;
+        explicit Selection(std::vector<Hyperslab> slabs_) : slabs(std::move(slabs_)) {}
+
+        /*! Selects the given indices of a 1D dataset, as a point selection */
+        [[nodiscard]] static Selection indices(std::vector<hsize_t> indices) {
+            Selection sel;
+            sel.points    = std::move(indices);
+            sel.pointRank = 1;
+            return sel;
+        }
+
+        /*! Selects points in a dataset of rank pointRank. The coordinates of point i are coords[i * pointRank + d], d < pointRank */
+        [[nodiscard]] static Selection coordinates(std::vector<hsize_t> coords, size_t pointRank) {
+            if(pointRank == 0 or coords.size() % pointRank != 0)
+                throw h5pp::runtime_error("Selection: {} coordinates do not make points of rank {}", coords.size(), pointRank);
+            Selection sel;
+            sel.points    = std::move(coords);
+            sel.pointRank = pointRank;
+            return sel;
+        }
+
+        /*! Reads the selection in a dataspace: points, regular and irregular hyperslab selections, ALL and NONE */
+        explicit Selection(const hid::h5s &space) {
+            int rank = H5Sget_simple_extent_ndims(space);
+            if(rank < 0) throw h5pp::runtime_error("Could not read ndims on given space");
+            auto rnk = type::safe_cast<size_t>(rank);
+            switch(H5Sget_select_type(space)) {
+                case H5S_SEL_NONE: return;
+                case H5S_SEL_ALL: slabs.emplace_back(space); return;
+                case H5S_SEL_POINTS: {
+                    auto num = H5Sget_select_elem_npoints(space);
+                    if(num < 0) throw h5pp::runtime_error("Could not read the number of selected points");
+                    pointRank = rnk;
+                    points.resize(type::safe_cast<size_t>(num) * rnk);
+                    if(H5Sget_select_elem_pointlist(space, 0, type::safe_cast<hsize_t>(num), points.data()) < 0)
+                        throw h5pp::runtime_error("Could not read the selected points");
+                    return;
+                }
+                case H5S_SEL_HYPERSLABS: {
+                    auto num = H5Sget_select_hyper_nblocks(space);
+                    if(num < 0) throw h5pp::runtime_error("Could not read the number of selected hyperslab blocks");
+                    // Each block is given by its start and end coordinates (inclusive)
+                    std::vector<hsize_t> blocklist(type::safe_cast<size_t>(num) * 2 * rnk);
+                    if(H5Sget_select_hyper_blocklist(space, 0, type::safe_cast<hsize_t>(num), blocklist.data()) < 0)
+                        throw h5pp::runtime_error("Could not read the selected hyperslab blocks");
+                    for(size_t b = 0; b < type::safe_cast<size_t>(num); b++) {
+                        auto                *start = blocklist.data() + 2 * b * rnk;
+                        auto                *end   = start + rnk;
+                        std::vector<hsize_t> offset(start, end);
+                        std::vector<hsize_t> extent(rnk);
+                        for(size_t d = 0; d < rnk; d++) extent[d] = end[d] - start[d] + 1;
+                        slabs.emplace_back(offset, extent);
+                    }
+                    return;
+                }
+                default: throw h5pp::runtime_error("Invalid selection type in space");
+            }
+        }
+
+        [[nodiscard]] bool empty() const { return slabs.empty() and points.empty(); }
+
+        /*! Number of points in a point selection, or hyperslabs in a union */
+        [[nodiscard]] size_t numParts() const { return slabs.empty() ? points.size() / pointRank : slabs.size(); }
+
+        /*! Adds a hyperslab to the union. Points, if any, are first turned into hyperslabs of a single element */
+        Selection &add(const Hyperslab &slab) {
+            pointsToSlabs();
+            slabs.emplace_back(slab);
+            return *this;
+        }
+
+        /*! Merges hyperslabs (and points) that are adjacent or overlapping into larger hyperslabs, so that HDF5 has fewer to visit.
+         *
+         * Two hyperslabs are merged when they are equal in all dimensions but one, and touch or overlap in that one.
+         * Hyperslabs with a stride or blocks are left as they are. A point selection becomes a union of hyperslabs, so that
+         * its elements are then transferred in storage order, and only once.
+         */
+        Selection &coalesce() {
+            pointsToSlabs();
+            std::vector<Hyperslab> fixed, plain;
+            for(auto &slab : slabs) {
+                if(not slab.offset or not slab.extent or isStrided(slab)) fixed.emplace_back(std::move(slab));
+                else plain.emplace_back(std::move(slab));
+            }
+            if(not plain.empty()) {
+                size_t rank = plain.front().offset->size();
+                for(size_t d = rank; d-- > 0;) mergeAlong(plain, d);
+            }
+            slabs = std::move(plain);
+            slabs.insert(slabs.end(), std::make_move_iterator(fixed.begin()), std::make_move_iterator(fixed.end()));
+            return *this;
+        }
+
+        /*! Replaces the selection in space with this selection */
+        void applySelection(const hid::h5s &space) const {
+            if(empty()) {
+                if(H5Sselect_none(space) < 0) throw h5pp::runtime_error("Failed to clear the selection");
+                return;
+            }
+            int rank = H5Sget_simple_extent_ndims(space);
+            if(rank < 0) throw h5pp::runtime_error("Failed to read space rank");
+            auto rnk = type::safe_cast<size_t>(rank);
+            if(slabs.empty()) {
+                if(pointRank != rnk) throw h5pp::runtime_error("Selection: points of rank {} in a space of rank {}", pointRank, rank);
+                // H5Sselect_valid does not always catch points out of bounds, so check them here
+                std::vector<hsize_t> dims(rnk);
+                if(H5Sget_simple_extent_dims(space, dims.data(), nullptr) < 0) throw h5pp::runtime_error("Failed to read space dimensions");
+                for(size_t i = 0; i < points.size(); i++)
+                    if(points[i] >= dims[i % rnk])
+                        throw h5pp::runtime_error("Selection: point {} is out of bounds in a space with dimensions {}", i / rnk, dims);
+                if(H5Sselect_elements(space, H5S_SELECT_SET, points.size() / pointRank, points.data()) < 0)
+                    throw h5pp::runtime_error("Failed to select {} points", points.size() / pointRank);
+            } else {
+                H5S_seloper_t oper = H5S_SELECT_SET;
+                for(const auto &slab : slabs) {
+                    if(not slab.offset or not slab.extent) throw h5pp::runtime_error("Selection: hyperslab needs both offset and extent");
+                    if(slab.offset->size() != rnk or slab.extent->size() != rnk or (slab.stride and slab.stride->size() != rnk) or
+                       (slab.blocks and slab.blocks->size() != rnk))
+                        throw h5pp::runtime_error("Selection: hyperslab {} does not have rank {}", slab.string(), rank);
+                    const hsize_t *strptr = slab.stride ? slab.stride->data() : nullptr;
+                    const hsize_t *blkptr = slab.blocks ? slab.blocks->data() : nullptr;
+                    if(H5Sselect_hyperslab(space, oper, slab.offset->data(), strptr, slab.extent->data(), blkptr) < 0)
+                        throw h5pp::runtime_error("Failed to select hyperslab {}", slab.string());
+                    oper = H5S_SELECT_OR;
+                }
+            }
+            htri_t valid = H5Sselect_valid(space);
+            if(valid < 0) throw h5pp::runtime_error("Selection is invalid: {}", string());
+            if(valid == 0) throw h5pp::runtime_error("Selection is not contained in the given space: {}", string());
+        }
+
+        [[nodiscard]] std::string string(bool enable = true) const {
+            std::string msg;
+            if(not enable) return msg;
+            if(slabs.empty()) msg.append(h5pp::format(" | {} points of rank {}", points.size() / pointRank, pointRank));
+            else msg.append(h5pp::format(" | union of {} hyperslabs", slabs.size()));
+            return msg;
+        }
+
+        private:
+        [[nodiscard]] static bool isStrided(const Hyperslab &slab) {
+            auto isOnes = [](const OptDimsType &dims) {
+                return not dims or std::all_of(dims->begin(), dims->end(), [](hsize_t d) { return d == 1; });
+            };
+            return not isOnes(slab.stride) or not isOnes(slab.blocks);
+        }
+
+        void pointsToSlabs() {
+            if(points.empty()) return;
+            for(size_t p = 0; p < points.size(); p += pointRank)
+                slabs.emplace_back(std::vector<hsize_t>(points.begin() + type::safe_cast<long>(p), points.begin() + type::safe_cast<long>(p + pointRank)),
+                                   std::vector<hsize_t>(pointRank, 1));
+            points.clear();
+        }
+
+        /*! Merges hyperslabs that differ only in dimension d, where they touch or overlap */
+        static void mergeAlong(std::vector<Hyperslab> &slabs, size_t d) {
+            auto sameElsewhere = [d](const Hyperslab &a, const Hyperslab &b) {
+                for(size_t i = 0; i < a.offset->size(); i++)
+                    if(i != d and (a.offset->at(i) != b.offset->at(i) or a.extent->at(i) != b.extent->at(i))) return false;
+                return true;
+            };
+            std::sort(slabs.begin(), slabs.end(), [d](const Hyperslab &a, const Hyperslab &b) {
+                for(size_t i = 0; i < a.offset->size(); i++) {
+                    if(i == d) continue;
+                    if(a.offset->at(i) != b.offset->at(i)) return a.offset->at(i) < b.offset->at(i);
+                    if(a.extent->at(i) != b.extent->at(i)) return a.extent->at(i) < b.extent->at(i);
+                }
+                return a.offset->at(d) < b.offset->at(d);
+            });
+            std::vector<Hyperslab> merged;
+            merged.reserve(slabs.size());
+            for(auto &slab : slabs) {
+                if(not merged.empty() and sameElsewhere(merged.back(), slab)) {
+                    auto &last = merged.back();
+                    auto  end  = last.offset->at(d) + last.extent->at(d);
+                    if(slab.offset->at(d) <= end) {
+                        last.extent->at(d) = std::max(end, slab.offset->at(d) + slab.extent->at(d)) - last.offset->at(d);
+                        continue;
+                    }
+                }
+                merged.emplace_back(std::move(slab));
+            }
+            slabs = std::move(merged);
+        }
+    };
+}
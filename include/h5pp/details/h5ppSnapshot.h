@@ -0,0 +1,150 @@
+#pragma once
+#include "h5ppExcept.h"
+#include "h5ppFilesystem.h"
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdio>
+#include <exception>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#if !defined(H5PP_HAS_FSYNC)
+    #if(defined(__unix__) || defined(__APPLE__)) && __has_include(<unistd.h>)
+        #define H5PP_HAS_FSYNC 1
+    #else
+        #define H5PP_HAS_FSYNC 0
+    #endif
+#endif
+
+#if H5PP_HAS_FSYNC == 1
+    #include <unistd.h>
+#endif
+
+namespace h5pp {
+    /*!
+     * \brief Where and how often h5pp::File takes snapshots of itself, see File::setSnapshotPolicy.
+     */
+    struct SnapshotPolicy {
+        fs::path snapshotPath; /*!< Snapshots are written here. Empty: next to the file, as <stem>.snapshot<extension> */
+        std::chrono::steady_clock::duration interval = std::chrono::seconds(60); /*!< File::snapshotIfDue waits this long between snapshots */
+    };
+
+    /*!
+     * \brief Writes images of a file to disk on a background thread.
+     *
+     * Each image is written to a temporary file next to the target, which is then renamed over the target. The target
+     * therefore always holds a complete snapshot, even if the program stops halfway through a write. One image can be
+     * handed over while another is being written. If yet another one arrives before that one is started, it replaces it.
+     * The buffers of written images are handed out again for the next ones, so that snapshots of a file of steady size
+     * do not allocate.
+     */
+    class SnapshotWriter {
+        public:
+        explicit SnapshotWriter(fs::path targetPath) : target(std::move(targetPath)), worker([this] { run(); }) {}
+        SnapshotWriter(const SnapshotWriter &)            = delete;
+        SnapshotWriter &operator=(const SnapshotWriter &) = delete;
+
+        /*! Writes the image that was handed over last, if it has not been written yet, before returning */
+        ~SnapshotWriter() {
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                stopping = true;
+            }
+            wakeup.notify_all();
+            worker.join();
+        }
+
+        /*! Returns a buffer to put the next image in, if possible one that an earlier image has been written from */
+        [[nodiscard]] std::vector<std::byte> takeBuffer() {
+            std::lock_guard<std::mutex> lock(mutex);
+            return std::exchange(spare, {});
+        }
+
+        /*! Hands over an image to be written. Rethrows the error of an earlier write, if any */
+        void submit(std::vector<std::byte> image) {
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                rethrowError();
+                if(pending) spare = std::move(pending.value()); // Never started, and superseded by this image
+                pending = std::move(image);
+            }
+            wakeup.notify_all();
+        }
+
+        /*! Blocks until every image handed over has been written. Rethrows the error of a write, if any */
+        void wait() {
+            std::unique_lock<std::mutex> lock(mutex);
+            finished.wait(lock, [this] { return not pending and not writing; });
+            rethrowError();
+        }
+
+        [[nodiscard]] const fs::path &getTargetPath() const { return target; }
+
+        /*! The number of images written to the target so far */
+        [[nodiscard]] size_t getNumWritten() const {
+            std::lock_guard<std::mutex> lock(mutex);
+            return numWritten;
+        }
+
+        private:
+        fs::path                              target;
+        mutable std::mutex                    mutex;
+        std::condition_variable               wakeup;   /*!< Notifies the worker of a new image or of stopping */
+        std::condition_variable               finished; /*!< Notifies wait() that an image has been written */
+        std::optional<std::vector<std::byte>> pending;  /*!< The next image to write */
+        std::vector<std::byte>                spare;    /*!< A buffer to reuse for an image */
+        bool                                  writing    = false;
+        bool                                  stopping   = false;
+        size_t                                numWritten = 0;
+        std::exception_ptr                    error;
+        std::thread                           worker; /*!< Declared last, so that it starts after the other members exist */
+
+        void rethrowError() {
+            if(error) std::rethrow_exception(std::exchange(error, nullptr));
+        }
+
+        void run() {
+            std::unique_lock<std::mutex> lock(mutex);
+            while(true) {
+                wakeup.wait(lock, [this] { return pending or stopping; });
+                if(not pending) return;
+                auto image = std::move(pending.value());
+                pending.reset();
+                writing = true;
+                lock.unlock();
+                std::exception_ptr writeError;
+                try {
+                    writeImage(target, image);
+                } catch(...) { writeError = std::current_exception(); }
+                lock.lock();
+                writing = false;
+                if(writeError) error = writeError;
+                else numWritten++;
+                if(spare.capacity() < image.capacity()) spare = std::move(image);
+                finished.notify_all();
+            }
+        }
+
+        static void writeImage(const fs::path &path, const std::vector<std::byte> &image) {
+            auto tempPath = path;
+            tempPath += ".tmp";
+            std::FILE *file = std::fopen(tempPath.string().c_str(), "wb");
+            if(file == nullptr) throw h5pp::runtime_error("Failed to open [{}] to write a snapshot", tempPath.string());
+            bool written = std::fwrite(image.data(), 1, image.size(), file) == image.size() and std::fflush(file) == 0;
+#if H5PP_HAS_FSYNC == 1
+            written = written and fsync(fileno(file)) == 0; // The snapshot must be on disk before it replaces the previous one
+#endif
+            written = std::fclose(file) == 0 and written;
+            std::error_code ec;
+            if(written) fs::rename(tempPath, path, ec);
+            if(not written or ec) {
+                fs::remove(tempPath, ec);
+                throw h5pp::runtime_error("Failed to write a snapshot of {} bytes to [{}]", image.size(), path.string());
+            }
+        }
+    };
+}
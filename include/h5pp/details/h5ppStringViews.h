@@ -0,0 +1,106 @@
+#pragma once
+#include "h5ppExcept.h"
+#include "h5ppHdf5.h"
+#include "h5ppHid.h"
+#include "h5ppInfo.h"
+#include "h5ppPropertyLists.h"
+#include "h5ppTypeCast.h"
+#include <cstring>
+#include <hdf5.h>
+#include <memory>
+#include <string_view>
+#include <vector>
+
+namespace h5pp {
+    /*!
+     * \brief The strings of a text dataset, as views into a single buffer. Read with File::readStringViews.
+     *
+     * The characters of all strings are kept back to back in one allocation, and nothing is allocated per string.
+     * The views stay valid when a StringViews is moved. It cannot be copied, since the copies would view the original.
+     */
+    class StringViews {
+        public:
+        StringViews() = default;
+        StringViews(StringViews &&) noexcept            = default;
+        StringViews &operator=(StringViews &&) noexcept = default;
+        StringViews(const StringViews &)                = delete;
+        StringViews &operator=(const StringViews &)     = delete;
+
+        /*! Takes over count fixed-length strings of bytesPerString bytes each. Each string ends at its first null character */
+        StringViews(std::unique_ptr<char[]> fixedText, size_t count, size_t bytesPerString) : text(std::move(fixedText)) {
+            views.reserve(count);
+            for(size_t i = 0; i < count; ++i) {
+                const char *str = text.get() + i * bytesPerString;
+                const auto *end = static_cast<const char *>(std::memchr(str, '\0', bytesPerString));
+                views.emplace_back(str, end == nullptr ? bytesPerString : static_cast<size_t>(end - str));
+            }
+        }
+
+        /*! Copies count null-terminated strings into a buffer of their total length. Null pointers become empty strings */
+        StringViews(const char *const *strings, size_t count) {
+            std::vector<size_t> lengths(count, 0);
+            size_t              total = 0;
+            for(size_t i = 0; i < count; ++i) {
+                if(strings[i] != nullptr) lengths[i] = std::strlen(strings[i]);
+                total += lengths[i];
+            }
+            text = std::unique_ptr<char[]>(new char[total]); // Not zeroed: every byte is copied over
+            views.reserve(count);
+            char *pos = text.get();
+            for(size_t i = 0; i < count; ++i) {
+                if(lengths[i] > 0) std::memcpy(pos, strings[i], lengths[i]);
+                views.emplace_back(pos, lengths[i]);
+                pos += lengths[i];
+            }
+        }
+
+        [[nodiscard]] size_t           size() const { return views.size(); }
+        [[nodiscard]] bool             empty() const { return views.empty(); }
+        [[nodiscard]] std::string_view operator[](size_t i) const { return views[i]; }
+        [[nodiscard]] std::string_view at(size_t i) const { return views.at(i); }
+        [[nodiscard]] auto             begin() const { return views.begin(); }
+        [[nodiscard]] auto             end() const { return views.end(); }
+
+        /*! All the views, e.g. to copy them into other containers */
+        [[nodiscard]] const std::vector<std::string_view> &view() const { return views; }
+
+        private:
+        std::unique_ptr<char[]>       text;
+        std::vector<std::string_view> views;
+    };
+}
+
+namespace h5pp::hdf5 {
+    /*!
+     * Reads the strings of a text dataset, or of the hyperslab dsetInfo.dsetSlab in it, into a StringViews.
+     * Fixed-length strings are read straight into the buffer of the result. Variable-length strings are copied into it
+     * with a single allocation, and the memory HDF5 allocated for them is reclaimed right away.
+     */
+    [[nodiscard]] inline StringViews readStringViews(const DsetInfo &dsetInfo, const PropertyLists &plists = PropertyLists::defaults()) {
+        dsetInfo.assertReadReady();
+        if(H5Tget_class(dsetInfo.h5Type.value()) != H5T_STRING)
+            throw h5pp::runtime_error("Cannot read string views of dataset [{}]: it does not hold text", dsetInfo.dsetPath.value());
+        hid::h5s dsetSpace = H5Scopy(dsetInfo.h5Space.value());
+        if(dsetInfo.dsetSlab) selectHyperslab(dsetSpace, dsetInfo.dsetSlab.value());
+        auto     count    = type::safe_cast<hsize_t>(H5Sget_select_npoints(dsetSpace));
+        hid::h5s memSpace = H5Screate_simple(1, &count, nullptr);
+        if(H5Tis_variable_str(dsetInfo.h5Type.value()) > 0) {
+            std::vector<char *> vdata(type::safe_cast<size_t>(count), nullptr);
+            if(H5Dread(dsetInfo.h5Dset->unchecked(), dsetInfo.h5Type->unchecked(), memSpace, dsetSpace, plists.dsetXfer, vdata.data()) < 0)
+                throw h5pp::runtime_error("Failed to read strings from dataset [{}]", dsetInfo.dsetPath.value());
+            StringViews result(vdata.data(), vdata.size());
+#if H5_VERSION_GE(1, 12, 0)
+            herr_t reclaimErr = H5Treclaim(dsetInfo.h5Type->unchecked(), memSpace, plists.dsetXfer, vdata.data());
+#else
+            herr_t reclaimErr = H5Dvlen_reclaim(dsetInfo.h5Type->unchecked(), memSpace, plists.dsetXfer, vdata.data());
+#endif
+            if(reclaimErr < 0) throw h5pp::runtime_error("Failed to reclaim the strings of dataset [{}]", dsetInfo.dsetPath.value());
+            return result;
+        }
+        size_t bytesPerString = H5Tget_size(dsetInfo.h5Type.value()); // Includes the null terminator
+        auto   text           = std::unique_ptr<char[]>(new char[type::safe_cast<size_t>(count) * bytesPerString]);
+        if(H5Dread(dsetInfo.h5Dset->unchecked(), dsetInfo.h5Type->unchecked(), memSpace, dsetSpace, plists.dsetXfer, text.get()) < 0)
+            throw h5pp::runtime_error("Failed to read strings from dataset [{}]", dsetInfo.dsetPath.value());
+        return {std::move(text), type::safe_cast<size_t>(count), bytesPerString};
+    }
+}
@@ -5,13 +5,19 @@
 #include "h5ppTypeCast.h"
 #include "h5ppTypeCompound.h"
 #include "h5ppTypeCustom.h"
+#include "h5ppTypeRegister.h"
 #include "h5ppTypeSfinae.h"
 #include "h5ppVarr.h"
 #include "h5ppVstr.h"
+#include <array>
 #include <cstddef>
 #include <H5Tpublic.h>
 #include <H5version.h>
+#include <mutex>
+#include <optional>
 #include <typeindex>
+#include <unordered_map>
+#include <utility>
 
 namespace tc = h5pp::type::sfinae;
 namespace h5pp::type {
@@ -148,16 +154,20 @@ namespace h5pp::type {
         }
     }
 
+    template<typename DataType>
+    [[nodiscard]] hid::h5t makeCompoundH5Type();
+
+    /*! Constructs a new HDF5 type matching the C++ type DataType. Prefer getH5Type<DataType>(), which reuses the type once built. */
     template<typename DataType, size_t depth = 0>
-    [[nodiscard]] hid::h5t getH5Type() {
-        //        if(h5type.has_value()) return h5type.value(); // Intercept
+    [[nodiscard]] hid::h5t makeH5Type() {
         namespace tc    = h5pp::type::sfinae;
         using DecayType = typename std::decay<DataType>::type;
 
         /* clang-format off */
-        if constexpr      (std::is_pointer_v<DecayType>)                     return getH5Type<typename std::remove_pointer<DecayType>::type, depth+1>();
-        else if constexpr (std::is_reference_v<DecayType>)                   return getH5Type<typename std::remove_reference<DecayType>::type, depth+1>();
-        else if constexpr (std::is_array_v<DecayType>)                       return getH5Type<typename std::remove_all_extents<DecayType>::type, depth+1>();
+        if constexpr      (std::is_pointer_v<DecayType>)                     return makeH5Type<typename std::remove_pointer<DecayType>::type, depth+1>();
+        else if constexpr (std::is_reference_v<DecayType>)                   return makeH5Type<typename std::remove_reference<DecayType>::type, depth+1>();
+        else if constexpr (std::is_array_v<DecayType>)                       return makeH5Type<typename std::remove_all_extents<DecayType>::type, depth+1>();
+        else if constexpr (type::compound::is_registered_v<DecayType>)       return makeCompoundH5Type<DecayType>();
         else if constexpr (std::is_same_v<DecayType, short>)                 return H5Tcopy(H5T_NATIVE_SHORT);
         else if constexpr (std::is_same_v<DecayType, int>)                   return H5Tcopy(H5T_NATIVE_INT);
         else if constexpr (std::is_same_v<DecayType, long>)                  return H5Tcopy(H5T_NATIVE_LONG);
@@ -192,15 +202,15 @@ namespace h5pp::type {
         else if constexpr (tc::is_std_complex_v<DecayType>)                  return H5Tcopy(type::compound::H5T_COMPLEX<typename DecayType::value_type>::h5type());
         else if constexpr (tc::is_Scalar2_v<DecayType>)                      return H5Tcopy(type::compound::H5T_SCALAR2<tc::get_Scalar2_t<DecayType>>::h5type());
         else if constexpr (tc::is_Scalar3_v<DecayType>)                      return H5Tcopy(type::compound::H5T_SCALAR3<tc::get_Scalar3_t<DecayType>>::h5type());
-        else if constexpr (tc::is_std_array_v<DecayType> and depth == 0 )      return getH5Type<typename DecayType::value_type, depth+1>();
+        else if constexpr (tc::is_std_array_v<DecayType> and depth == 0 )      return makeH5Type<typename DecayType::value_type, depth+1>();
         else if constexpr (tc::is_std_array_v<DecayType> and depth == 1 ){
             constexpr std::array<hsize_t, 1> dims = {std::tuple_size<DecayType>::value};
-            return H5Tarray_create(getH5Type<typename DecayType::value_type, depth+1>(), dims.size(), dims.data()) ;
+            return H5Tarray_create(makeH5Type<typename DecayType::value_type, depth+1>(), dims.size(), dims.data()) ;
         }
-        else if constexpr (tc::has_Scalar_v<DecayType>)                      return getH5Type<typename DecayType::Scalar, depth+1>();
-        else if constexpr (tc::has_value_type_v <DecayType>)                 return getH5Type<typename DecayType::value_type, depth+1>();
+        else if constexpr (tc::has_Scalar_v<DecayType>)                      return makeH5Type<typename DecayType::Scalar, depth+1>();
+        else if constexpr (tc::has_value_type_v <DecayType>)                 return makeH5Type<typename DecayType::value_type, depth+1>();
         else if constexpr (std::is_same_v<DecayType, hvl_t>)                 return H5Tvlen_create(H5T_NATIVE_OPAQUE); // Last resort ... user should provide a h5 type at runtime
-        else if constexpr (std::is_enum_v<DecayType>)                        return getH5Type<std::underlying_type_t<DecayType>>(); // Last resort ... user should provide a h5 type at runtime
+        else if constexpr (std::is_enum_v<DecayType>)                        return makeH5Type<std::underlying_type_t<DecayType>>(); // Last resort ... user should provide a h5 type at runtime
         else if constexpr (std::is_class_v<DecayType>) {
             // Last resort ... unless the user should provides a h5 type at runtime.
             // When reading, h5pp will try using the dset type instead.
@@ -211,131 +221,231 @@ namespace h5pp::type {
         }
         else static_assert(type::sfinae::unrecognized_type_v<DecayType> and "h5pp could not match the given C++ type to an HDF5 type.");
         /* clang-format on */
-        throw h5pp::runtime_error("getH5Type could not match the type provided [{}] | size {}",
+        throw h5pp::runtime_error("makeH5Type could not match the type provided [{}] | size {}",
                                   type::sfinae::type_name<DecayType>(),
                                   sizeof(DecayType));
         return hid_t(0);
     }
 
+    /*! Process-lifetime registry of the HDF5 types built by makeH5Type<DataType>().
+     *
+     * The type is built once, under a lock, and then only read. It is rebuilt if the HDF5 library has been closed and
+     * reopened in the meantime, which invalidates all identifiers.
+     */
+    template<typename DataType>
+    class H5TypeRegistry {
+        private:
+        inline static hid::h5t   h5type_id;
+        inline static bool       is_string = false;
+        inline static std::mutex mutex;
+        static void              init() {
+            if(not h5type_id.valid()) {
+                std::lock_guard<std::mutex> lock(mutex);
+                if(not h5type_id.valid()) {
+                    h5type_id = makeH5Type<DataType>();
+                    is_string = H5Tget_class(h5type_id) == H5T_STRING;
+                }
+            }
+        }
+
+        public:
+        [[nodiscard]] static const hid::h5t &h5type() {
+            init();
+            return h5type_id;
+        }
+        [[nodiscard]] static bool isString() {
+            init();
+            return is_string;
+        }
+    };
+
+    /*! Returns the HDF5 type matching the C++ type DataType.
+     *
+     * The returned identifier is shared by all callers: copy it with H5Tcopy before modifying it.
+     * String types are the exception, and are returned as a new copy, since their size is set to fit the data.
+     */
+    template<typename DataType>
+    [[nodiscard]] hid::h5t getH5Type() {
+        using Registry = H5TypeRegistry<std::decay_t<DataType>>;
+        if(Registry::isString()) return H5Tcopy(Registry::h5type());
+        return Registry::h5type();
+    }
+
+    namespace internal {
+        template<typename ArrayType, size_t... I>
+        constexpr std::array<hsize_t, sizeof...(I)> getExtents(std::index_sequence<I...>) {
+            return {std::extent_v<ArrayType, I>...};
+        }
+    }
+
+    /*! Returns the HDF5 type of a member of a struct registered with H5PP_REGISTER_COMPOUND.
+     *  Unlike getH5Type, arrays become H5T_ARRAY types and arrays of char become fixed-length strings.
+     */
+    template<typename MemberType>
+    [[nodiscard]] hid::h5t getMemberH5Type() {
+        using DecayType = std::remove_cv_t<MemberType>;
+        if constexpr(std::is_array_v<DecayType>) {
+            using ElemType      = std::remove_cv_t<std::remove_all_extents_t<DecayType>>;
+            constexpr auto rank = std::rank_v<DecayType>;
+            auto           dims = internal::getExtents<DecayType>(std::make_index_sequence<rank>{});
+            if constexpr(std::is_same_v<ElemType, char>) {
+                // The last extent is the length of a fixed-length string
+                hid::h5t strType = H5Tcopy(H5T_C_S1);
+                H5Tset_size(strType, dims.back());
+                H5Tset_strpad(strType, H5T_STR_NULLTERM);
+                if constexpr(rank == 1) return strType;
+                else return H5Tarray_create(strType, rank - 1, dims.data());
+            } else {
+                return H5Tarray_create(getMemberH5Type<ElemType>(), rank, dims.data());
+            }
+        } else if constexpr(tc::is_std_array_v<DecayType>) {
+            using ElemType = std::remove_cv_t<typename DecayType::value_type>;
+            constexpr std::array<hsize_t, 1> dims = {std::tuple_size_v<DecayType>};
+            if constexpr(std::is_same_v<ElemType, char>) return getMemberH5Type<char[dims[0]]>();
+            else return H5Tarray_create(getMemberH5Type<ElemType>(), 1, dims.data());
+        } else if constexpr(tc::is_fstr_v<DecayType>) {
+            return DecayType::get_h5type();
+        } else {
+            static_assert(std::is_trivially_copyable_v<DecayType>,
+                          "Members of a registered compound type must be trivially copyable: use char[N] or h5pp::fstr_t<N> for text");
+            return getH5Type<DecayType>();
+        }
+    }
+
+    /*! Constructs the compound type of a struct registered with H5PP_REGISTER_COMPOUND. Prefer getH5Type<DataType>() */
+    template<typename DataType>
+    [[nodiscard]] hid::h5t makeCompoundH5Type() {
+        hid::h5t h5type = H5Tcreate(H5T_COMPOUND, sizeof(DataType));
+        type::compound::Members<DataType>::for_each([&h5type](std::string_view name, size_t offset, auto tag) {
+            using MemberType    = typename decltype(tag)::type;
+            hid::h5t memberType = getMemberH5Type<MemberType>();
+            if(H5Tinsert(h5type, std::string(name).c_str(), offset, memberType) < 0)
+                throw h5pp::runtime_error("Failed to insert member [{}] into the compound type of [{}]", name, sfinae::type_name<DataType>());
+        });
+        return h5type;
+    }
+
     template<typename T>
     [[nodiscard]] std::tuple<std::type_index, std::string, size_t> getCppType() {
         return {typeid(T), std::string(type::sfinae::type_name<T>()), sizeof(T)};
     }
 
-    [[nodiscard]] inline std::tuple<std::type_index, std::string, size_t> getCppType(const hid::h5t &type) {
-        using namespace h5pp::type::compound;
-        auto h5class = H5Tget_class(type);
-
-        /* clang-format off */
-        if(h5class == H5T_class_t::H5T_INTEGER){
-            auto h5sign  = H5Tget_sign(type);
-            if(h5sign  == H5T_sign_t::H5T_SGN_ERROR) throw h5pp::runtime_error("H5Tget_sign() failed on integral type");
-            if(h5sign == H5T_sign_t::H5T_SGN_NONE){
-                if(H5Tequal(type, H5T_NATIVE_USHORT))   return getCppType<unsigned short>();
-                if(H5Tequal(type, H5T_NATIVE_UINT))     return getCppType<unsigned int>();
-                if(H5Tequal(type, H5T_NATIVE_ULONG))    return getCppType<unsigned long>();
-                if(H5Tequal(type, H5T_NATIVE_ULLONG))   return getCppType<unsigned long long>();
-            }
-            else if(h5sign == H5T_sign_t::H5T_SGN_2){
-               if(H5Tequal(type, H5T_NATIVE_SHORT))   return getCppType<short>();
-               if(H5Tequal(type, H5T_NATIVE_INT))     return getCppType<int>();
-               if(H5Tequal(type, H5T_NATIVE_LONG))    return getCppType<long>();
-               if(H5Tequal(type, H5T_NATIVE_LLONG))   return getCppType<long long>();
-            }
-        }else if (h5class == H5T_class_t::H5T_FLOAT){
-            if(H5Tequal(type, H5T_NATIVE_FLOAT))              return getCppType<float>();
-            if(H5Tequal(type, H5T_NATIVE_DOUBLE))             return getCppType<double>();
-            if(H5Tequal(type, H5T_NATIVE_LDOUBLE))            return getCppType<long double>();
-            #if defined(H5PP_USE_FLOAT128) || defined(H5PP_USE_QUADMATH)
-            if(h5pp::type::custom::H5T_FLOAT128::equal(type)) return getCppType<h5pp::fp128>();
-            #endif
-        }else if  (h5class == H5T_class_t::H5T_STRING){
-            if(H5Tequal(type, H5T_NATIVE_CHAR))             return getCppType<char>();
-            if(H5Tequal_recurse(type, H5Tcopy(H5T_C_S1)))   return getCppType<std::string>();
-            if(H5Tequal(type, H5T_NATIVE_SCHAR))            return getCppType<signed char>();
-            if(H5Tequal(type, H5T_NATIVE_UCHAR))            return getCppType<unsigned char>();
-        }else if (h5class == H5T_class_t::H5T_VLEN){
-            return getCppType<hvl_t>();
-        }else if (h5class == H5T_COMPOUND){
-            if(is_complex(type)){
-                auto h5mtype = H5Tget_member_type(type,0);
-                auto h5mclass = H5Tget_class(h5mtype);
-                if(h5mclass == H5T_class_t::H5T_FLOAT){
-                    if (H5T_COMPLEX<float>::equal(type))            return getCppType<std::complex<float>>();
-                    if (H5T_COMPLEX<double>::equal(type))           return getCppType<std::complex<double>>();
-                    if (H5T_COMPLEX<long double>::equal(type))      return getCppType<std::complex<long double>>();
-                    #if defined(H5PP_USE_FLOAT128) || defined(H5PP_USE_QUADMATH)
-                    if(H5T_COMPLEX<h5pp::fp128>::equal(type)) return getCppType<std::complex<h5pp::fp128>>();
-                    #endif
+    namespace internal {
+        /*! Hashes the properties of an HDF5 type that distinguish the types known to h5pp:
+         * class, size, sign, byte order and precision, and for compound types the names, offsets and fingerprints of the members.
+         */
+        [[nodiscard]] inline size_t getH5TypeFingerprint(hid_t type) {
+            auto   h5class = H5Tget_class(type);
+            size_t hash    = static_cast<size_t>(h5class);
+            auto   combine = [&hash](size_t value) { hash ^= value + 0x9e3779b97f4a7c15ul + (hash << 6u) + (hash >> 2u); };
+            combine(H5Tget_size(type));
+            switch(h5class) {
+                case H5T_class_t::H5T_INTEGER: combine(static_cast<size_t>(H5Tget_sign(type))); [[fallthrough]];
+                case H5T_class_t::H5T_FLOAT: {
+                    combine(static_cast<size_t>(H5Tget_order(type)));
+                    combine(H5Tget_precision(type));
+                    break;
                 }
-                if(h5mclass == H5T_class_t::H5T_INTEGER){
-                    auto h5msign  = H5Tget_sign(h5mtype);
-                    if(h5msign  == H5T_sign_t::H5T_SGN_ERROR) throw h5pp::runtime_error("H5Tget_sign() failed on integral type");
-                    if(h5msign == H5T_sign_t::H5T_SGN_NONE){
-                        if (H5T_COMPLEX<unsigned short>::equal(type))       return getCppType<std::complex<unsigned short>>();
-                        if (H5T_COMPLEX<unsigned int>::equal(type))         return getCppType<std::complex<unsigned int>>();
-                        if (H5T_COMPLEX<unsigned long>::equal(type))        return getCppType<std::complex<unsigned long>>();
-                        if (H5T_COMPLEX<unsigned long long>::equal(type))   return getCppType<std::complex<unsigned long long>>();
-                    }
-                    if(h5msign == H5T_sign_t::H5T_SGN_2){
-                        if (H5T_COMPLEX<short>::equal(type))       return getCppType<std::complex<short>>();
-                        if (H5T_COMPLEX<int>::equal(type))         return getCppType<std::complex<int>>();
-                        if (H5T_COMPLEX<long>::equal(type))        return getCppType<std::complex<long>>();
-                        if (H5T_COMPLEX<long long>::equal(type))   return getCppType<std::complex<long long>>();
+                case H5T_class_t::H5T_COMPOUND: {
+                    auto nmembers = type::safe_cast<unsigned int>(H5Tget_nmembers(type));
+                    combine(nmembers);
+                    for(unsigned int idx = 0; idx < nmembers; idx++) {
+                        char *name = H5Tget_member_name(type, idx);
+                        combine(std::hash<std::string_view>()(name));
+                        H5free_memory(name);
+                        combine(H5Tget_member_offset(type, idx));
+                        hid::h5t memberType = H5Tget_member_type(type, idx);
+                        combine(getH5TypeFingerprint(memberType));
                     }
+                    break;
                 }
+                default: break;
             }
-            if(is_scalar2(type)){
-                auto h5mtype = H5Tget_member_type(type,0);
-                auto h5mclass = H5Tget_class(h5mtype);
-                if(h5mclass == H5T_class_t::H5T_FLOAT){
-                    if (H5T_SCALAR2<float>::equal(type))            return getCppType<h5pp::type::compound::Scalar2<float>>();
-                    if (H5T_SCALAR2<double>::equal(type))           return getCppType<h5pp::type::compound::Scalar2<double>>();
-                    if (H5T_SCALAR2<long double>::equal(type))      return getCppType<h5pp::type::compound::Scalar2<long double>>();
-                }
-                if(h5mclass == H5T_class_t::H5T_INTEGER){
-                    auto h5msign  = H5Tget_sign(h5mtype);
-                    if(h5msign  == H5T_sign_t::H5T_SGN_ERROR) throw h5pp::runtime_error("H5Tget_sign() failed on integral type");
-                    if(h5msign == H5T_sign_t::H5T_SGN_NONE){
-                        if (H5T_SCALAR2<unsigned short>::equal(type))       return getCppType<h5pp::type::compound::Scalar2<unsigned short>>();
-                        if (H5T_SCALAR2<unsigned int>::equal(type))         return getCppType<h5pp::type::compound::Scalar2<unsigned int>>();
-                        if (H5T_SCALAR2<unsigned long>::equal(type))        return getCppType<h5pp::type::compound::Scalar2<unsigned long>>();
-                        if (H5T_SCALAR2<unsigned long long>::equal(type))   return getCppType<h5pp::type::compound::Scalar2<unsigned long long>>();
-                    }
-                    if(h5msign == H5T_sign_t::H5T_SGN_2){
-                        if (H5T_SCALAR2<short>::equal(type))       return getCppType<h5pp::type::compound::Scalar2<short>>();
-                        if (H5T_SCALAR2<int>::equal(type))         return getCppType<h5pp::type::compound::Scalar2<int>>();
-                        if (H5T_SCALAR2<long>::equal(type))        return getCppType<h5pp::type::compound::Scalar2<long>>();
-                        if (H5T_SCALAR2<long long>::equal(type))   return getCppType<h5pp::type::compound::Scalar2<long long>>();
-                    }
-                }
+            return hash;
+        }
+
+        /*! Precomputed table of the HDF5 types that getCppType(const hid::h5t &) can map to a C++ type, keyed by fingerprint.
+         *
+         * Types that share a fingerprint (e.g. long and long long on most platforms) are kept in the order of preference,
+         * and told apart with H5Tequal. The table is built once, and rebuilt if the HDF5 library has been closed and reopened.
+         */
+        class CppTypeTable {
+            private:
+            using CppType = std::tuple<std::type_index, std::string, size_t>;
+            struct Entry {
+                hid::h5t h5type;
+                CppType  cppType;
+            };
+            inline static std::unordered_map<size_t, std::vector<Entry>> table;
+            inline static hid::h5t                                        sentinel; // Invalidated when HDF5 is closed
+            inline static std::mutex                                      mutex;
+
+            template<typename T>
+            static void add() {
+                hid::h5t h5type = getH5Type<T>();
+                table[getH5TypeFingerprint(h5type)].push_back({h5type, getCppType<T>()});
             }
-            if(is_scalar3(type)){
-                auto h5mtype = H5Tget_member_type(type,0);
-                auto h5mclass = H5Tget_class(h5mtype);
-                if(h5mclass == H5T_class_t::H5T_FLOAT){
-                    if (H5T_SCALAR3<float>::equal(type))            return getCppType<h5pp::type::compound::Scalar3<float>>();
-                    if (H5T_SCALAR3<double>::equal(type))           return getCppType<h5pp::type::compound::Scalar3<double>>();
-                    if (H5T_SCALAR3<long double>::equal(type))      return getCppType<h5pp::type::compound::Scalar3<long double>>();
-                }
-                if(h5mclass == H5T_class_t::H5T_INTEGER){
-                    auto h5msign  = H5Tget_sign(h5mtype);
-                    if(h5msign  == H5T_sign_t::H5T_SGN_ERROR) throw h5pp::runtime_error("H5Tget_sign() failed on integral type");
-                    if(h5msign == H5T_sign_t::H5T_SGN_NONE){
-                        if (H5T_SCALAR3<unsigned short>::equal(type))       return getCppType<h5pp::type::compound::Scalar3<unsigned short>>();
-                        if (H5T_SCALAR3<unsigned int>::equal(type))         return getCppType<h5pp::type::compound::Scalar3<unsigned int>>();
-                        if (H5T_SCALAR3<unsigned long>::equal(type))        return getCppType<h5pp::type::compound::Scalar3<unsigned long>>();
-                        if (H5T_SCALAR3<unsigned long long>::equal(type))   return getCppType<h5pp::type::compound::Scalar3<unsigned long long>>();
-                    }
-                    if(h5msign == H5T_sign_t::H5T_SGN_2){
-                        if (H5T_SCALAR3<short>::equal(type))       return getCppType<h5pp::type::compound::Scalar3<short>>();
-                        if (H5T_SCALAR3<int>::equal(type))         return getCppType<h5pp::type::compound::Scalar3<int>>();
-                        if (H5T_SCALAR3<long>::equal(type))        return getCppType<h5pp::type::compound::Scalar3<long>>();
-                        if (H5T_SCALAR3<long long>::equal(type))   return getCppType<h5pp::type::compound::Scalar3<long long>>();
-                    }
+            template<typename T>
+            static void addNumeric() {
+                add<T>();
+                add<std::complex<T>>();
+                add<h5pp::type::compound::Scalar2<T>>();
+                add<h5pp::type::compound::Scalar3<T>>();
+            }
+            static void init() {
+                if(sentinel.valid()) return;
+                std::lock_guard<std::mutex> lock(mutex);
+                if(sentinel.valid()) return;
+                table.clear();
+                addNumeric<unsigned short>();
+                addNumeric<unsigned int>();
+                addNumeric<unsigned long>();
+                addNumeric<unsigned long long>();
+                addNumeric<short>();
+                addNumeric<int>();
+                addNumeric<long>();
+                addNumeric<long long>();
+                addNumeric<float>();
+                addNumeric<double>();
+                addNumeric<long double>();
+#if defined(H5PP_USE_FLOAT128) || defined(H5PP_USE_QUADMATH)
+                add<h5pp::fp128>();
+                add<std::complex<h5pp::fp128>>();
+#endif
+                sentinel = H5Tcopy(H5T_NATIVE_INT);
+            }
+
+            public:
+            [[nodiscard]] static std::optional<CppType> find(const hid::h5t &type, H5T_class_t h5class) {
+                // The table only has numbers and complex/Scalar2/Scalar3 compounds
+                if(h5class != H5T_class_t::H5T_INTEGER and h5class != H5T_class_t::H5T_FLOAT and h5class != H5T_class_t::H5T_COMPOUND)
+                    return std::nullopt;
+                if(h5class == H5T_class_t::H5T_COMPOUND) {
+                    auto nmembers = H5Tget_nmembers(type);
+                    if(nmembers != 2 and nmembers != 3) return std::nullopt;
                 }
+                init();
+                auto bucket = table.find(getH5TypeFingerprint(type));
+                if(bucket == table.end()) return std::nullopt;
+                const auto &entries = bucket->second;
+                if(entries.size() == 1) return entries.front().cppType;
+                for(const auto &entry : entries)
+                    if(H5Tequal(entry.h5type, type) > 0) return entry.cppType;
+                return std::nullopt;
             }
+        };
+    }
 
+    [[nodiscard]] inline std::tuple<std::type_index, std::string, size_t> getCppType(const hid::h5t &type) {
+        auto h5class = H5Tget_class(type);
+        if(auto cppType = internal::CppTypeTable::find(type, h5class)) return cppType.value();
+
+        /* clang-format off */
+        if(h5class == H5T_class_t::H5T_STRING){
+            return getCppType<std::string>();
+        }else if (h5class == H5T_class_t::H5T_VLEN){
+            return getCppType<hvl_t>();
+        }else if (h5class == H5T_COMPOUND){
             // type is some other compound type.
             auto h5size  = H5Tget_size(type);
             auto h5type = H5Tget_native_type(type, H5T_direction_t::H5T_DIR_DEFAULT); // Unrolls nested compound types
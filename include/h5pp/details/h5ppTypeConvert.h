@@ -0,0 +1,142 @@
+#pragma once
+#include "h5ppTypeSfinae.h"
+#include <cstddef>
+#include <cstdint>
+#include <H5Tpublic.h>
+#include <limits>
+#include <optional>
+#include <type_traits>
+
+/*!
+ * \brief Element-wise conversions between native numeric types, used instead of the HDF5 conversion path.
+ *
+ * HDF5 converts between numeric types one conversion buffer at a time, with generic, per-element code.
+ * When the dataset and the memory buffer hold different native numeric types, h5pp instead reads or writes
+ * the dataset type in blocks and converts each block with the loops below. The loops have no branches
+ * and no aliasing, so that compilers vectorize them.
+ *
+ * The results match those of HDF5: floating point values are rounded to the nearest representable value,
+ * and integers that are out of range saturate at the limits of the target type.
+ * Conversions between integers and floating point types are left to HDF5.
+ */
+namespace h5pp::type::convert {
+    enum class Numeric { f32, f64, i8, i16, i32, i64, u8, u16, u32, u64 };
+
+    template<typename T>
+    struct Tag {
+        using type = T;
+    };
+
+    /*! Returns the kind of numeric type of a C++ type, or std::nullopt if h5pp does not convert it */
+    template<typename T>
+    [[nodiscard]] constexpr std::optional<Numeric> getNumeric() {
+        /* clang-format off */
+        if constexpr(std::is_same_v<T, float>)                                      return Numeric::f32;
+        else if constexpr(std::is_same_v<T, double>)                                return Numeric::f64;
+        else if constexpr(not std::is_integral_v<T> or std::is_same_v<T, bool>)     return std::nullopt;
+        else if constexpr(std::is_same_v<T, char>)                                  return std::nullopt; // Text
+        else if constexpr(std::is_signed_v<T>   and sizeof(T) == 1)                 return Numeric::i8;
+        else if constexpr(std::is_signed_v<T>   and sizeof(T) == 2)                 return Numeric::i16;
+        else if constexpr(std::is_signed_v<T>   and sizeof(T) == 4)                 return Numeric::i32;
+        else if constexpr(std::is_signed_v<T>   and sizeof(T) == 8)                 return Numeric::i64;
+        else if constexpr(std::is_unsigned_v<T> and sizeof(T) == 1)                 return Numeric::u8;
+        else if constexpr(std::is_unsigned_v<T> and sizeof(T) == 2)                 return Numeric::u16;
+        else if constexpr(std::is_unsigned_v<T> and sizeof(T) == 4)                 return Numeric::u32;
+        else if constexpr(std::is_unsigned_v<T> and sizeof(T) == 8)                 return Numeric::u64;
+        else                                                                        return std::nullopt;
+        /* clang-format on */
+    }
+
+    /*! Returns the kind of numeric type of an HDF5 type, or std::nullopt if it is not equal to a native numeric type */
+    [[nodiscard]] inline std::optional<Numeric> getNumeric(hid_t h5type) {
+        auto h5class = H5Tget_class(h5type);
+        auto size    = H5Tget_size(h5type);
+        /* clang-format off */
+        auto [native, numeric] = [&]() -> std::pair<hid_t, std::optional<Numeric>> {
+            if(h5class == H5T_FLOAT and size == 4) return {H5T_NATIVE_FLOAT, Numeric::f32};
+            if(h5class == H5T_FLOAT and size == 8) return {H5T_NATIVE_DOUBLE, Numeric::f64};
+            if(h5class != H5T_INTEGER)             return {0, std::nullopt};
+            bool isSigned = H5Tget_sign(h5type) == H5T_SGN_2;
+            switch(size) {
+                case 1: return isSigned ? std::pair(H5T_NATIVE_INT8,  Numeric::i8)  : std::pair(H5T_NATIVE_UINT8,  Numeric::u8);
+                case 2: return isSigned ? std::pair(H5T_NATIVE_INT16, Numeric::i16) : std::pair(H5T_NATIVE_UINT16, Numeric::u16);
+                case 4: return isSigned ? std::pair(H5T_NATIVE_INT32, Numeric::i32) : std::pair(H5T_NATIVE_UINT32, Numeric::u32);
+                case 8: return isSigned ? std::pair(H5T_NATIVE_INT64, Numeric::i64) : std::pair(H5T_NATIVE_UINT64, Numeric::u64);
+                default: return {0, std::nullopt};
+            }
+        }();
+        /* clang-format on */
+        // Also checks byte order, precision and padding
+        if(not numeric or H5Tequal(h5type, native) <= 0) return std::nullopt;
+        return numeric;
+    }
+
+    /*! Calls func with a Tag of the C++ type corresponding to numeric */
+    template<typename Func>
+    void visit(Numeric numeric, Func &&func) {
+        switch(numeric) {
+            case Numeric::f32: return func(Tag<float>());
+            case Numeric::f64: return func(Tag<double>());
+            case Numeric::i8: return func(Tag<int8_t>());
+            case Numeric::i16: return func(Tag<int16_t>());
+            case Numeric::i32: return func(Tag<int32_t>());
+            case Numeric::i64: return func(Tag<int64_t>());
+            case Numeric::u8: return func(Tag<uint8_t>());
+            case Numeric::u16: return func(Tag<uint16_t>());
+            case Numeric::u32: return func(Tag<uint32_t>());
+            case Numeric::u64: return func(Tag<uint64_t>());
+        }
+    }
+
+    /*! True if h5pp converts from Src to Dst itself: between float and double, and between integers of any width and sign */
+    template<typename Src, typename Dst>
+    inline constexpr bool is_supported_v = not std::is_same_v<Src, Dst> and
+                                           ((std::is_floating_point_v<Src> and std::is_floating_point_v<Dst>) or
+                                            (std::is_integral_v<Src> and std::is_integral_v<Dst>));
+
+    [[nodiscard]] inline bool isSupported(Numeric src, Numeric dst) {
+        bool supported = false;
+        visit(src, [&](auto srcTag) {
+            visit(dst, [&](auto dstTag) { supported = is_supported_v<typename decltype(srcTag)::type, typename decltype(dstTag)::type>; });
+        });
+        return supported;
+    }
+
+    /*! Converts n elements from src to dst */
+    template<typename Src, typename Dst>
+    void convert(const Src *__restrict src, Dst *__restrict dst, size_t n) {
+        static_assert(is_supported_v<Src, Dst>);
+        if constexpr(std::is_floating_point_v<Src>) {
+            for(size_t i = 0; i < n; ++i) dst[i] = static_cast<Dst>(src[i]);
+        } else {
+            // Clamp to the range of Dst, expressed in Src, whenever the range of Src exceeds it
+            constexpr bool clampLow = std::is_signed_v<Src> and (std::is_unsigned_v<Dst> or sizeof(Dst) < sizeof(Src));
+            constexpr bool clampHigh =
+                std::is_signed_v<Src> == std::is_signed_v<Dst> ? sizeof(Dst) < sizeof(Src)
+                                                               : (std::is_signed_v<Src> ? sizeof(Dst) < sizeof(Src) : sizeof(Dst) <= sizeof(Src));
+            constexpr Src low  = clampLow ? static_cast<Src>(std::numeric_limits<Dst>::lowest()) : Src(0);
+            constexpr Src high = clampHigh ? static_cast<Src>(std::numeric_limits<Dst>::max()) : Src(0);
+            for(size_t i = 0; i < n; ++i) {
+                Src val = src[i];
+                if constexpr(clampLow) val = val < low ? low : val;
+                if constexpr(clampHigh) val = val > high ? high : val;
+                dst[i] = static_cast<Dst>(val);
+            }
+        }
+    }
+
+    /*! Tags the numeric element type of a container such as std::vector<double>, a C array or an Eigen type. Tags void otherwise */
+    template<typename DataType, size_t depth = 0>
+    constexpr auto getNumericElement() {
+        namespace sfn   = h5pp::type::sfinae;
+        using DecayType = std::decay_t<DataType>;
+        /* clang-format off */
+        if constexpr(std::is_array_v<DecayType> and depth == 0)                            return getNumericElement<std::remove_all_extents_t<DecayType>, depth + 1>();
+        else if constexpr(getNumeric<DecayType>().has_value())                             return Tag<DecayType>();
+        else if constexpr(sfn::is_std_complex_v<DecayType> or sfn::is_ScalarN_v<DecayType>) return Tag<void>();
+        else if constexpr(sfn::has_Scalar_v<DecayType> and depth == 0)                     return getNumericElement<typename DecayType::Scalar, depth + 1>();
+        else if constexpr(sfn::has_value_type_v<DecayType> and depth == 0)                 return getNumericElement<typename DecayType::value_type, depth + 1>();
+        else                                                                               return Tag<void>();
+        /* clang-format on */
+    }
+}
@@ -0,0 +1,139 @@
+#pragma once
+#include <cstddef>
+#include <string_view>
+#include <type_traits>
+
+/*!
+ * \brief Compile-time registration of user-defined structs as HDF5 compound types.
+ *
+ * Use the macro H5PP_REGISTER_COMPOUND in the global namespace, after the definition of the struct,
+ * and list the members that should be stored:
+ *
+ *      struct Particle {
+ *          double x, y, z, t;
+ *          int    id;
+ *          char   name[10];
+ *      };
+ *      H5PP_REGISTER_COMPOUND(Particle, x, y, z, t, id, name)
+ *
+ * h5pp::type::getH5Type<Particle>() then returns a compound type with one field per listed member, named after
+ * the member and placed at its offset in the struct. The type is built once, on first use.
+ *
+ * Members may be
+ *  - arithmetic types, std::complex and other types known to getH5Type
+ *  - fixed-length strings: char[N], std::array<char,N> or h5pp::fstr_t<N>
+ *  - C arrays and std::array, which become H5T_ARRAY fields
+ *  - other registered structs, which become nested compound fields
+ *
+ * The struct must have standard layout, so that the member offsets are well-defined.
+ */
+namespace h5pp::type::compound {
+    /*! Carries a member type into the callback of Members<T>::for_each */
+    template<typename T>
+    struct Tag {
+        using type = T;
+    };
+
+    /*! Lists the members of a struct. Specialized by H5PP_REGISTER_COMPOUND */
+    template<typename T>
+    struct Members {
+        static constexpr bool registered = false;
+    };
+
+    template<typename T>
+    inline constexpr bool is_registered_v = Members<std::remove_cv_t<T>>::registered;
+}
+
+/* clang-format off */
+#define H5PP_EXPAND(x) x
+#define H5PP_FE_1(F, T, x) F(T, x)
+#define H5PP_FE_2(F, T, x, ...) F(T, x) H5PP_EXPAND(H5PP_FE_1(F, T, __VA_ARGS__))
+#define H5PP_FE_3(F, T, x, ...) F(T, x) H5PP_EXPAND(H5PP_FE_2(F, T, __VA_ARGS__))
+#define H5PP_FE_4(F, T, x, ...) F(T, x) H5PP_EXPAND(H5PP_FE_3(F, T, __VA_ARGS__))
+#define H5PP_FE_5(F, T, x, ...) F(T, x) H5PP_EXPAND(H5PP_FE_4(F, T, __VA_ARGS__))
+#define H5PP_FE_6(F, T, x, ...) F(T, x) H5PP_EXPAND(H5PP_FE_5(F, T, __VA_ARGS__))
+#define H5PP_FE_7(F, T, x, ...) F(T, x) H5PP_EXPAND(H5PP_FE_6(F, T, __VA_ARGS__))
+#define H5PP_FE_8(F, T, x, ...) F(T, x) H5PP_EXPAND(H5PP_FE_7(F, T, __VA_ARGS__))
+#define H5PP_FE_9(F, T, x, ...) F(T, x) H5PP_EXPAND(H5PP_FE_8(F, T, __VA_ARGS__))
+#define H5PP_FE_10(F, T, x, ...) F(T, x) H5PP_EXPAND(H5PP_FE_9(F, T, __VA_ARGS__))
+#define H5PP_FE_11(F, T, x, ...) F(T, x) H5PP_EXPAND(H5PP_FE_10(F, T, __VA_ARGS__))
+#define H5PP_FE_12(F, T, x, ...) F(T, x) H5PP_EXPAND(H5PP_FE_11(F, T, __VA_ARGS__))
+#define H5PP_FE_13(F, T, x, ...) F(T, x) H5PP_EXPAND(H5PP_FE_12(F, T, __VA_ARGS__))
+#define H5PP_FE_14(F, T, x, ...) F(T, x) H5PP_EXPAND(H5PP_FE_13(F, T, __VA_ARGS__))
+#define H5PP_FE_15(F, T, x, ...) F(T, x) H5PP_EXPAND(H5PP_FE_14(F, T, __VA_ARGS__))
+#define H5PP_FE_16(F, T, x, ...) F(T, x) H5PP_EXPAND(H5PP_FE_15(F, T, __VA_ARGS__))
+#define H5PP_FE_17(F, T, x, ...) F(T, x) H5PP_EXPAND(H5PP_FE_16(F, T, __VA_ARGS__))
+#define H5PP_FE_18(F, T, x, ...) F(T, x) H5PP_EXPAND(H5PP_FE_17(F, T, __VA_ARGS__))
+#define H5PP_FE_19(F, T, x, ...) F(T, x) H5PP_EXPAND(H5PP_FE_18(F, T, __VA_ARGS__))
+#define H5PP_FE_20(F, T, x, ...) F(T, x) H5PP_EXPAND(H5PP_FE_19(F, T, __VA_ARGS__))
+#define H5PP_FE_21(F, T, x, ...) F(T, x) H5PP_EXPAND(H5PP_FE_20(F, T, __VA_ARGS__))
+#define H5PP_FE_22(F, T, x, ...) F(T, x) H5PP_EXPAND(H5PP_FE_21(F, T, __VA_ARGS__))
+#define H5PP_FE_23(F, T, x, ...) F(T, x) H5PP_EXPAND(H5PP_FE_22(F, T, __VA_ARGS__))
+#define H5PP_FE_24(F, T, x, ...) F(T, x) H5PP_EXPAND(H5PP_FE_23(F, T, __VA_ARGS__))
+#define H5PP_FE_25(F, T, x, ...) F(T, x) H5PP_EXPAND(H5PP_FE_24(F, T, __VA_ARGS__))
+#define H5PP_FE_26(F, T, x, ...) F(T, x) H5PP_EXPAND(H5PP_FE_25(F, T, __VA_ARGS__))
+#define H5PP_FE_27(F, T, x, ...) F(T, x) H5PP_EXPAND(H5PP_FE_26(F, T, __VA_ARGS__))
+#define H5PP_FE_28(F, T, x, ...) F(T, x) H5PP_EXPAND(H5PP_FE_27(F, T, __VA_ARGS__))
+#define H5PP_FE_29(F, T, x, ...) F(T, x) H5PP_EXPAND(H5PP_FE_28(F, T, __VA_ARGS__))
+#define H5PP_FE_30(F, T, x, ...) F(T, x) H5PP_EXPAND(H5PP_FE_29(F, T, __VA_ARGS__))
+#define H5PP_FE_31(F, T, x, ...) F(T, x) H5PP_EXPAND(H5PP_FE_30(F, T, __VA_ARGS__))
+#define H5PP_FE_32(F, T, x, ...) F(T, x) H5PP_EXPAND(H5PP_FE_31(F, T, __VA_ARGS__))
+#define H5PP_FE_33(F, T, x, ...) F(T, x) H5PP_EXPAND(H5PP_FE_32(F, T, __VA_ARGS__))
+#define H5PP_FE_34(F, T, x, ...) F(T, x) H5PP_EXPAND(H5PP_FE_33(F, T, __VA_ARGS__))
+#define H5PP_FE_35(F, T, x, ...) F(T, x) H5PP_EXPAND(H5PP_FE_34(F, T, __VA_ARGS__))
+#define H5PP_FE_36(F, T, x, ...) F(T, x) H5PP_EXPAND(H5PP_FE_35(F, T, __VA_ARGS__))
+#define H5PP_FE_37(F, T, x, ...) F(T, x) H5PP_EXPAND(H5PP_FE_36(F, T, __VA_ARGS__))
+#define H5PP_FE_38(F, T, x, ...) F(T, x) H5PP_EXPAND(H5PP_FE_37(F, T, __VA_ARGS__))
+#define H5PP_FE_39(F, T, x, ...) F(T, x) H5PP_EXPAND(H5PP_FE_38(F, T, __VA_ARGS__))
+#define H5PP_FE_40(F, T, x, ...) F(T, x) H5PP_EXPAND(H5PP_FE_39(F, T, __VA_ARGS__))
+#define H5PP_FE_41(F, T, x, ...) F(T, x) H5PP_EXPAND(H5PP_FE_40(F, T, __VA_ARGS__))
+#define H5PP_FE_42(F, T, x, ...) F(T, x) H5PP_EXPAND(H5PP_FE_41(F, T, __VA_ARGS__))
+#define H5PP_FE_43(F, T, x, ...) F(T, x) H5PP_EXPAND(H5PP_FE_42(F, T, __VA_ARGS__))
+#define H5PP_FE_44(F, T, x, ...) F(T, x) H5PP_EXPAND(H5PP_FE_43(F, T, __VA_ARGS__))
+#define H5PP_FE_45(F, T, x, ...) F(T, x) H5PP_EXPAND(H5PP_FE_44(F, T, __VA_ARGS__))
+#define H5PP_FE_46(F, T, x, ...) F(T, x) H5PP_EXPAND(H5PP_FE_45(F, T, __VA_ARGS__))
+#define H5PP_FE_47(F, T, x, ...) F(T, x) H5PP_EXPAND(H5PP_FE_46(F, T, __VA_ARGS__))
+#define H5PP_FE_48(F, T, x, ...) F(T, x) H5PP_EXPAND(H5PP_FE_47(F, T, __VA_ARGS__))
+#define H5PP_FE_49(F, T, x, ...) F(T, x) H5PP_EXPAND(H5PP_FE_48(F, T, __VA_ARGS__))
+#define H5PP_FE_50(F, T, x, ...) F(T, x) H5PP_EXPAND(H5PP_FE_49(F, T, __VA_ARGS__))
+#define H5PP_FE_51(F, T, x, ...) F(T, x) H5PP_EXPAND(H5PP_FE_50(F, T, __VA_ARGS__))
+#define H5PP_FE_52(F, T, x, ...) F(T, x) H5PP_EXPAND(H5PP_FE_51(F, T, __VA_ARGS__))
+#define H5PP_FE_53(F, T, x, ...) F(T, x) H5PP_EXPAND(H5PP_FE_52(F, T, __VA_ARGS__))
+#define H5PP_FE_54(F, T, x, ...) F(T, x) H5PP_EXPAND(H5PP_FE_53(F, T, __VA_ARGS__))
+#define H5PP_FE_55(F, T, x, ...) F(T, x) H5PP_EXPAND(H5PP_FE_54(F, T, __VA_ARGS__))
+#define H5PP_FE_56(F, T, x, ...) F(T, x) H5PP_EXPAND(H5PP_FE_55(F, T, __VA_ARGS__))
+#define H5PP_FE_57(F, T, x, ...) F(T, x) H5PP_EXPAND(H5PP_FE_56(F, T, __VA_ARGS__))
+#define H5PP_FE_58(F, T, x, ...) F(T, x) H5PP_EXPAND(H5PP_FE_57(F, T, __VA_ARGS__))
+#define H5PP_FE_59(F, T, x, ...) F(T, x) H5PP_EXPAND(H5PP_FE_58(F, T, __VA_ARGS__))
+#define H5PP_FE_60(F, T, x, ...) F(T, x) H5PP_EXPAND(H5PP_FE_59(F, T, __VA_ARGS__))
+#define H5PP_FE_61(F, T, x, ...) F(T, x) H5PP_EXPAND(H5PP_FE_60(F, T, __VA_ARGS__))
+#define H5PP_FE_62(F, T, x, ...) F(T, x) H5PP_EXPAND(H5PP_FE_61(F, T, __VA_ARGS__))
+#define H5PP_FE_63(F, T, x, ...) F(T, x) H5PP_EXPAND(H5PP_FE_62(F, T, __VA_ARGS__))
+#define H5PP_FE_64(F, T, x, ...) F(T, x) H5PP_EXPAND(H5PP_FE_63(F, T, __VA_ARGS__))
+#define H5PP_FE_SELECT(_1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, _16, _17, _18, _19, _20, _21, _22, _23, \
+    _24, _25, _26, _27, _28, _29, _30, _31, _32, _33, _34, _35, _36, _37, _38, _39, _40, _41, _42, _43, _44, _45, _46, _47, _48, \
+    _49, _50, _51, _52, _53, _54, _55, _56, _57, _58, _59, _60, _61, _62, _63, _64, NAME, ...) NAME
+#define H5PP_FOR_EACH(F, T, ...) \
+    H5PP_EXPAND(H5PP_FE_SELECT(__VA_ARGS__, H5PP_FE_64, H5PP_FE_63, H5PP_FE_62, H5PP_FE_61, H5PP_FE_60, H5PP_FE_59, H5PP_FE_58, \
+    H5PP_FE_57, H5PP_FE_56, H5PP_FE_55, H5PP_FE_54, H5PP_FE_53, H5PP_FE_52, H5PP_FE_51, H5PP_FE_50, H5PP_FE_49, H5PP_FE_48, \
+    H5PP_FE_47, H5PP_FE_46, H5PP_FE_45, H5PP_FE_44, H5PP_FE_43, H5PP_FE_42, H5PP_FE_41, H5PP_FE_40, H5PP_FE_39, H5PP_FE_38, \
+    H5PP_FE_37, H5PP_FE_36, H5PP_FE_35, H5PP_FE_34, H5PP_FE_33, H5PP_FE_32, H5PP_FE_31, H5PP_FE_30, H5PP_FE_29, H5PP_FE_28, \
+    H5PP_FE_27, H5PP_FE_26, H5PP_FE_25, H5PP_FE_24, H5PP_FE_23, H5PP_FE_22, H5PP_FE_21, H5PP_FE_20, H5PP_FE_19, H5PP_FE_18, \
+    H5PP_FE_17, H5PP_FE_16, H5PP_FE_15, H5PP_FE_14, H5PP_FE_13, H5PP_FE_12, H5PP_FE_11, H5PP_FE_10, H5PP_FE_9, H5PP_FE_8, \
+    H5PP_FE_7, H5PP_FE_6, H5PP_FE_5, H5PP_FE_4, H5PP_FE_3, H5PP_FE_2, H5PP_FE_1)(F, T, __VA_ARGS__))
+
+/* clang-format on */
+
+#define H5PP_COMPOUND_MEMBER(Type, member) func(std::string_view(#member), offsetof(Type, member), h5pp::type::compound::Tag<decltype(Type::member)>());
+
+/*! Registers the struct Type as an HDF5 compound type with the given members (up to 64). Use in the global namespace. */
+#define H5PP_REGISTER_COMPOUND(Type, ...)                                                                                  \
+    template<>                                                                                                             \
+    struct h5pp::type::compound::Members<Type> {                                                                           \
+        static constexpr bool registered = true;                                                                           \
+        template<typename Func>                                                                                            \
+        static void for_each(Func &&func) {                                                                                \
+            static_assert(std::is_standard_layout_v<Type>, "H5PP_REGISTER_COMPOUND requires a struct with standard layout"); \
+            H5PP_FOR_EACH(H5PP_COMPOUND_MEMBER, Type, __VA_ARGS__)                                                         \
+        }                                                                                                                  \
+    };
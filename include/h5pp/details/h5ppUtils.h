@@ -404,7 +404,9 @@ namespace h5pp::util {
             return h5pp::util::getSize(data) * h5pp::util::getBytesPerElem<DataType>();
         } else if constexpr(h5pp::type::sfinae::is_iterable_v<DataType> and h5pp::type::sfinae::has_value_type_v<DataType>) {
             using value_type = typename DataType::value_type;
-            if constexpr(h5pp::type::sfinae::has_size_v<value_type>) { // E.g. std::vector<std::string>
+            if constexpr(h5pp::type::sfinae::is_fstr_v<value_type>) { // E.g. std::vector<h5pp::fstr_t<N>>: N bytes each
+                return h5pp::util::getSize(data) * sizeof(value_type);
+            } else if constexpr(h5pp::type::sfinae::has_size_v<value_type>) { // E.g. std::vector<std::string>
                 // Count all the null terminators
                 size_t num      = 0;
                 size_t nullterm = h5pp::type::sfinae::is_text_v<value_type> ? 1 : 0;
@@ -432,7 +434,8 @@ namespace h5pp::util {
         }
     }
 
-    [[nodiscard]] inline H5D_layout_t decideLayout(const size_t totalBytes) {
+    [[nodiscard]] inline std::pair<H5D_layout_t, std::string>
+        decideLayoutWithReason(const size_t totalBytes, std::optional<int> compression = std::nullopt, const LayoutPolicy &policy = LayoutPolicy()) {
         /*! Depending on the size of this dataset we may benefint from using either
             a contiguous layout (for big non-extendable non-compressible datasets),
             a chunked layout (for extendable and compressible datasets)
@@ -456,24 +459,24 @@ namespace h5pp::util {
             will always be allocated for a dataset. However, the object header is 64 KB in size,
             so this layout can only be used for very small datasets.
          */
-        // Otherwise, we decide based on size
-        if(totalBytes < h5pp::constants::maxSizeCompact) {
-            h5pp::logger::log->trace("Selected layout H5D_COMPACT because byte size {} < {}", totalBytes, h5pp::constants::maxSizeCompact);
-            return H5D_COMPACT;
-        } else if(totalBytes < h5pp::constants::maxSizeContiguous) {
-            h5pp::logger::log->trace("Selected layout H5D_CONTIGUOUS because byte size {} is between {} and {}",
-                                     totalBytes,
-                                     h5pp::constants::maxSizeCompact,
-                                     h5pp::constants::maxSizeContiguous);
-            return H5D_CONTIGUOUS;
+        // We decide based on size, unless compression is requested
+        std::pair<H5D_layout_t, std::string> decision;
+        if(totalBytes < policy.maxSizeCompact and policy.compactIfSmall) {
+            decision = {H5D_COMPACT, h5pp::format("H5D_COMPACT because byte size {} < {}", totalBytes, policy.maxSizeCompact)};
+        } else if(compression and compression.value() > 0 and policy.chunkIfCompressed) {
+            decision = {H5D_CHUNKED, h5pp::format("H5D_CHUNKED because compression level {} requires chunks", compression.value())};
+        } else if(totalBytes < policy.maxSizeContiguous) {
+            decision = {H5D_CONTIGUOUS, h5pp::format("H5D_CONTIGUOUS because byte size {} < {}", totalBytes, policy.maxSizeContiguous)};
+            if(totalBytes < policy.maxSizeCompact) decision.second.append(" and compact layout is disabled by policy");
         } else {
-            h5pp::logger::log->trace("Selected layout H5D_CHUNKED because byte size {} > {}",
-                                     totalBytes,
-                                     h5pp::constants::maxSizeContiguous);
-            return H5D_CHUNKED;
+            decision = {H5D_CHUNKED, h5pp::format("H5D_CHUNKED because byte size {} >= {}", totalBytes, policy.maxSizeContiguous)};
         }
+        h5pp::logger::log->trace("Selected layout {}", decision.second);
+        return decision;
     }
 
+    [[nodiscard]] inline H5D_layout_t decideLayout(const size_t totalBytes) { return decideLayoutWithReason(totalBytes).first; }
+
     template<typename DataType>
     [[nodiscard]] inline H5D_layout_t
         decideLayout(const DataType &data, std::optional<std::vector<hsize_t>> dsetDims, std::optional<std::vector<hsize_t>> dsetDimsMax) {
@@ -493,12 +496,31 @@ namespace h5pp::util {
         return decideLayout(bytes);
     }
 
-        [[nodiscard]] inline std::optional<std::vector<hsize_t>> getChunkDimensions(size_t                              bytesPerElem,
+    /*! \brief Returns the axis whose extent is kept narrow in the chunk for the given access hint.
+     *  This is the axis along which the data is appended or scanned, or std::nullopt for DEFAULT and RANDOM_TILE.
+     */
+    [[nodiscard]] inline std::optional<size_t> getAccessAxis(size_t rank, AccessHint accessHint, std::optional<size_t> accessAxis = std::nullopt) {
+        if(rank == 0) return std::nullopt;
+        std::optional<size_t> axis;
+        switch(accessHint) {
+            case AccessHint::APPEND: axis = accessAxis.value_or(0); break;
+            case AccessHint::ROW_SCAN: axis = 0; break;
+            case AccessHint::COLUMN_SCAN: axis = rank - 1; break;
+            default: return std::nullopt;
+        }
+        if(axis.value() >= rank)
+            throw h5pp::runtime_error("Access axis {} is out of range for a dataset with rank {}", axis.value(), rank);
+        return axis;
+    }
+
+    [[nodiscard]] inline std::optional<std::vector<hsize_t>> getChunkDimensions(size_t                              bytesPerElem,
                                                                                 std::vector<hsize_t>                dims,
                                                                                 std::optional<std::vector<hsize_t>> dimsMax,
-                                                                                std::optional<H5D_layout_t>         layout) {
-        // Here we make a naive guess for chunk dimensions
-        // We try to make a square in N dimensions with a target byte size of 10 kb - 1 MB.
+                                                                                std::optional<H5D_layout_t>         layout,
+                                                                                std::optional<AccessHint>           accessHint = std::nullopt,
+                                                                                std::optional<size_t>               accessAxis = std::nullopt) {
+        // Here we make a guess for chunk dimensions.
+        // Without an access hint we try to make a square in N dimensions with a target byte size of 10 kb - 1 MB.
         // Here is a great read for chunking considerations https://www.oreilly.com/library/view/python-and-hdf5/9781491944981/ch04.html
         // Hard rules for chunk dimensions:
         //  * A chunk dimension cannot be larger than the corresponding max dimension
@@ -530,24 +552,134 @@ namespace h5pp::util {
                 if(dimsMax.value()[idx] != H5S_UNLIMITED) dims[idx] = std::max(dims[idx], dimsMax.value()[idx]);
             }
         }
+        auto hint = accessHint.value_or(AccessHint::DEFAULT);
+        auto rank = dims.size();
+        auto axis = getAccessAxis(rank, hint, accessAxis);
 
-        auto rank             = dims.size();
         auto maxDimension     = *std::max_element(dims.begin(), dims.end());
         auto volumeChunkBytes = std::pow(maxDimension, rank) * static_cast<double>(bytesPerElem);
+        // Appended data is expected to grow beyond its current size, so we aim for the largest chunks
+        if(hint == AccessHint::APPEND and (not dimsMax or dimsMax.value()[axis.value()] == H5S_UNLIMITED))
+            volumeChunkBytes = h5pp::constants::maxChunkBytes;
+        // Random access benefits from small chunks, since every touched chunk is transferred in full
+        if(hint == AccessHint::RANDOM_TILE) volumeChunkBytes = std::min<double>(volumeChunkBytes, h5pp::constants::minChunkBytes);
         auto targetChunkBytes = std::clamp<double>(volumeChunkBytes,
                                                    std::max<double>(static_cast<double>(bytesPerElem), h5pp::constants::minChunkBytes),
                                                    std::max<double>(static_cast<double>(bytesPerElem), h5pp::constants::maxChunkBytes));
         targetChunkBytes      = std::pow(2, std::ceil(std::log2(targetChunkBytes))); // Next nearest power of two
-        auto linearChunkSize  = std::ceil(std::pow(targetChunkBytes / static_cast<double>(bytesPerElem), 1.0 / static_cast<double>(rank)));
-        auto chunkSize        = std::max<hsize_t>(1, static_cast<hsize_t>(linearChunkSize)); // Make sure the chunk size is positive
-        std::vector<hsize_t> chunkDims(rank, chunkSize);
+        std::vector<hsize_t> chunkDims;
+        if(axis) {
+            // Let the chunk span the full extent of all axes except the access axis, so that one
+            // slice along the access axis touches as few chunks as possible. If a single slice is
+            // larger than the target, halve the widest of the other axes until it fits.
+            auto axisIdx     = axis.value();
+            auto targetElems = std::max<hsize_t>(1, static_cast<hsize_t>(targetChunkBytes / static_cast<double>(bytesPerElem)));
+            chunkDims        = dims;
+            chunkDims[axisIdx] = 1;
+            while(getSizeFromDimensions(chunkDims) > targetElems) {
+                size_t widest = axisIdx == 0 ? 1 : 0;
+                for(size_t idx = 0; idx < rank; idx++)
+                    if(idx != axisIdx and chunkDims[idx] > chunkDims[widest]) widest = idx;
+                if(chunkDims[widest] <= 1) break;
+                chunkDims[widest] = (chunkDims[widest] + 1) / 2;
+            }
+            // Then stack as many slices along the access axis as fit in the target
+            hsize_t numSlices = std::max<hsize_t>(1, targetElems / getSizeFromDimensions(chunkDims));
+            if(hint != AccessHint::APPEND) numSlices = std::min(numSlices, dims[axisIdx]);
+            chunkDims[axisIdx] = numSlices;
+        } else {
+            auto linearChunkSize = std::ceil(std::pow(targetChunkBytes / static_cast<double>(bytesPerElem), 1.0 / static_cast<double>(rank)));
+            auto chunkSize       = std::max<hsize_t>(1, static_cast<hsize_t>(linearChunkSize)); // Make sure the chunk size is positive
+            chunkDims            = std::vector<hsize_t>(rank, chunkSize);
+        }
         // Now effective dims contains either dims or dimsMax (if not H5S_UNLIMITED) at each position.
         for(size_t idx = 0; idx < chunkDims.size(); idx++)
-            if(dimsMax.has_value() and dimsMax.value()[idx] != H5S_UNLIMITED) chunkDims[idx] = std::min(dimsMax.value()[idx], chunkSize);
-        h5pp::logger::log->debug("Estimated reasonable chunk dimensions: {}", chunkDims);
+            if(dimsMax.has_value() and dimsMax.value()[idx] != H5S_UNLIMITED) chunkDims[idx] = std::min(dimsMax.value()[idx], chunkDims[idx]);
+        h5pp::logger::log->debug("Estimated reasonable chunk dimensions: {} | access hint {}", chunkDims, enum2str(hint));
         return chunkDims;
     }
 
+    /*! \brief Returns the dimensions of a single request of the given access pattern on a dataset with dimensions dims.
+     *  - DEFAULT: the whole dataset
+     *  - APPEND, ROW_SCAN, COLUMN_SCAN: one slice along the access axis
+     *  - RANDOM_TILE: a square tile of roughly h5pp::constants::minChunkBytes bytes
+     */
+    [[nodiscard]] inline std::vector<hsize_t> getAccessRequestDimensions(size_t                      bytesPerElem,
+                                                                         const std::vector<hsize_t> &dims,
+                                                                         AccessHint                  accessHint,
+                                                                         std::optional<size_t>       accessAxis = std::nullopt) {
+        std::vector<hsize_t> request = dims;
+        for(auto &dim : request) dim = std::max<hsize_t>(1, dim);
+        if(request.empty()) return request;
+        if(auto axis = getAccessAxis(dims.size(), accessHint, accessAxis)) request[axis.value()] = 1;
+        if(accessHint == AccessHint::RANDOM_TILE) {
+            auto tileElems = static_cast<double>(h5pp::constants::minChunkBytes) / static_cast<double>(std::max<size_t>(1, bytesPerElem));
+            auto tileEdge  = std::max<hsize_t>(1, static_cast<hsize_t>(std::pow(tileElems, 1.0 / static_cast<double>(dims.size()))));
+            for(auto &dim : request) dim = std::min(dim, tileEdge);
+        }
+        return request;
+    }
+
+    /*! \brief Returns the expected ratio between the bytes transferred (whole chunks) and the bytes requested,
+     *  when reading a box with dimensions requestDims at a random offset in a dataset with dimensions dims.
+     *  A value of 1 means that no bytes are wasted.
+     */
+    [[nodiscard]] inline double getChunkAmplification(const std::vector<hsize_t> &dims,
+                                                      const std::vector<hsize_t> &chunkDims,
+                                                      const std::vector<hsize_t> &requestDims) {
+        if(dims.size() != chunkDims.size() or dims.size() != requestDims.size())
+            throw h5pp::runtime_error("Could not compute chunk amplification: rank mismatch: dims {} | chunk dims {} | request dims {}",
+                                      dims,
+                                      chunkDims,
+                                      requestDims);
+        double amplification = 1.0;
+        for(size_t idx = 0; idx < dims.size(); idx++) {
+            auto dim     = static_cast<double>(std::max<hsize_t>(1, dims[idx]));
+            auto chunk   = static_cast<double>(std::max<hsize_t>(1, chunkDims[idx]));
+            auto request = static_cast<double>(std::max<hsize_t>(1, requestDims[idx]));
+            // Number of chunks touched along this axis. A request spanning the full axis is aligned,
+            // otherwise we average over all offsets.
+            double touched = request >= dim ? std::ceil(dim / chunk) : 1.0 + (request - 1.0) / chunk;
+            amplification *= touched * chunk / request;
+        }
+        return amplification;
+    }
+
+    /*! \brief Returns a human-readable report of how well the given chunk dimensions suit each access pattern,
+     *  in terms of expected chunks touched and bytes transferred per request.
+     *  If accessHint is given, only that pattern is reported.
+     */
+    [[nodiscard]] inline std::string explainChunking(size_t                                     bytesPerElem,
+                                                     const std::vector<hsize_t>                &dims,
+                                                     const std::optional<std::vector<hsize_t>> &chunkDims,
+                                                     std::optional<AccessHint>                  accessHint = std::nullopt,
+                                                     std::optional<size_t>                      accessAxis = std::nullopt) {
+        if(not chunkDims) return h5pp::format("dims {} | not chunked: transfers touch only the requested bytes\n", dims);
+        if(dims.empty()) return "scalar dataset: chunking has no effect\n";
+        std::string msg = h5pp::format("dims {} | chunk dims {} | chunk bytes {}\n",
+                                       dims,
+                                       chunkDims.value(),
+                                       getSizeFromDimensions(chunkDims.value()) * bytesPerElem);
+        std::vector<AccessHint> hints;
+        if(accessHint) hints = {accessHint.value()};
+        else hints = {AccessHint::DEFAULT, AccessHint::APPEND, AccessHint::ROW_SCAN, AccessHint::COLUMN_SCAN, AccessHint::RANDOM_TILE};
+        for(const auto &hint : hints) {
+            auto   request       = getAccessRequestDimensions(bytesPerElem, dims, hint, accessAxis);
+            auto   amplification = getChunkAmplification(dims, chunkDims.value(), request);
+            double requestBytes  = static_cast<double>(getSizeFromDimensions(request) * bytesPerElem);
+            double chunkBytes    = static_cast<double>(getSizeFromDimensions(chunkDims.value()) * bytesPerElem);
+            double transferBytes = requestBytes * amplification;
+            msg.append(h5pp::format("{}: request dims {} | chunks touched {} | bytes requested {} | bytes transferred {} | amplification {}\n",
+                                    enum2str(hint),
+                                    request,
+                                    transferBytes / chunkBytes,
+                                    static_cast<size_t>(requestBytes),
+                                    static_cast<size_t>(std::round(transferBytes)),
+                                    amplification));
+        }
+        return msg;
+    }
+
     template<typename DataType>
     inline void setStringSize(const DataType &data, hsize_t &size, size_t &bytes, std::vector<hsize_t> &dims) {
         // Case 1: data is actual text, such as char* or std::string
@@ -0,0 +1,61 @@
+#include <h5pp/h5pp.h>
+
+int main() {
+    std::string outputFilename = "output/chunkAccessHint.h5";
+    size_t      logLevel       = 2;
+    h5pp::File  file(outputFilename, h5pp::FileAccess::REPLACE, logLevel);
+
+    std::vector<hsize_t> dims = {500, 400};
+    std::vector<double>  matrix(h5pp::util::getSizeFromDimensions(dims), 1.0);
+
+    // Planner: chunks should span the full extent of the axes that are not scanned
+    auto rowChunk = h5pp::util::getChunkDimensions(sizeof(double), dims, std::nullopt, H5D_CHUNKED, h5pp::AccessHint::ROW_SCAN);
+    auto colChunk = h5pp::util::getChunkDimensions(sizeof(double), dims, std::nullopt, H5D_CHUNKED, h5pp::AccessHint::COLUMN_SCAN);
+    auto sqrChunk = h5pp::util::getChunkDimensions(sizeof(double), dims, std::nullopt, H5D_CHUNKED);
+    if(rowChunk->at(1) != dims[1]) throw h5pp::runtime_error("ROW_SCAN chunk {} does not span all columns {}", rowChunk.value(), dims);
+    if(colChunk->at(0) != dims[0]) throw h5pp::runtime_error("COLUMN_SCAN chunk {} does not span all rows {}", colChunk.value(), dims);
+
+    // Reading a single row should transfer fewer bytes with the ROW_SCAN plan than with a square plan
+    auto rowRequest = h5pp::util::getAccessRequestDimensions(sizeof(double), dims, h5pp::AccessHint::ROW_SCAN);
+    auto rowAmp     = h5pp::util::getChunkAmplification(dims, rowChunk.value(), rowRequest);
+    auto sqrAmp     = h5pp::util::getChunkAmplification(dims, sqrChunk.value(), rowRequest);
+    if(rowAmp > sqrAmp) throw h5pp::runtime_error("ROW_SCAN amplification {} exceeds square amplification {}", rowAmp, sqrAmp);
+    if(sqrAmp <= 1.0) throw h5pp::runtime_error("Square chunk {} should amplify row reads: {}", sqrChunk.value(), sqrAmp);
+
+    // Out-of-range access axis
+    bool caught = false;
+    try {
+        [[maybe_unused]] auto bad = h5pp::util::getChunkDimensions(sizeof(double), dims, std::nullopt, H5D_CHUNKED, h5pp::AccessHint::APPEND, 2);
+    } catch(std::exception &ex) {
+        h5pp::print("THE ERROR BELOW IS PART OF THE TEST AND WAS EXPECTED: \n -- {}\n", ex.what());
+        caught = true;
+    }
+    if(not caught) throw h5pp::runtime_error("Expected an error for access axis 2 on a rank 2 dataset");
+
+    // Write through the Options interface
+    h5pp::Options options;
+    options.linkPath   = "rowScan";
+    options.dataDims   = dims;
+    options.h5Layout   = H5D_CHUNKED;
+    options.accessHint = h5pp::AccessHint::ROW_SCAN;
+    file.writeDataset(matrix, options);
+    if(file.getDatasetChunkDimensions("rowScan") != rowChunk)
+        throw h5pp::runtime_error("Dataset chunk {} differs from the planned chunk {}", file.getDatasetChunkDimensions("rowScan").value(), rowChunk.value());
+
+    // APPEND implies an extendable, chunked dataset
+    std::vector<double> series(100, 2.0);
+    options            = h5pp::Options();
+    options.linkPath   = "series";
+    options.accessHint = h5pp::AccessHint::APPEND;
+    file.writeDataset(series, options);
+    auto seriesInfo = file.getDatasetInfo("series");
+    if(seriesInfo.h5Layout != H5D_CHUNKED) throw h5pp::runtime_error("APPEND hint did not produce a chunked dataset");
+    file.appendToDataset(series, "series", 0);
+    if(file.getDatasetDimensions("series").at(0) != 200) throw h5pp::runtime_error("Failed to append to dataset [series]");
+
+    auto explanation = file.explainChunking("rowScan");
+    if(explanation.empty()) throw h5pp::runtime_error("explainChunking returned an empty report");
+    h5pp::print("{}", explanation);
+    h5pp::print("{}", file.explainChunking("series", h5pp::AccessHint::APPEND));
+    return 0;
+}
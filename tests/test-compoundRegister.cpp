@@ -0,0 +1,88 @@
+#include <h5pp/h5pp.h>
+
+struct Vec3 {
+    double x = 0, y = 0, z = 0;
+    bool   operator==(const Vec3 &v) const { return x == v.x and y == v.y and z == v.z; }
+};
+H5PP_REGISTER_COMPOUND(Vec3, x, y, z)
+
+struct Particle {
+    Vec3                  pos;
+    std::array<double, 3> vel      = {0, 0, 0};
+    int                   id       = 0;
+    char                  name[10] = "some name";
+    h5pp::fstr_t<16>      tag      = "some tag";
+    float                 spin[2][2] = {{0, 0}, {0, 0}};
+    std::complex<double>  phase    = {1, 0};
+    bool                  operator==(const Particle &p) const {
+        return pos == p.pos and vel == p.vel and id == p.id and std::strncmp(name, p.name, 10) == 0 and tag == p.tag and
+               std::memcmp(spin, p.spin, sizeof(spin)) == 0 and phase == p.phase;
+    }
+    bool operator!=(const Particle &p) const { return not(*this == p); }
+};
+H5PP_REGISTER_COMPOUND(Particle, pos, vel, id, name, tag, spin, phase)
+
+// A subset of the members of Particle, in a different order and with padding in between
+struct Summary {
+    char   name[10] = "";
+    double unused   = -1;
+    int    id       = -1;
+};
+H5PP_REGISTER_COMPOUND(Summary, id, name)
+
+int main() {
+    h5pp::File file("output/compoundRegister.h5", h5pp::FileAccess::REPLACE, 2);
+
+    // The type is built once and shared
+    auto type = h5pp::type::getH5Type<Particle>();
+    if(type.value() != h5pp::type::getH5Type<Particle>().value()) throw h5pp::runtime_error("Registered type was built twice");
+    if(H5Tget_class(type) != H5T_COMPOUND) throw h5pp::runtime_error("Registered type is not a compound type");
+    if(H5Tget_size(type) != sizeof(Particle)) throw h5pp::runtime_error("Registered type has the wrong size");
+    if(H5Tget_nmembers(type) != 7) throw h5pp::runtime_error("Registered type has {} members, expected 7", H5Tget_nmembers(type));
+    if(H5Tget_member_offset(type, 3) != offsetof(Particle, name)) throw h5pp::runtime_error("Member [name] has the wrong offset");
+    if(H5Tget_member_class(type, 0) != H5T_COMPOUND) throw h5pp::runtime_error("Nested struct [pos] is not a compound type");
+    if(H5Tget_member_class(type, 1) != H5T_ARRAY) throw h5pp::runtime_error("Member [vel] is not an array type");
+    if(H5Tget_member_class(type, 3) != H5T_STRING) throw h5pp::runtime_error("Member [name] is not a string type");
+    if(H5Tget_member_class(type, 4) != H5T_STRING) throw h5pp::runtime_error("Member [tag] is not a string type");
+    h5pp::hid::h5t spinType = H5Tget_member_type(type, 5);
+    if(H5Tget_array_ndims(spinType) != 2) throw h5pp::runtime_error("Member [spin] should be a rank 2 array");
+
+    std::vector<Particle> particles(10);
+    for(size_t i = 0; i < particles.size(); ++i) {
+        auto d          = static_cast<double>(i);
+        particles[i].pos = {d, d + 1, d + 2};
+        particles[i].vel = {-d, -d - 1, -d - 2};
+        particles[i].id  = static_cast<int>(i);
+        std::snprintf(particles[i].name, sizeof(particles[i].name), "p%zu", i);
+        particles[i].tag        = h5pp::format("tag{}", i).c_str();
+        particles[i].spin[1][0] = static_cast<float>(i);
+        particles[i].phase      = {d, -d};
+    }
+
+    // Datasets: no type needs to be given
+    file.writeDataset(particles[3], "singleParticle");
+    if(file.readDataset<Particle>("singleParticle") != particles[3]) throw h5pp::runtime_error("Single particle mismatch");
+    file.writeDataset(particles, "particles");
+    if(file.readDataset<std::vector<Particle>>("particles") != particles) throw h5pp::runtime_error("Particles mismatch");
+    auto info = file.getDatasetInfo("particles");
+    if(H5Tget_class(info.h5Type.value()) != H5T_COMPOUND) throw h5pp::runtime_error("Dataset was not written with a compound type");
+
+    // Tables
+    file.createTable<Particle>("particleTable", "Particles");
+    file.appendTableRecords(particles, "particleTable");
+    if(file.readTableRecords<std::vector<Particle>>("particleTable") != particles) throw h5pp::runtime_error("Table records mismatch");
+
+    // Read a subset of the fields into a struct with a different layout
+    auto summaries = file.readTableField<std::vector<Summary>>("particleTable", {"id", "name"}, h5pp::TableSelection::ALL);
+    if(summaries.size() != particles.size()) throw h5pp::runtime_error("Wrong number of summaries");
+    for(size_t i = 0; i < summaries.size(); ++i) {
+        if(summaries[i].id != particles[i].id) throw h5pp::runtime_error("Summary {} has id {}", i, summaries[i].id);
+        if(std::strncmp(summaries[i].name, particles[i].name, 10) != 0) throw h5pp::runtime_error("Summary {} has name {}", i, summaries[i].name);
+        if(summaries[i].unused != -1) throw h5pp::runtime_error("Summary {} had a member overwritten that was not read", i);
+    }
+    auto positions = file.readTableField<std::vector<Vec3>>("particleTable", {"pos"}, h5pp::TableSelection::ALL);
+    for(size_t i = 0; i < positions.size(); ++i)
+        if(not(positions[i] == particles[i].pos)) throw h5pp::runtime_error("Position {} mismatch", i);
+
+    return 0;
+}
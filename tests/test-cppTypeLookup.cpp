@@ -0,0 +1,51 @@
+#include <h5pp/h5pp.h>
+
+template<typename T>
+void expectCppType(h5pp::File &file, std::string_view dsetPath) {
+    file.writeDataset(std::vector<T>(10), dsetPath);
+    auto info = file.getDatasetInfo(dsetPath);
+    if(info.cppTypeIndex.value() != typeid(T))
+        throw h5pp::runtime_error("Dataset [{}] maps to C++ type [{}], expected [{}]",
+                                  dsetPath,
+                                  info.cppTypeName.value(),
+                                  h5pp::type::sfinae::type_name<T>());
+    h5pp::print("[{}]: {}\n", dsetPath, info.cppTypeName.value());
+}
+
+int main() {
+    std::string outputFilename = "output/cppTypeLookup.h5";
+    size_t      logLevel       = 2;
+    h5pp::File  file(outputFilename, h5pp::FileAccess::REPLACE, logLevel);
+
+    expectCppType<short>(file, "short");
+    expectCppType<int>(file, "int");
+    expectCppType<unsigned int>(file, "uint");
+    expectCppType<float>(file, "float");
+    expectCppType<double>(file, "double");
+    expectCppType<long double>(file, "ldouble");
+    expectCppType<std::complex<float>>(file, "cplx_float");
+    expectCppType<std::complex<double>>(file, "cplx_double");
+    expectCppType<std::complex<int>>(file, "cplx_int");
+    expectCppType<h5pp::type::compound::Scalar2<double>>(file, "scalar2_double");
+    expectCppType<h5pp::type::compound::Scalar3<unsigned int>>(file, "scalar3_uint");
+    // long and long long usually have identical HDF5 types. The first one listed in the lookup table wins
+    file.writeDataset(std::vector<long long>(10), "llong");
+    auto llong = file.getDatasetInfo("llong").cppTypeIndex.value();
+    if(llong != typeid(long) and llong != typeid(long long)) throw h5pp::runtime_error("Dataset [llong] did not map to long or long long");
+
+    // A compound type that merely looks like a complex number is not mistaken for one
+    struct NotComplex {
+        double re;
+        double im;
+    };
+    h5pp::hid::h5t notComplexType = H5Tcreate(H5T_COMPOUND, sizeof(NotComplex));
+    H5Tinsert(notComplexType, "re", HOFFSET(NotComplex, re), H5T_NATIVE_DOUBLE);
+    H5Tinsert(notComplexType, "im", HOFFSET(NotComplex, im), H5T_NATIVE_DOUBLE);
+    if(std::get<0>(h5pp::type::getCppType(notComplexType)) == typeid(std::complex<double>))
+        throw h5pp::runtime_error("Compound type with fields [re,im] was mistaken for std::complex<double>");
+
+    // Types outside the lookup table
+    if(std::get<0>(h5pp::type::getCppType(h5pp::type::getH5Type<std::string>())) != typeid(std::string))
+        throw h5pp::runtime_error("String type did not map to std::string");
+    return 0;
+}
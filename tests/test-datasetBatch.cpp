@@ -0,0 +1,65 @@
+#include <h5pp/h5pp.h>
+
+int main() {
+    h5pp::File file("output/datasetBatch.h5", h5pp::FileAccess::REPLACE, 2);
+
+    // Heterogeneous data: the numeric items go into one multi-dataset transfer, the text item is written on its own
+    std::vector<double>  energies = {1.0, 2.0, 3.0};
+    std::vector<int64_t> indices(1000);
+    std::iota(indices.begin(), indices.end(), 0);
+    std::complex<double> phase = {0.5, -0.5};
+    int                  step  = 42;
+    std::string          label = "checkpoint";
+
+    // Energies grow between checkpoints, so they need a chunked dataset
+    h5pp::Options energyOptions;
+    energyOptions.linkPath = "batch/energies";
+    energyOptions.h5Layout = H5D_CHUNKED;
+
+    h5pp::WriteBatch batch;
+    batch.add(energies, energyOptions).add(indices, "batch/indices").add(phase, "batch/phase").add(step, "batch/step");
+    batch.add(label, "batch/label");
+    auto report = file.writeDatasets(batch);
+    if(report.numDatasets != 5 or report.numScanned != 5) throw h5pp::runtime_error("Unexpected report: {}", report.string());
+    if(report.numMulti != 4 or report.numSerial != 1) throw h5pp::runtime_error("Unexpected transfer split: {}", report.string());
+
+    if(file.readDataset<std::vector<double>>("batch/energies") != energies) throw h5pp::runtime_error("energies mismatch");
+    if(file.readDataset<std::vector<int64_t>>("batch/indices") != indices) throw h5pp::runtime_error("indices mismatch");
+    if(file.readDataset<std::complex<double>>("batch/phase") != phase) throw h5pp::runtime_error("phase mismatch");
+    if(file.readDataset<int>("batch/step") != step) throw h5pp::runtime_error("step mismatch");
+    if(file.readDataset<std::string>("batch/label") != label) throw h5pp::runtime_error("label mismatch");
+
+    // Writing the batch again reuses the scanned metadata, unless the data changed shape
+    step = 43;
+    energies.push_back(4.0);
+    report = file.writeDatasets(batch);
+    if(report.numScanned != 1) throw h5pp::runtime_error("Expected a single rescan: {}", report.string());
+    if(file.readDataset<int>("batch/step") != 43) throw h5pp::runtime_error("step was not rewritten");
+    if(file.readDataset<std::vector<double>>("batch/energies") != energies) throw h5pp::runtime_error("energies were not resized");
+
+    // Read it all back in one batch, including a conversion that goes through h5pp
+    std::vector<double>  energiesRead;
+    std::vector<int64_t> indicesRead;
+    std::vector<float>   indicesFloat;
+    std::complex<double> phaseRead;
+    int                  stepRead = 0;
+    std::string          labelRead;
+    h5pp::ReadBatch      readBatch;
+    readBatch.add(energiesRead, "batch/energies").add(indicesRead, "batch/indices").add(indicesFloat, "batch/indices");
+    readBatch.add(phaseRead, "batch/phase").add(stepRead, "batch/step").add(labelRead, "batch/label");
+    auto readReport = file.readDatasets(readBatch);
+    if(readReport.numMulti != 4 or readReport.numSerial != 2) throw h5pp::runtime_error("Unexpected read split: {}", readReport.string());
+    if(energiesRead != energies or indicesRead != indices or phaseRead != phase or stepRead != step or labelRead != label)
+        throw h5pp::runtime_error("Batch read mismatch");
+    for(size_t i = 0; i < indices.size(); ++i)
+        if(indicesFloat[i] != static_cast<float>(indices[i])) throw h5pp::runtime_error("Converted read mismatch at {}", i);
+
+    // Reading a dataset that does not exist fails
+    int  missing = 0;
+    bool threw   = false;
+    try {
+        file.readDatasets(h5pp::ReadBatch().add(missing, "batch/missing"));
+    } catch(const std::exception &) { threw = true; }
+    if(not threw) throw h5pp::runtime_error("Reading a missing dataset did not fail");
+    return 0;
+}
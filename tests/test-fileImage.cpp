@@ -0,0 +1,65 @@
+#include <fstream>
+#include <h5pp/h5pp.h>
+
+int main() {
+    std::vector<double> data = {1.0, 2.0, 3.0, 4.0};
+
+    // A new file that only exists in memory
+    std::vector<std::byte> image;
+    {
+        auto file = h5pp::File::inMemory(2);
+        file.writeDataset(data, "data");
+        file.writeAttribute("in memory", "data", "origin");
+        file.setKeepFileClosed(); // The file would be lost, so the handle is kept
+        image = file.toImage();
+        if(h5pp::fs::exists(file.getFilePath())) throw h5pp::runtime_error("A file in memory was created on disk: {}", file.getFilePath());
+    }
+    if(image.empty()) throw h5pp::runtime_error("Empty file image");
+
+    // Read an image without copying it
+    {
+        auto file = h5pp::File::fromImage(image.data(), image.size());
+        if(file.getFileAccess() != h5pp::FileAccess::READONLY) throw h5pp::runtime_error("Image was not opened read-only");
+        if(file.readDataset<std::vector<double>>("data") != data) throw h5pp::runtime_error("Wrong dataset from image");
+        if(file.readAttribute<std::string>("data", "origin") != "in memory") throw h5pp::runtime_error("Wrong attribute from image");
+        try {
+            file.writeDataset(data, "more");
+            throw std::logic_error("Wrote to a read-only image");
+        } catch(const std::logic_error &) { throw; } catch(const std::exception &) {}
+    }
+
+    // Modify a copy of an image, and produce a new image
+    std::vector<std::byte> modified;
+    {
+        auto file = h5pp::File::fromImage(image, h5pp::FileAccess::READWRITE);
+        file.writeDataset(std::vector<int>{5, 6}, "more");
+        modified = file.toImage();
+    }
+    {
+        auto file = h5pp::File::fromImage(modified);
+        if(file.readDataset<std::vector<int>>("more") != std::vector<int>{5, 6}) throw h5pp::runtime_error("Wrong dataset from modified image");
+        if(file.readDataset<std::vector<double>>("data") != data) throw h5pp::runtime_error("Wrong dataset from modified image");
+        if(h5pp::File::fromImage(image).linkExists("more")) throw h5pp::runtime_error("The original image was modified");
+    }
+
+    // The image of a file on disk has the bytes of the file
+    {
+        h5pp::File file("output/fileImage.h5", h5pp::FileAccess::REPLACE, 2);
+        file.writeDataset(data, "data");
+        auto diskImage = file.toImage();
+        file.setKeepFileClosed();
+        std::ifstream     stream(file.getFilePath(), std::ios::binary);
+        std::vector<char> bytes((std::istreambuf_iterator<char>(stream)), std::istreambuf_iterator<char>());
+        auto              fromDisk = h5pp::File::fromImage(bytes);
+        if(fromDisk.readDataset<std::vector<double>>("data") != data) throw h5pp::runtime_error("Wrong dataset from the bytes of a file");
+        if(diskImage.size() != bytes.size()) throw h5pp::runtime_error("Image of {} bytes of a file of {} bytes", diskImage.size(), bytes.size());
+    }
+
+    // Bytes that are not an HDF5 file
+    try {
+        std::vector<std::byte> garbage(1024, std::byte{42});
+        auto                   file = h5pp::File::fromImage(garbage);
+        throw std::logic_error("Opened an image of garbage");
+    } catch(const std::logic_error &) { throw; } catch(const std::exception &) {}
+    return 0;
+}
@@ -0,0 +1,65 @@
+#include <h5pp/h5pp.h>
+
+template<typename Strings>
+std::vector<std::string> toStrings(const Strings &strings) {
+    std::vector<std::string> result;
+    for(const auto &str : strings) result.emplace_back(std::string_view(str));
+    return result;
+}
+
+int main() {
+    h5pp::File file("output/fixedStrings.h5", h5pp::FileAccess::REPLACE, 2);
+
+    std::vector<std::string>      words = {"this", "is", "a fixed", "length", "string", "array", "", "with a long last entry"};
+    std::vector<h5pp::fstr_t<16>> fixed(words.begin(), words.end());
+    auto                          fixed16 = toStrings(fixed); // The last word is truncated to 15 characters
+
+    // A container of fstr_t<N> is written as it is, with a fixed-length type of size N
+    file.writeDataset(fixed, "fixed");
+    auto info = file.getDatasetInfo("fixed");
+    if(H5Tis_variable_str(info.h5Type.value()) > 0 or H5Tget_size(info.h5Type.value()) != 16)
+        throw h5pp::runtime_error("Wrong type of dataset with fstr_t<16>: {}", info.string());
+
+    // ... and read back as it is, or into strings of other types and sizes
+    if(file.readDataset<std::vector<h5pp::fstr_t<16>>>("fixed") != fixed) throw h5pp::runtime_error("Wrong fstr_t<16> from fstr_t<16>");
+    if(file.readDataset<std::vector<std::string>>("fixed") != fixed16) throw h5pp::runtime_error("Wrong strings from fstr_t<16>");
+    auto read32 = toStrings(file.readDataset<std::vector<h5pp::fstr_t<32>>>("fixed"));
+    if(read32 != fixed16) throw h5pp::runtime_error("Wrong fstr_t<32> from fstr_t<16>: {}", read32);
+    auto read5 = toStrings(file.readDataset<std::vector<h5pp::fstr_t<5>>>("fixed"));
+    if(read5 != std::vector<std::string>{"this", "is", "a fi", "leng", "stri", "arra", "", "with"})
+        throw h5pp::runtime_error("Wrong fstr_t<5> from fstr_t<16>: {}", read5);
+
+    // Strings written with a fixed-length type of another size, or a variable-length type
+    h5pp::hid::h5t type10 = H5Tcopy(H5T_C_S1);
+    H5Tset_size(type10, 10);
+    H5Tset_strpad(type10, H5T_STR_NULLTERM);
+    file.writeDataset(words, "words10", type10);
+    auto words10 = toStrings(file.readDataset<std::vector<h5pp::fstr_t<16>>>("words10"));
+    if(words10 != std::vector<std::string>{"this", "is", "a fixed", "length", "string", "array", "", "with a lo"})
+        throw h5pp::runtime_error("Wrong fstr_t<16> from size 10: {}", words10);
+    file.writeDataset(words, "variable");
+    if(toStrings(file.readDataset<std::vector<h5pp::fstr_t<16>>>("variable")) != fixed16)
+        throw h5pp::runtime_error("Wrong fstr_t<16> from variable-length strings");
+    file.writeDataset(fixed, "fixed10", type10);
+    if(file.readDataset<std::vector<std::string>>("fixed10") != words10) throw h5pp::runtime_error("Wrong fstr_t<16> written to size 10");
+
+    // A hyperslab of the dataset, read into a preallocated buffer
+    std::vector<h5pp::fstr_t<16>> slab(3);
+    file.readHyperslab(slab, info, h5pp::Hyperslab({2}, {3}));
+    if(toStrings(slab) != std::vector<std::string>{"a fixed", "length", "string"})
+        throw h5pp::runtime_error("Wrong fstr_t<16> hyperslab: {}", toStrings(slab));
+
+    // Attributes
+    file.writeAttribute(fixed, "fixed", "fixedAttr");
+    if(file.readAttribute<std::vector<h5pp::fstr_t<16>>>("fixed", "fixedAttr") != fixed)
+        throw h5pp::runtime_error("Wrong fstr_t<16> attribute");
+    if(file.readAttribute<std::vector<std::string>>("fixed", "fixedAttr") != fixed16)
+        throw h5pp::runtime_error("Wrong strings from fstr_t<16> attribute: {}", file.readAttribute<std::vector<std::string>>("fixed", "fixedAttr"));
+    file.writeAttribute(words, "fixed", "wordsAttr10", std::nullopt, type10);
+    if(file.readAttribute<std::vector<std::string>>("fixed", "wordsAttr10") != words10)
+        throw h5pp::runtime_error("Wrong strings from attribute of size 10: {}", file.readAttribute<std::vector<std::string>>("fixed", "wordsAttr10"));
+    file.writeAttribute(words, "fixed", "wordsAttr");
+    if(toStrings(file.readAttribute<std::vector<h5pp::fstr_t<16>>>("fixed", "wordsAttr")) != fixed16)
+        throw h5pp::runtime_error("Wrong fstr_t<16> from variable-length attribute");
+    return 0;
+}
@@ -0,0 +1,73 @@
+#include <h5pp/h5pp.h>
+
+// The value stored at index (i, j, k) of the dataset
+double value(size_t i, size_t j, size_t k) { return static_cast<double>(i * 10000 + j * 100 + k); }
+
+int main() {
+    h5pp::File file("output/hyperslabMap.h5", h5pp::FileAccess::REPLACE, 2);
+
+    const size_t        d0 = 6, d1 = 7, d2 = 8;
+    std::vector<double> values;
+    for(size_t i = 0; i < d0; ++i)
+        for(size_t j = 0; j < d1; ++j)
+            for(size_t k = 0; k < d2; ++k) values.push_back(value(i, j, k));
+    file.writeDataset(values, "values", {d0, d1, d2});
+    auto info = file.getDatasetInfo("values");
+
+    // Repeated slice reads into a preallocated buffer, reusing the dataset info
+    const size_t          e0 = 2, e1 = 3, e2 = 4;
+    std::array<double, 24> buffer{};
+    for(size_t o0 = 0; o0 + e0 <= d0; o0 += 2) {
+        for(size_t o2 = 0; o2 + e2 <= d2; o2 += 4) {
+            file.readHyperslab(buffer, info, h5pp::Hyperslab({o0, 1, o2}, {e0, e1, e2}));
+            for(size_t i = 0; i < e0; ++i)
+                for(size_t j = 0; j < e1; ++j)
+                    for(size_t k = 0; k < e2; ++k)
+                        if(buffer[(i * e1 + j) * e2 + k] != value(o0 + i, 1 + j, o2 + k))
+                            throw h5pp::runtime_error("Row-major slice mismatch at offset [{},1,{}]", o0, o2);
+        }
+    }
+
+    // The buffer must fit the slab exactly, since it is never resized
+    bool threw = false;
+    try {
+        file.readHyperslab(buffer, info, h5pp::Hyperslab({0, 0, 0}, {2, 2, 2}));
+    } catch(const std::exception &) { threw = true; }
+    if(not threw) throw h5pp::runtime_error("Reading into a buffer of the wrong size did not fail");
+
+#ifdef H5PP_USE_EIGEN3
+    // Column-major views of a preallocated buffer are read in place
+    std::vector<double>                             storage(e0 * e1 * e2);
+    Eigen::TensorMap<Eigen::Tensor<double, 3>>      colMap(storage.data(), e0, e1, e2);
+    Eigen::TensorMap<Eigen::Tensor<double, 3, Eigen::RowMajor>> rowMap(storage.data(), e0, e1, e2);
+    const auto                                     *before = storage.data();
+    for(size_t o1 = 0; o1 + e1 <= d1; ++o1) {
+        h5pp::Hyperslab slab({3, o1, 2}, {e0, e1, e2});
+        file.readHyperslab(colMap, info, slab);
+        for(size_t i = 0; i < e0; ++i)
+            for(size_t j = 0; j < e1; ++j)
+                for(size_t k = 0; k < e2; ++k)
+                    if(colMap(long(i), long(j), long(k)) != value(3 + i, o1 + j, 2 + k))
+                        throw h5pp::runtime_error("Column-major tensor slice mismatch at offset [3,{},2]", o1);
+        file.readHyperslab(rowMap, info, slab);
+        for(size_t i = 0; i < e0; ++i)
+            for(size_t j = 0; j < e1; ++j)
+                for(size_t k = 0; k < e2; ++k)
+                    if(rowMap(long(i), long(j), long(k)) != value(3 + i, o1 + j, 2 + k))
+                        throw h5pp::runtime_error("Row-major tensor slice mismatch at offset [3,{},2]", o1);
+    }
+    if(storage.data() != before) throw h5pp::runtime_error("The buffer was reallocated");
+
+    // The path-based readHyperslab reads column-major maps in place too, and converts the element type
+    std::vector<float>                     matStorage(4 * 5);
+    Eigen::Map<Eigen::MatrixXf>            matrix(matStorage.data(), 4, 5);
+    std::vector<double>                    flat(10 * 12);
+    for(size_t i = 0; i < flat.size(); ++i) flat[i] = static_cast<double>(i);
+    file.writeDataset(flat, "matrix", {10, 12});
+    file.readHyperslab(matrix, "matrix", h5pp::Hyperslab({5, 6}, {4, 5}));
+    for(long r = 0; r < 4; ++r)
+        for(long c = 0; c < 5; ++c)
+            if(matrix(r, c) != static_cast<float>((5 + r) * 12 + 6 + c)) throw h5pp::runtime_error("Matrix map mismatch at ({},{})", r, c);
+#endif
+    return 0;
+}
@@ -0,0 +1,55 @@
+#include <h5pp/h5pp.h>
+
+void expectLayout(const h5pp::DsetInfo &info, H5D_layout_t expected) {
+    if(info.h5Layout != expected)
+        throw h5pp::runtime_error("Unexpected layout for dataset [{}]: {}", info.dsetPath.value(), info.layoutReason.value_or("no reason given"));
+    if(not info.layoutReason or info.layoutReason->empty())
+        throw h5pp::runtime_error("No layout reason given for dataset [{}]", info.dsetPath.value());
+    h5pp::print("[{}]: {}\n", info.dsetPath.value(), info.layoutReason.value());
+}
+
+int main() {
+    std::string outputFilename = "output/layoutPolicy.h5";
+    size_t      logLevel       = 2;
+    h5pp::File  file(outputFilename, h5pp::FileAccess::REPLACE, logLevel);
+
+    std::vector<double> small(100, 1.0);    // 800 bytes
+    std::vector<double> medium(10000, 2.0); // 80 kB
+
+    // Default policy
+    expectLayout(file.writeDataset(small, "default/small"), H5D_COMPACT);
+    expectLayout(file.writeDataset(medium, "default/medium"), H5D_CONTIGUOUS);
+    expectLayout(file.writeDataset(medium, "default/mediumGiven", std::nullopt, H5D_CHUNKED), H5D_CHUNKED);
+
+    // Extendable datasets are always chunked
+    h5pp::Options options;
+    options.linkPath    = "default/extendable";
+    options.dsetMaxDims = {H5S_UNLIMITED};
+    expectLayout(file.writeDataset(small, options), H5D_CHUNKED);
+
+    // Compression requires chunks
+    if(h5pp::hdf5::isCompressionAvaliable()) {
+        file.setCompressionLevel(3);
+        expectLayout(file.writeDataset(medium, "compressed/medium"), H5D_CHUNKED);
+        expectLayout(file.writeDataset(small, "compressed/small"), H5D_COMPACT);
+        file.setCompressionLevel(0);
+    }
+
+    // File-wide policy with custom thresholds
+    auto policy              = file.getLayoutPolicy();
+    policy.maxSizeContiguous = 64 * 1024;
+    policy.compactIfSmall    = false;
+    file.setLayoutPolicy(policy);
+    expectLayout(file.writeDataset(small, "policy/small"), H5D_CONTIGUOUS);
+    expectLayout(file.writeDataset(medium, "policy/medium"), H5D_CHUNKED);
+
+    // Per-call override of the file policy
+    options              = h5pp::Options();
+    options.linkPath     = "override/medium";
+    options.layoutPolicy = h5pp::LayoutPolicy();
+    expectLayout(file.writeDataset(medium, options), H5D_CONTIGUOUS);
+
+    if(file.getDatasetInfo("policy/medium").h5Layout != H5D_CHUNKED)
+        throw h5pp::runtime_error("Layout on file differs from the layout chosen by the policy");
+    return 0;
+}
@@ -0,0 +1,84 @@
+#include <h5pp/h5pp.h>
+
+int main() {
+    std::string filePath = "output/linkIndex.h5";
+    {
+        h5pp::File file(filePath, h5pp::FileAccess::REPLACE, 2);
+        for(size_t r = 0; r < 4; ++r)
+            for(size_t s = 0; s < 12; ++s) {
+                file.writeDataset(std::vector<double>(s + 1, 1.0), h5pp::format("run_{}/step_{}/energy", r, s));
+                file.writeDataset(static_cast<int>(s), h5pp::format("run_{}/step_{}/count", r, s));
+            }
+        file.writeAttribute("eV", "run_0/step_3/energy", "unit");
+        file.writeAttribute(0.5, "run_0/step_3/energy", "scale");
+        file.writeDataset(1.0, "run-all");
+        file.createSoftLink("run_0/step_0/energy", "latest");
+    }
+    auto sidecar = h5pp::LinkIndex::sidecarPath(filePath);
+    h5pp::fs::remove(sidecar);
+
+    h5pp::File file(filePath, h5pp::FileAccess::READONLY, 2);
+    auto       live = file.findLinks("", "/", -1, -1, true);
+    const auto &index = file.getLinkIndex();
+    if(not h5pp::fs::exists(sidecar)) throw h5pp::runtime_error("The link index was not saved");
+    if(index.getEntries().size() != live.size()) throw h5pp::runtime_error("Indexed {} links, expected {}", index.getEntries().size(), live.size());
+
+    // Searches answered from the index match the searches through HDF5, in the same order
+    auto check = [&](std::string_view key, std::string_view root, long maxHits, long maxDepth, bool symlinks, H5O_type_t type) {
+        auto fromIndex = index.findLinks(key, root, maxHits, maxDepth, symlinks, type);
+        std::vector<std::string> fromFile;
+        if(type == H5O_TYPE_DATASET) fromFile = h5pp::hdf5::findLinks<H5O_TYPE_DATASET>(file.openFileHandle(), key, root, maxHits, maxDepth, symlinks);
+        else if(type == H5O_TYPE_GROUP) fromFile = h5pp::hdf5::findLinks<H5O_TYPE_GROUP>(file.openFileHandle(), key, root, maxHits, maxDepth, symlinks);
+        else fromFile = h5pp::hdf5::findLinks<H5O_TYPE_UNKNOWN>(file.openFileHandle(), key, root, maxHits, maxDepth, symlinks);
+        if(fromIndex != fromFile)
+            throw h5pp::runtime_error("Index and file disagree on key [{}] root [{}]:\n{}\n{}", key, root, fromIndex, fromFile);
+    };
+    check("", "/", -1, -1, false, H5O_TYPE_UNKNOWN);
+    check("", "/", -1, -1, true, H5O_TYPE_DATASET);
+    check("energy", "/", -1, -1, false, H5O_TYPE_DATASET);
+    check("step_1", "run_2", -1, -1, false, H5O_TYPE_GROUP);
+    check("", "/run_1/", 5, 1, false, H5O_TYPE_UNKNOWN);
+    check("run", "/", -1, 0, false, H5O_TYPE_UNKNOWN);
+    if(file.findDatasets("energy") != index.findLinks("energy", "/", -1, -1, false, H5O_TYPE_DATASET))
+        throw h5pp::runtime_error("File::findDatasets does not match the index");
+
+    // Prefix and glob queries
+    h5pp::LinkQuery query;
+    query.match   = h5pp::LinkMatch::GLOB;
+    query.pattern = "/run_*/step_[0-3]/energy";
+    if(index.find(query).size() != 16) throw h5pp::runtime_error("Glob matched {} links, expected 16", index.find(query).size());
+    query.pattern = "run_1/**/count";
+    if(index.find(query).size() != 12) throw h5pp::runtime_error("Glob with ** matched {} links, expected 12", index.find(query).size());
+    query.match      = h5pp::LinkMatch::PREFIX;
+    query.pattern    = "step_1";
+    query.searchRoot = "run_3";
+    query.objType    = H5O_TYPE_GROUP;
+    if(index.find(query).size() != 3) throw h5pp::runtime_error("Prefix matched {} groups, expected 3", index.find(query).size()); // step_1, step_10, step_11
+
+    // Each entry describes its object
+    const auto *energy = index.get("/run_0/step_3/energy");
+    if(energy == nullptr) throw h5pp::runtime_error("Missing index entry");
+    if(energy->objType != H5O_TYPE_DATASET or energy->dims != std::vector<hsize_t>{4} or energy->typeName != "H5T_NATIVE_DOUBLE")
+        throw h5pp::runtime_error("Wrong index entry: dims {} type {}", energy->dims, energy->typeName);
+    if(energy->attributes != std::vector<std::string>{"scale", "unit"} and energy->attributes != std::vector<std::string>{"unit", "scale"})
+        throw h5pp::runtime_error("Wrong attributes: {}", energy->attributes);
+    const auto *latest = index.get("latest");
+    if(latest == nullptr or latest->linkType != H5L_TYPE_SOFT or latest->objType != H5O_TYPE_DATASET) throw h5pp::runtime_error("Wrong soft link entry");
+
+    // A current sidecar is loaded instead of rebuilt
+    auto savedTime = h5pp::fs::last_write_time(sidecar);
+    {
+        h5pp::File again(filePath, h5pp::FileAccess::READONLY, 2);
+        if(again.getLinkIndex().getEntries().size() != index.getEntries().size()) throw h5pp::runtime_error("Loaded index differs");
+        if(h5pp::fs::last_write_time(sidecar) != savedTime) throw h5pp::runtime_error("A current index was rebuilt");
+    }
+
+    // A modified file makes the index stale
+    {
+        h5pp::File writer(filePath, h5pp::FileAccess::READWRITE, 2);
+        writer.writeDataset(2.0, "run_0/extra");
+    }
+    if(file.findDatasets("extra").size() != 1) throw h5pp::runtime_error("A stale index was used");
+    if(file.getLinkIndex().get("run_0/extra") == nullptr) throw h5pp::runtime_error("The stale index was not rebuilt");
+    return 0;
+}
@@ -0,0 +1,77 @@
+#include <h5pp/h5pp.h>
+#include <set>
+
+int main() {
+    h5pp::File file("output/linkSearch.h5", h5pp::FileAccess::REPLACE, 2);
+    for(size_t r = 0; r < 6; ++r)
+        for(size_t s = 0; s < 5; ++s) {
+            file.writeDataset(static_cast<double>(s), h5pp::format("tree/run_{}/step_{}/energy", r, s));
+            file.writeDataset(static_cast<int>(s), h5pp::format("tree/run_{}/step_{}/count", r, s));
+        }
+    file.writeDataset(1.0, "top");
+    file.createSoftLink("tree/run_0/step_0/energy", "shortcut");
+    file.createGroup("links");
+    file.createHardLink("tree/run_1", "links/loop"); // A second hard link to a group
+    file.createHardLink("/", "links/root");          // A cycle back to the root
+
+    // The callback receives every match, in the same order as the vector-returning overload
+    std::vector<std::string> streamed;
+    auto num = file.findDatasets([&](std::string_view path) {
+        streamed.emplace_back(path);
+        return true;
+    });
+    if(num != streamed.size()) throw h5pp::runtime_error("findDatasets reported {} matches but streamed {}", num, streamed.size());
+    if(streamed != file.findDatasets()) throw h5pp::runtime_error("Streamed matches differ from findDatasets()");
+    // Every group is entered once, even though run_1 has two hard links and links/root loops back to the root
+    if(streamed.size() != 61) throw h5pp::runtime_error("Expected 61 datasets, found {}: {}", streamed.size(), streamed);
+
+    // Returning false stops the search
+    size_t calls = 0;
+    file.findLinks([&](std::string_view) { return ++calls < 3; });
+    if(calls != 3) throw h5pp::runtime_error("The search did not stop: {} calls", calls);
+
+    // The options mirror the arguments of findLinks
+    h5pp::LinkSearch search;
+    search.searchKey  = "energy";
+    search.searchRoot = "tree/run_3";
+    std::set<std::string> energies;
+    file.findDatasets([&](std::string_view path) { return energies.emplace(path).second; }, search);
+    if(energies.size() != 5 or energies.count("step_4/energy") != 1)
+        throw h5pp::runtime_error("Unexpected matches under run_3: {}", std::vector<std::string>(energies.begin(), energies.end()));
+    search.maxDepth = 0;
+    if(file.findDatasets([](std::string_view) { return true; }, search) != 0) throw h5pp::runtime_error("maxDepth 0 went too deep");
+
+    // Worker processes find the same links, in any order, and stop at maxHits.
+    // The subtree has no groups with several hard links, which the workers could reach more than once.
+    for(size_t numWorkers : std::vector<size_t>{2, 4, 16}) {
+        h5pp::LinkSearch parallel;
+        parallel.searchRoot = "tree";
+        parallel.numWorkers = numWorkers;
+        std::multiset<std::string> found;
+        file.findLinks([&](std::string_view path) { return found.emplace(path), true; }, parallel);
+        auto serial = file.findLinks("", "tree");
+        if(found != std::multiset<std::string>(serial.begin(), serial.end()))
+            throw h5pp::runtime_error("{} workers found {} links, serial search found {}", numWorkers, found.size(), serial.size());
+        parallel.maxHits = 7;
+        size_t hits      = 0;
+        file.findDatasets([&](std::string_view) { return ++hits, true; }, parallel);
+        if(hits != 7) throw h5pp::runtime_error("{} workers passed {} hits, expected 7", numWorkers, hits);
+    }
+
+    // Exceptions thrown by the callback propagate, also for matches streamed from the workers
+    h5pp::LinkSearch parallel;
+    parallel.searchRoot = "tree";
+    parallel.numWorkers = 3;
+    bool threw          = false;
+    try {
+        file.findGroups(
+            [](std::string_view path) {
+                if(path.find('/') != std::string_view::npos) throw std::runtime_error(std::string(path));
+                return true;
+            },
+            parallel);
+    } catch(const std::exception &) { threw = true; }
+    if(not threw) throw h5pp::runtime_error("The callback exception was lost");
+    if(file.findGroups().size() != 40) throw h5pp::runtime_error("The file is not usable after an interrupted search");
+    return 0;
+}
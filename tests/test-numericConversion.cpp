@@ -0,0 +1,68 @@
+#include <h5pp/h5pp.h>
+
+template<typename T, typename U>
+void assertEqual(const std::vector<T> &a, const std::vector<U> &b, std::string_view what) {
+    if(a.size() != b.size()) throw h5pp::runtime_error("{}: size mismatch {} != {}", what, a.size(), b.size());
+    for(size_t i = 0; i < a.size(); ++i)
+        if(a[i] != static_cast<T>(b[i])) throw h5pp::runtime_error("{}: mismatch at index {}", what, i);
+}
+
+int main() {
+    h5pp::File file("output/numericConversion.h5", h5pp::FileAccess::REPLACE, 2);
+
+    // Set a small conversion buffer to make h5pp convert in many blocks
+    auto &dsetXfer = h5pp::PropertyLists::writable(file.plists.dsetXfer);
+    if(H5Pset_buffer(dsetXfer, 1000, nullptr, nullptr) < 0) throw h5pp::runtime_error("Failed to set the conversion buffer");
+
+    // Float <-> double, both ways
+    std::vector<double> doubles(10000);
+    for(size_t i = 0; i < doubles.size(); ++i) doubles[i] = 0.1 * static_cast<double>(i);
+    file.writeDataset(doubles, "doubles");
+    auto floats = file.readDataset<std::vector<float>>("doubles");
+    assertEqual(floats, doubles, "double -> float");
+    file.writeDataset(floats, "doubles"); // The dataset stays double
+    if(H5Tget_size(file.getDatasetInfo("doubles").h5Type.value()) != sizeof(double)) throw h5pp::runtime_error("The dataset type changed");
+    assertEqual(file.readDataset<std::vector<double>>("doubles"), floats, "float -> double");
+
+    // Integers saturate at the limits of the narrower type, like HDF5
+    std::vector<int32_t> ints = {-1000000, -129, -128, -1, 0, 1, 127, 128, 255, 256, 1000000};
+    file.writeDataset(ints, "ints");
+    std::vector<int8_t>  expectInt8  = {-128, -128, -128, -1, 0, 1, 127, 127, 127, 127, 127};
+    std::vector<uint8_t> expectUint8 = {0, 0, 0, 0, 0, 1, 127, 128, 255, 255, 255};
+    assertEqual(file.readDataset<std::vector<int8_t>>("ints"), expectInt8, "int32 -> int8");
+    assertEqual(file.readDataset<std::vector<uint8_t>>("ints"), expectUint8, "int32 -> uint8");
+    assertEqual(file.readDataset<std::vector<int64_t>>("ints"), ints, "int32 -> int64");
+    std::vector<uint64_t> bigs = {0, 1, std::numeric_limits<uint64_t>::max()};
+    file.writeDataset(bigs, "bigs");
+    std::vector<int32_t> expectBigs = {0, 1, std::numeric_limits<int32_t>::max()};
+    assertEqual(file.readDataset<std::vector<int32_t>>("bigs"), expectBigs, "uint64 -> int32");
+    file.writeDataset(std::vector<int16_t>{-5, 5}, "smalls");
+    if(file.readDataset<std::vector<uint64_t>>("smalls") != std::vector<uint64_t>{0, 5})
+        throw h5pp::runtime_error("int16 -> uint64 did not saturate at zero");
+
+    // A chunked rank-2 dataset whose blocks are a multiple of the chunk rows
+    std::vector<double> matrix(97 * 13);
+    for(size_t i = 0; i < matrix.size(); ++i) matrix[i] = static_cast<double>(i) - 500.0;
+    file.writeDataset(matrix, "matrix", {97, 13}, H5D_CHUNKED, {10, 13});
+    assertEqual(file.readDataset<std::vector<float>>("matrix"), matrix, "chunked double -> float");
+
+    // Scalars
+    file.writeDataset(3.25, "scalar");
+    if(file.readDataset<float>("scalar") != 3.25f) throw h5pp::runtime_error("Scalar double -> float mismatch");
+    file.writeDataset(int16_t(-7), "scalarInt");
+    if(file.readDataset<int64_t>("scalarInt") != -7) throw h5pp::runtime_error("Scalar int16 -> int64 mismatch");
+
+    // Hyperslabs are converted by HDF5
+    std::vector<float> patch(4 * 5, -1.5f);
+    file.writeHyperslab(patch, "matrix", h5pp::Hyperslab({2, 3}, {4, 5}));
+    auto patched = file.readDataset<std::vector<double>>("matrix");
+    for(size_t r = 0; r < 97; ++r)
+        for(size_t c = 0; c < 13; ++c) {
+            bool inside = r >= 2 and r < 6 and c >= 3 and c < 8;
+            if(patched[r * 13 + c] != (inside ? -1.5 : matrix[r * 13 + c])) throw h5pp::runtime_error("Hyperslab mismatch at [{},{}]", r, c);
+        }
+
+    // Conversions between integers and floating point are also left to HDF5
+    assertEqual(file.readDataset<std::vector<double>>("ints"), ints, "int32 -> double");
+    return 0;
+}
@@ -0,0 +1,106 @@
+#include <h5pp/h5pp.h>
+
+int main() {
+    // Matching whole paths
+    h5pp::PathPattern glob("/run_[0-9]/step_1?/energy");
+    if(not glob.matches("run_3/step_12/energy")) throw h5pp::runtime_error("Glob did not match");
+    if(glob.matches("run_3/step_1/energy") or glob.matches("run_3/step_12/energy/x") or glob.matches("run_10/step_12/energy"))
+        throw h5pp::runtime_error("Glob matched too much");
+    h5pp::PathPattern regex("run_\\d+/step_(1|2)\\d*/energy", h5pp::LinkMatch::REGEX);
+    if(not regex.matches("run_10/step_21/energy") or regex.matches("run_1/step_3/energy")) throw h5pp::runtime_error("Regex matched wrong paths");
+    h5pp::PathPattern deep("run_1/**/energy");
+    if(not deep.matches("run_1/energy") or not deep.matches("run_1/a/b/c/energy") or deep.matches("run_2/a/energy"))
+        throw h5pp::runtime_error("** matched wrong paths");
+    if(h5pp::PathPattern("a/b*/c").literalPrefix() != "a/b" or h5pp::PathPattern("a/b").literalPrefix() != "a/b" or
+       h5pp::PathPattern("a/**").literalPrefix() != "a")
+        throw h5pp::runtime_error("Wrong literal prefix");
+    try {
+        h5pp::PathPattern bad("run_(", h5pp::LinkMatch::REGEX);
+        throw std::logic_error("An invalid regex was accepted");
+    } catch(const std::logic_error &) { throw; } catch(const std::exception &) {}
+
+    std::string filePath = "output/pathPattern.h5";
+    h5pp::File  file(filePath, h5pp::FileAccess::REPLACE, 2);
+    for(size_t r = 0; r < 4; ++r)
+        for(size_t s = 0; s < 16; ++s) {
+            file.writeDataset(static_cast<double>(s), h5pp::format("run_{}/step_{}/energy", r, s));
+            file.writeDataset(static_cast<int>(s), h5pp::format("run_{}/step_{}/count", r, s));
+        }
+    file.writeDataset(1.0, "run_0/step_0/deeper/energy");
+    file.createSoftLink("run_0/step_0/energy", "run_0/latest");
+
+    // Searches with a pattern agree with filtering every path
+    auto check = [&](const h5pp::PathPattern &pattern, std::string_view root, size_t expected) {
+        auto all = file.findDatasets("", root);
+        std::vector<std::string> filtered;
+        std::copy_if(all.begin(), all.end(), std::back_inserter(filtered), [&](const std::string &p) { return pattern.matches(p); });
+        auto found = file.findDatasets(pattern, root);
+        std::sort(found.begin(), found.end());
+        std::sort(filtered.begin(), filtered.end());
+        if(found != filtered) throw h5pp::runtime_error("Pattern [{}] under [{}] found:\n{}\nexpected:\n{}", pattern.string(), root, found, filtered);
+        if(found.size() != expected) throw h5pp::runtime_error("Pattern [{}] found {} datasets, expected {}", pattern.string(), found.size(), expected);
+    };
+    check(glob, "/", 24);
+    check(regex, "/", 32);
+    check(h5pp::PathPattern("run_2/step_3/count"), "/", 1);
+    check(h5pp::PathPattern("step_1/energy"), "run_2", 1);
+    check(h5pp::PathPattern("**/energy"), "/", 65);
+    check(h5pp::PathPattern("run_0/**"), "/", 33);
+    check(h5pp::PathPattern("*/*/*/energy"), "/", 1);
+    check(h5pp::PathPattern("run_9/step_0/energy"), "/", 0);
+
+    // Only the groups matching the pattern are reported, not the groups leading to them
+    size_t           visited = 0;
+    h5pp::LinkSearch search;
+    search.pattern = h5pp::PathPattern("run_1/step_*");
+    file.findGroups(
+        [&](std::string_view path) {
+            if(path.rfind("run_1/step_", 0) != 0) throw h5pp::runtime_error("Unexpected group {}", path);
+            return ++visited, true;
+        },
+        search);
+    if(visited != 16) throw h5pp::runtime_error("Found {} groups, expected 16", visited);
+
+    // A pattern combines with the substring key, the depth limit and hit limit
+    search.pattern   = h5pp::PathPattern("run_*/step_*/*");
+    search.searchKey = "energy";
+    search.maxHits   = 5;
+    size_t hits      = 0;
+    file.findDatasets([&](std::string_view) { return ++hits, true; }, search);
+    if(hits != 5) throw h5pp::runtime_error("Found {} datasets, expected 5", hits);
+    search.maxHits  = -1;
+    search.maxDepth = 1;
+    hits            = 0;
+    file.findDatasets([&](std::string_view) { return ++hits, true; }, search);
+    if(hits != 0) throw h5pp::runtime_error("Found {} datasets beyond the depth limit", hits);
+
+    // Symbolic links are matched by their own path when followed
+    search                = h5pp::LinkSearch();
+    search.pattern        = h5pp::PathPattern("run_0/latest");
+    search.followSymlinks = true;
+    hits                  = 0;
+    file.findDatasets([&](std::string_view) { return ++hits, true; }, search);
+    if(hits != 1) throw h5pp::runtime_error("The followed soft link was not found");
+
+    // Worker processes give the same matches
+    search            = h5pp::LinkSearch();
+    search.pattern    = h5pp::PathPattern("run_*/step_1*/energy");
+    search.numWorkers = 3;
+    std::vector<std::string> parallel;
+    file.findDatasets([&](std::string_view path) { return parallel.emplace_back(path), true; }, search);
+    std::sort(parallel.begin(), parallel.end());
+    auto serial = file.findDatasets(search.pattern);
+    std::sort(serial.begin(), serial.end());
+    if(parallel != serial or serial.size() != 28) throw h5pp::runtime_error("Parallel search found {}, serial found {}", parallel.size(), serial.size());
+
+    // The link index understands the same patterns
+    file.flush();
+    h5pp::File      reader(filePath, h5pp::FileAccess::READONLY, 2);
+    h5pp::LinkQuery query;
+    query.match   = h5pp::LinkMatch::REGEX;
+    query.pattern = "run_\\d+/step_(1|2)\\d*/energy";
+    query.objType = H5O_TYPE_DATASET;
+    if(reader.getLinkIndex().find(query).size() != 32) throw h5pp::runtime_error("The index found {} regex matches", reader.getLinkIndex().find(query).size());
+    h5pp::fs::remove(h5pp::LinkIndex::sidecarPath(filePath));
+    return 0;
+}
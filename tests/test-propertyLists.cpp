@@ -0,0 +1,45 @@
+#include <h5pp/h5pp.h>
+
+H5F_close_degree_t getCloseDegree(const h5pp::hid::h5p &fileAccess) {
+    H5F_close_degree_t degree;
+    if(H5Pget_fclose_degree(fileAccess, &degree) < 0) throw h5pp::runtime_error("H5Pget_fclose_degree failed");
+    return degree;
+}
+
+int main() {
+    // The default instance is created once and shared
+    const auto &defaults = h5pp::PropertyLists::defaults();
+    if(&defaults != &h5pp::PropertyLists::defaults()) throw h5pp::runtime_error("PropertyLists::defaults() returned different instances");
+    if(getCloseDegree(defaults.fileAccess) != H5F_CLOSE_STRONG) throw h5pp::runtime_error("Default close degree should be H5F_CLOSE_STRONG");
+
+    // Copies share the property lists until one of them is made writable
+    auto custom = defaults;
+    if(custom.fileAccess.value() != defaults.fileAccess.value()) throw h5pp::runtime_error("A copy of PropertyLists should share its property lists");
+    H5Pset_fclose_degree(h5pp::PropertyLists::writable(custom.fileAccess), H5F_CLOSE_WEAK);
+    if(custom.fileAccess.value() == defaults.fileAccess.value()) throw h5pp::runtime_error("writable() should unshare the property list");
+    if(custom.linkCreate.value() != defaults.linkCreate.value()) throw h5pp::runtime_error("writable() should only copy the given property list");
+    if(getCloseDegree(custom.fileAccess) != H5F_CLOSE_WEAK) throw h5pp::runtime_error("Failed to modify the writable property list");
+    if(getCloseDegree(defaults.fileAccess) != H5F_CLOSE_STRONG) throw h5pp::runtime_error("Modifying a copy changed the default property lists");
+
+    // A property list that is not shared is modified in place
+    auto fileAccess = custom.fileAccess.value();
+    if(h5pp::PropertyLists::writable(custom.fileAccess).value() != fileAccess) throw h5pp::runtime_error("writable() copied an unshared property list");
+
+    // Files constructed from the same PropertyLists do not affect each other when configured
+    std::string outputFilename = "output/propertyLists.h5";
+    size_t      logLevel       = 2;
+    h5pp::File  file1(outputFilename, h5pp::FileAccess::REPLACE, logLevel, false, custom);
+    h5pp::File  file2(outputFilename, h5pp::FileAccess::READWRITE, logLevel, false, custom);
+    file1.setCloseDegree(H5F_CLOSE_STRONG);
+    if(getCloseDegree(file2.plists.fileAccess) != H5F_CLOSE_WEAK) throw h5pp::runtime_error("Configuring one file changed another");
+    if(getCloseDegree(custom.fileAccess) != H5F_CLOSE_WEAK) throw h5pp::runtime_error("Configuring a file changed the given property lists");
+
+    // The free functions use the default instance unless told otherwise
+    file1.writeDataset(std::vector<double>(10, 1.0), "data");
+    h5pp::hid::h5f fileHandle = H5Fopen(file1.getFilePath().c_str(), H5F_ACC_RDONLY, defaults.fileAccess);
+    h5pp::Options  options;
+    options.linkPath = "data";
+    auto info        = h5pp::scan::readDsetInfo(fileHandle, options);
+    if(info.dsetDims != std::vector<hsize_t>{10}) throw h5pp::runtime_error("Failed to scan dataset with the default property lists");
+    return 0;
+}
@@ -0,0 +1,48 @@
+#include <complex>
+#include <cstring>
+#include <h5pp/h5pp.h>
+
+int main() {
+    h5pp::File file("output/readAllAttributes.h5", h5pp::FileAccess::REPLACE, 2);
+    file.writeDataset(std::vector<double>(10, 1.0), "data");
+    file.writeAttribute(42, "data", "int");
+    file.writeAttribute(7ul, "data", "unsigned");
+    file.writeAttribute(2.5f, "data", "float");
+    file.writeAttribute(0.125, "data", "double");
+    file.writeAttribute("electron volt", "data", "unit");
+    file.writeAttribute(std::vector<double>{1.0, 2.0, 3.0}, "data", "vector");
+    file.writeAttribute(std::vector<std::string>{"x", "yy", "zzz"}, "data", "labels");
+    file.writeAttribute(std::complex<double>(1.0, -2.0), "data", "complex");
+
+    auto attrs = file.readAllAttributes("data");
+    if(attrs.size() != 8) throw h5pp::runtime_error("Read {} attributes, expected 8", attrs.size());
+    if(attrs.at("int").get<int64_t>() != 42) throw h5pp::runtime_error("Wrong int attribute");
+    if(attrs.at("unsigned").get<uint64_t>() != 7) throw h5pp::runtime_error("Wrong unsigned attribute");
+    if(attrs.at("float").get<double>() != 2.5) throw h5pp::runtime_error("Wrong float attribute");
+    if(attrs.at("double").get<double>() != 0.125 or not attrs.at("double").dims.empty()) throw h5pp::runtime_error("Wrong double attribute");
+    if(attrs.at("unit").get<std::string>() != "electron volt") throw h5pp::runtime_error("Wrong text attribute: [{}]", attrs.at("unit").get<std::string>());
+    const auto &vector = attrs.at("vector");
+    if(vector.get<std::vector<double>>() != std::vector<double>{1.0, 2.0, 3.0} or vector.dims != std::vector<hsize_t>{3})
+        throw h5pp::runtime_error("Wrong vector attribute");
+    if(attrs.at("labels").get<std::vector<std::string>>() != file.readAttribute<std::vector<std::string>>("data", "labels"))
+        throw h5pp::runtime_error("Wrong text vector attribute: {}", attrs.at("labels").get<std::vector<std::string>>());
+    const auto &complex = attrs.at("complex");
+    if(not complex.holds<h5pp::AttrBuffer>()) throw h5pp::runtime_error("A compound attribute should be kept as raw bytes");
+    std::complex<double> c;
+    if(complex.get<h5pp::AttrBuffer>().data.size() != sizeof(c)) throw h5pp::runtime_error("Wrong size of the compound attribute");
+    std::memcpy(&c, complex.get<h5pp::AttrBuffer>().data.data(), sizeof(c));
+    if(c != std::complex<double>(1.0, -2.0)) throw h5pp::runtime_error("Wrong compound attribute");
+
+    // Objects without attributes, and several links at once
+    file.createGroup("empty");
+    file.writeAttribute(1, "empty", "one");
+    file.writeDataset(0, "bare");
+    auto many = file.readAllAttributes(std::vector<std::string>{"data", "bare", "empty"});
+    if(many.size() != 3 or many[0].size() != 8 or not many[1].empty() or many[2].at("one").get<int64_t>() != 1)
+        throw h5pp::runtime_error("Wrong attributes from several links");
+    try {
+        auto missing = file.readAllAttributes("missing");
+        throw std::logic_error("Read attributes of a missing link");
+    } catch(const std::logic_error &) { throw; } catch(const std::exception &) {}
+    return 0;
+}
@@ -0,0 +1,52 @@
+#include <h5pp/h5pp.h>
+
+int main() {
+    std::string outputFilename = "output/repack.h5";
+    size_t      logLevel       = 2;
+    h5pp::File  file(outputFilename, h5pp::FileAccess::REPLACE, logLevel);
+
+    // Overwrite non-chunked datasets with data of a different size
+    h5pp::Options options;
+    options.resizePolicy = h5pp::ResizePolicy::REPLACE;
+    for(auto layout : {H5D_CONTIGUOUS, H5D_COMPACT}) {
+        options.linkPath = layout == H5D_CONTIGUOUS ? "replace/contiguous" : "replace/compact";
+        options.h5Layout = layout;
+        for(size_t size : {1000ul, 2000ul, 500ul}) {
+            std::vector<double> data(size, static_cast<double>(size));
+            file.writeDataset(data, options);
+            if(file.readDataset<std::vector<double>>(options.linkPath.value()) != data)
+                throw h5pp::runtime_error("Data mismatch after replacing [{}] with {} elements", options.linkPath.value(), size);
+            auto info = file.getDatasetInfo(options.linkPath.value());
+            if(info.h5Layout != layout) throw h5pp::runtime_error("Layout changed after replacing [{}]", options.linkPath.value());
+        }
+    }
+
+    // Leave some unused space behind
+    std::vector<double> large(200000, 3.0);
+    file.writeDataset_contiguous(large, "large");
+    file.writeAttribute(std::string("root attribute"), "/", "description");
+    file.writeAttribute(42, "/", "answer");
+    file.deleteLink("large");
+
+    size_t calls    = 0;
+    auto   progress = [&calls](size_t done, size_t total, std::string_view link) {
+        calls++;
+        h5pp::print("Repacked {}/{}: {}\n", done, total, link);
+    };
+    auto oldSize   = h5pp::fs::file_size(outputFilename);
+    auto reclaimed = file.repack(progress);
+    auto newSize   = h5pp::fs::file_size(outputFilename);
+    h5pp::print("Reclaimed {} bytes: {} --> {}\n", reclaimed, oldSize, newSize);
+    if(calls != 1) throw h5pp::runtime_error("Expected one progress call, got {}", calls);
+    if(newSize >= oldSize or reclaimed != oldSize - newSize)
+        throw h5pp::runtime_error("Repack did not reclaim space: {} --> {} (reported {})", oldSize, newSize, reclaimed);
+
+    // Contents and root attributes survive the repack
+    if(file.linkExists("large")) throw h5pp::runtime_error("Deleted link reappeared after repack");
+    if(file.readDataset<std::vector<double>>("replace/contiguous") != std::vector<double>(500, 500.0))
+        throw h5pp::runtime_error("Data mismatch after repack");
+    if(file.readAttribute<std::string>("/", "description") != "root attribute")
+        throw h5pp::runtime_error("Root attribute [description] was not preserved by repack");
+    if(file.readAttribute<int>("/", "answer") != 42) throw h5pp::runtime_error("Root attribute [answer] was not preserved by repack");
+    return 0;
+}
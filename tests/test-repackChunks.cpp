@@ -0,0 +1,74 @@
+#include <h5pp/h5pp.h>
+
+int main() {
+    std::string outputFilename = "output/repackChunks.h5";
+    std::string copyFilename   = "output/repackChunks-copy.h5";
+    size_t      logLevel       = 2;
+    h5pp::File  file(outputFilename, h5pp::FileAccess::REPLACE, logLevel);
+
+    std::vector<double> data(200000);
+    for(size_t i = 0; i < data.size(); ++i) data[i] = static_cast<double>(i % 1000);
+    std::vector<int> small(100, 7);
+
+    if(h5pp::hdf5::isCompressionAvaliable()) file.setCompressionLevel(1);
+    file.writeDataset(data, "group/chunked", H5D_CHUNKED);
+    file.writeDataset(small, "group/small", H5D_COMPACT);
+    file.writeDataset(std::vector<std::string>{"hello", "world"}, "strings");
+    file.writeAttribute(std::string("chunked data"), "group/chunked", "description");
+    file.writeAttribute(std::string("root attribute"), "/", "description");
+    file.createSoftLink("group/chunked", "softlink");
+    file.setCompressionLevel(0);
+
+    auto verify = [&](h5pp::File &f) {
+        if(f.readDataset<std::vector<double>>("group/chunked") != data) throw h5pp::runtime_error("Data mismatch in [group/chunked]");
+        if(f.readDataset<std::vector<int>>("group/small") != small) throw h5pp::runtime_error("Data mismatch in [group/small]");
+        if(f.readDataset<std::vector<std::string>>("strings") != std::vector<std::string>{"hello", "world"})
+            throw h5pp::runtime_error("Data mismatch in [strings]");
+        if(f.readAttribute<std::string>("group/chunked", "description") != "chunked data")
+            throw h5pp::runtime_error("Dataset attribute was not preserved");
+        if(f.readAttribute<std::string>("/", "description") != "root attribute") throw h5pp::runtime_error("Root attribute was not preserved");
+        if(f.readDataset<std::vector<double>>("softlink") != data) throw h5pp::runtime_error("Soft link was not preserved");
+    };
+
+    // Keep the filters: chunks are copied verbatim
+    auto report = file.repackFileTo(copyFilename, h5pp::FileAccess::REPLACE);
+    h5pp::print("Raw copy: {}\n", report.string());
+    if(report.numRawChunks == 0) throw h5pp::runtime_error("Expected chunks to be copied verbatim");
+    if(report.numDatasets != 1) throw h5pp::runtime_error("Expected one dataset to be copied chunk by chunk, got {}", report.numDatasets);
+    if(report.bytesRead != report.bytesWritten) throw h5pp::runtime_error("A raw copy should write as many bytes as it reads");
+    h5pp::File copy(copyFilename, h5pp::FileAccess::READONLY, logLevel);
+    verify(copy);
+
+    // Pass the chunks through the HDF5 filter pipeline
+    h5pp::RepackOptions repackOptions;
+    repackOptions.rawChunkCopy = false;
+    report                     = file.repackFileTo(copyFilename, h5pp::FileAccess::REPLACE, repackOptions);
+    h5pp::print("Filtered copy: {}\n", report.string());
+    if(report.numFilteredChunks == 0) throw h5pp::runtime_error("Expected chunks to be passed through the filter pipeline");
+    verify(copy);
+
+    if(h5pp::hdf5::isCompressionAvaliable()) {
+        // Recompress in place, in parallel
+        repackOptions              = h5pp::RepackOptions();
+        repackOptions.compression  = 9;
+        repackOptions.numThreads   = 4;
+        size_t calls               = 0;
+        report = file.repack(repackOptions, [&calls](size_t, size_t, std::string_view) { calls++; });
+        h5pp::print("Recompressed: {}\n", report.string());
+        if(report.numRecompressedChunks == 0) throw h5pp::runtime_error("Expected chunks to be recompressed");
+        if(calls != report.numLinks) throw h5pp::runtime_error("Expected {} progress calls, got {}", report.numLinks, calls);
+        if(file.getCompressionLevel() != 0) throw h5pp::runtime_error("Repacking changed the file compression setting");
+        if(h5pp::hdf5::getDeflateLevel(file.getDatasetInfo("group/chunked").h5DsetCreate.value()) != 9)
+            throw h5pp::runtime_error("Dataset was not recompressed with level 9");
+        verify(file);
+
+        // Remove compression
+        repackOptions.compression = 0;
+        report                    = file.repack(repackOptions);
+        h5pp::print("Decompressed: {}\n", report.string());
+        if(h5pp::hdf5::getDeflateLevel(file.getDatasetInfo("group/chunked").h5DsetCreate.value()) != -1)
+            throw h5pp::runtime_error("Dataset was not decompressed");
+        verify(file);
+    }
+    return 0;
+}
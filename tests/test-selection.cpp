@@ -0,0 +1,61 @@
+#include <h5pp/h5pp.h>
+
+int main() {
+    h5pp::File file("output/selection.h5", h5pp::FileAccess::REPLACE, 2);
+
+    // A 1D dataset where each value equals its index
+    std::vector<double> values(100);
+    for(size_t i = 0; i < values.size(); ++i) values[i] = static_cast<double>(i);
+    file.writeDataset(values, "values");
+
+    // Points are read in the order they are given
+    std::vector<hsize_t> idx = {17, 3, 4, 5, 99};
+    auto                 pts = file.readSelection<std::vector<double>>("values", h5pp::Selection::indices(idx));
+    if(pts.size() != idx.size()) throw h5pp::runtime_error("Point selection read {} elements, expected {}", pts.size(), idx.size());
+    for(size_t i = 0; i < idx.size(); ++i)
+        if(pts[i] != static_cast<double>(idx[i])) throw h5pp::runtime_error("Point mismatch at {}: {} != {}", i, pts[i], idx[i]);
+
+    // Coalescing merges adjacent points into hyperslabs, which are then read in storage order
+    auto merged = h5pp::Selection::indices({8, 1, 2, 3, 7}).coalesce();
+    if(merged.numParts() != 2) throw h5pp::runtime_error("Coalesced into {} hyperslabs, expected 2", merged.numParts());
+    auto runs = file.readSelection<std::vector<double>>("values", merged);
+    if(runs != std::vector<double>{1, 2, 3, 7, 8}) throw h5pp::runtime_error("Coalesced selection mismatch");
+
+    // A union of disjoint 2D hyperslabs is read into one buffer
+    const size_t       rows = 20, cols = 10;
+    std::vector<int>   matrix(rows * cols);
+    for(size_t i = 0; i < matrix.size(); ++i) matrix[i] = static_cast<int>(i);
+    file.writeDataset(matrix, "matrix", {rows, cols});
+    h5pp::Selection blocks({h5pp::Hyperslab({2, 0}, {2, cols}), h5pp::Hyperslab({10, 4}, {3, 2})});
+    auto            blockData = file.readSelection<std::vector<int>>("matrix", blocks);
+    std::vector<int> expected;
+    for(size_t r = 2; r < 4; ++r)
+        for(size_t c = 0; c < cols; ++c) expected.push_back(static_cast<int>(r * cols + c));
+    for(size_t r = 10; r < 13; ++r)
+        for(size_t c = 4; c < 6; ++c) expected.push_back(static_cast<int>(r * cols + c));
+    if(blockData != expected) throw h5pp::runtime_error("Union of hyperslabs mismatch");
+
+    // Write into scattered points of the 2D dataset
+    auto corners = h5pp::Selection::coordinates({0, 0, 0, cols - 1, rows - 1, 0, rows - 1, cols - 1}, 2);
+    file.writeSelection(std::vector<int>{-1, -2, -3, -4}, "matrix", corners);
+    auto readBack = file.readDataset<std::vector<int>>("matrix");
+    if(readBack[0] != -1 or readBack[cols - 1] != -2 or readBack[(rows - 1) * cols] != -3 or readBack.back() != -4)
+        throw h5pp::runtime_error("Point write mismatch");
+    if(readBack[1] != 1) throw h5pp::runtime_error("Point write modified unselected elements");
+
+    // An irregular selection on a space can be read back as a Selection and applied again
+    h5pp::hid::h5s space = H5Screate_simple(2, std::vector<hsize_t>{rows, cols}.data(), nullptr);
+    blocks.applySelection(space);
+    if(H5Sis_regular_hyperslab(space) != 0) throw h5pp::runtime_error("Expected an irregular selection");
+    h5pp::Selection fromSpace(space);
+    if(file.readSelection<std::vector<int>>("matrix", fromSpace).size() != expected.size())
+        throw h5pp::runtime_error("Selection from space has the wrong size");
+
+    // Selections outside the dataset are rejected
+    bool threw = false;
+    try {
+        [[maybe_unused]] auto bad = file.readSelection<std::vector<double>>("values", h5pp::Selection::indices({100}));
+    } catch(const std::exception &) { threw = true; }
+    if(not threw) throw h5pp::runtime_error("Out-of-range selection was not rejected");
+    return 0;
+}
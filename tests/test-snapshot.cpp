@@ -0,0 +1,57 @@
+#include <h5pp/h5pp.h>
+
+int main() {
+    std::string filePath     = "output/snapshot.h5";
+    std::string snapshotPath = "output/snapshot-copy.h5";
+    h5pp::fs::remove(snapshotPath);
+    {
+        h5pp::File file(filePath, h5pp::FileAccess::REPLACE, 2);
+        file.setDriver_core(false);
+        file.setKeepFileOpened(); // With the core driver, the file only lives in memory while its handle is open
+        file.setSnapshotPolicy({snapshotPath, std::chrono::hours(1)});
+
+        std::vector<double> first(1000, 1.0), second(2000, 2.0);
+        file.writeDataset(first, "first");
+        file.snapshot();
+        file.writeDataset(second, "second"); // Writes continue while the snapshot is written
+        file.snapshot();
+        file.waitForSnapshots();
+
+        h5pp::File snapshot(snapshotPath, h5pp::FileAccess::READONLY, 2);
+        if(snapshot.readDataset<std::vector<double>>("first") != first) throw h5pp::runtime_error("Wrong dataset [first] in snapshot");
+        if(snapshot.readDataset<std::vector<double>>("second") != second) throw h5pp::runtime_error("Wrong dataset [second] in snapshot");
+        if(h5pp::fs::exists(snapshotPath + ".tmp")) throw h5pp::runtime_error("A temporary snapshot file was left behind");
+
+        // A snapshot was just taken, so the next one is not due for an hour
+        if(file.snapshotIfDue()) throw h5pp::runtime_error("Took a snapshot before it was due");
+        file.setSnapshotPolicy({snapshotPath, std::chrono::seconds(0)});
+        if(not file.snapshotIfDue()) throw h5pp::runtime_error("Did not take a snapshot that was due");
+
+        // The last snapshot is written when the file is destroyed
+        file.writeDataset(std::string("last words"), "last");
+        file.snapshot();
+    }
+    {
+        h5pp::File snapshot(snapshotPath, h5pp::FileAccess::READONLY, 2);
+        if(snapshot.readDataset<std::string>("last") != "last words") throw h5pp::runtime_error("The last snapshot was not written");
+    }
+    {
+        // By default, snapshots are written next to the file
+        h5pp::File file(filePath, h5pp::FileAccess::REPLACE, 2);
+        file.setDriver_core(false);
+        file.setKeepFileOpened();
+        file.writeDataset(42, "answer");
+        file.snapshot();
+        file.waitForSnapshots();
+        h5pp::File snapshot("output/snapshot.snapshot.h5", h5pp::FileAccess::READONLY, 2);
+        if(snapshot.readDataset<int>("answer") != 42) throw h5pp::runtime_error("Wrong dataset [answer] in default snapshot");
+    }
+    try {
+        h5pp::File file(filePath, h5pp::FileAccess::REPLACE, 2);
+        file.setSnapshotPolicy({"output/no-such-directory/snapshot.h5"});
+        file.snapshot();
+        file.waitForSnapshots();
+        throw std::logic_error("Wrote a snapshot into a missing directory");
+    } catch(const std::logic_error &) { throw; } catch(const std::exception &) {}
+    return 0;
+}
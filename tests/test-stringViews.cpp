@@ -0,0 +1,55 @@
+#include <h5pp/h5pp.h>
+
+int main() {
+    h5pp::File file("output/stringViews.h5", h5pp::FileAccess::REPLACE, 2);
+
+    std::vector<std::string> words = {"this", "is", "", "a text", "dataset"};
+    std::string              lines = "this\nis\n\na text\ndataset";
+    h5pp::hid::h5t           type8 = H5Tcopy(H5T_C_S1);
+    H5Tset_size(type8, 8);
+    H5Tset_strpad(type8, H5T_STR_NULLTERM);
+    file.writeDataset(words, "variable");
+    file.writeDataset(words, "fixed", type8);
+    file.writeAttribute(words, "fixed", "variable");
+    file.writeAttribute(words, "fixed", "fixed", std::nullopt, type8);
+
+    // Every string becomes a line of a single std::string, for variable- and fixed-length text alike
+    for(const auto &path : {"variable", "fixed"}) {
+        auto text = file.readDataset<std::string>(path);
+        if(text != lines) throw h5pp::runtime_error("Wrong text from dataset [{}]: [{}]", path, text);
+        auto attr = file.readAttribute<std::string>("fixed", path);
+        if(attr != lines) throw h5pp::runtime_error("Wrong text from attribute [{}]: [{}]", path, attr);
+        auto vstr = file.readDataset<h5pp::vstr_t>(path);
+        if(vstr != lines) throw h5pp::runtime_error("Wrong vstr_t from dataset [{}]: [{}]", path, vstr);
+    }
+    // Fixed-length strings that fill all their bytes, without null terminators
+    h5pp::hid::h5t typePad = H5Tcopy(H5T_C_S1);
+    H5Tset_size(typePad, 4);
+    H5Tset_strpad(typePad, H5T_STR_NULLPAD);
+    file.writeDataset(std::vector<std::string>{"abcd", "ef", "ghij"}, "nullpad", typePad);
+    if(file.readDataset<std::string>("nullpad") != "abcd\nef\nghij")
+        throw h5pp::runtime_error("Wrong text from null-padded strings: [{}]", file.readDataset<std::string>("nullpad"));
+    file.writeDataset(std::vector<std::string>{}, "empty");
+    if(not file.readDataset<std::string>("empty").empty()) throw h5pp::runtime_error("Text from an empty dataset");
+
+    // String views into one buffer
+    for(const auto &path : {"variable", "fixed"}) {
+        auto views = file.readStringViews(path);
+        if(std::vector<std::string>(views.begin(), views.end()) != words)
+            throw h5pp::runtime_error("Wrong string views of dataset [{}]: {}", path, views.view());
+        auto moved = std::move(views); // The views point into the buffer that moves along
+        if(moved.size() != words.size() or moved[3] != "a text") throw h5pp::runtime_error("Wrong string views after moving");
+        auto slab = file.readStringViews(path, h5pp::Hyperslab({1}, {3}));
+        if(slab.size() != 3 or slab[0] != "is" or not slab[1].empty() or slab.at(2) != "a text")
+            throw h5pp::runtime_error("Wrong string views of hyperslab in dataset [{}]: {}", path, slab.view());
+    }
+    file.writeDataset("a single string", "scalar");
+    auto scalar = file.readStringViews("scalar");
+    if(scalar.size() != 1 or scalar[0] != "a single string") throw h5pp::runtime_error("Wrong string view of scalar text: {}", scalar.view());
+    try {
+        file.writeDataset(std::vector<double>{1.0}, "numbers");
+        auto views = file.readStringViews("numbers");
+        throw std::logic_error("Read string views of numbers");
+    } catch(const std::logic_error &) { throw; } catch(const std::exception &) {}
+    return 0;
+}
@@ -0,0 +1,75 @@
+#include <h5pp/h5pp.h>
+
+int main() {
+    h5pp::File file("output/visitLinks.h5", h5pp::FileAccess::REPLACE, 2);
+    for(size_t r = 0; r < 3; ++r)
+        for(size_t s = 0; s < 5; ++s) file.writeDataset(std::vector<double>(s + 1, 1.0), h5pp::format("run_{}/step_{}/energy", r, s));
+    file.writeAttribute("eV", "run_0/step_1/energy", "unit");
+    file.writeAttribute(0.5, "run_0/step_1/energy", "scale");
+    file.writeAttribute(std::vector<int>{1, 2, 3}, "run_0/step_1/energy", "shape");
+    file.createSoftLink("run_0/step_1/energy", "latest");
+    file.writeDataset(0, "removed");
+    file.createSoftLink("removed", "dangling");
+    file.deleteLink("removed");
+
+    // Every link is visited once, with the same paths as findLinks
+    std::vector<std::string> visited;
+    size_t                   numDatasets = 0, numGroups = 0;
+    file.visitLinks("/", [&](const h5pp::LinkView &link) {
+        visited.emplace_back(link.path());
+        if(link.objType() == H5O_TYPE_DATASET) numDatasets++;
+        if(link.objType() == H5O_TYPE_GROUP) numGroups++;
+        if(link.linkType() != H5L_TYPE_HARD) throw h5pp::runtime_error("Symbolic link [{}] visited without followSymlinks", link.path());
+        if(link.name() != h5pp::fs::path(std::string(link.path())).filename().string()) throw h5pp::runtime_error("Wrong name of [{}]", link.path());
+        return true;
+    });
+    if(visited != file.findLinks()) throw h5pp::runtime_error("visitLinks and findLinks disagree:\n{}\n{}", visited, file.findLinks());
+    if(numDatasets != 15 or numGroups != 18) throw h5pp::runtime_error("Visited {} datasets and {} groups", numDatasets, numGroups);
+
+    // The visit stops when the callback returns false
+    size_t count = file.visitLinks("run_1", [](const h5pp::LinkView &link) { return link.depth() < 1; });
+    if(count != 2) throw h5pp::runtime_error("The visit went on after the callback returned false: {} links", count);
+
+    // Filters, and properties of symbolic links
+    h5pp::LinkSearch filter;
+    filter.maxDepth       = 0;
+    filter.followSymlinks = true;
+    std::vector<std::string> symlinks;
+    file.visitLinks(filter, [&](const h5pp::LinkView &link) {
+        if(link.isSymlink()) symlinks.emplace_back(h5pp::format("{}:{}", link.path(), static_cast<int>(link.objType())));
+        return true;
+    });
+    std::sort(symlinks.begin(), symlinks.end());
+    auto expected = std::vector<std::string>{h5pp::format("dangling:{}", static_cast<int>(H5O_TYPE_UNKNOWN)),
+                                             h5pp::format("latest:{}", static_cast<int>(H5O_TYPE_DATASET))};
+    if(symlinks != expected) throw h5pp::runtime_error("Wrong symbolic links: {}", symlinks);
+
+    // Properties read on demand, and opening the object
+    file.visitLinks("run_0/step_1", [&](const h5pp::LinkView &link) {
+        if(link.numAttrs() != 3 or link.refCount() != 1) throw h5pp::runtime_error("Wrong object info of [{}]", link.path());
+        h5pp::hid::h5o obj = link.open();
+        if(h5pp::hdf5::getName(obj) != "/run_0/step_1/energy") throw h5pp::runtime_error("Opened the wrong object");
+        return true;
+    });
+
+    // Attributes
+    std::vector<std::string> attrNames;
+    size_t numAttrs = file.visitAttributes("run_0/step_1/energy", [&](const h5pp::AttrView &attr) {
+        attrNames.emplace_back(attr.name());
+        if(attr.name() == "shape" and (attr.dims() != std::vector<hsize_t>{3} or attr.dataSize() != 3 * sizeof(int)))
+            throw h5pp::runtime_error("Wrong attribute [shape]: dims {} size {}", attr.dims(), attr.dataSize());
+        if(attr.name() == "scale" and H5Tequal(attr.type(), H5T_NATIVE_DOUBLE) <= 0) throw h5pp::runtime_error("Wrong type of attribute [scale]");
+        return true;
+    });
+    if(numAttrs != 3 or attrNames != file.getAttributeNames("run_0/step_1/energy"))
+        throw h5pp::runtime_error("visitAttributes and getAttributeNames disagree: {} {}", attrNames, file.getAttributeNames("run_0/step_1/energy"));
+    numAttrs = file.visitAttributes("run_0/step_1/energy", [](const h5pp::AttrView &) { return false; });
+    if(numAttrs != 1) throw h5pp::runtime_error("The attribute visit went on after the callback returned false");
+
+    // Exceptions from the callback reach the caller
+    try {
+        file.visitLinks("/", [](const h5pp::LinkView &) -> bool { throw std::logic_error("stop"); });
+        throw h5pp::runtime_error("The exception was swallowed");
+    } catch(const std::logic_error &) {}
+    return 0;
+}
@@ -0,0 +1,65 @@
+#include <h5pp/h5pp.h>
+
+// A struct with padding, stored in a table whose records are packed, so that HDF5 converts every transfer
+struct Record {
+    double  x    = 0;
+    int32_t id   = 0;
+    char    flag = 0;
+    float   w    = 0;
+    bool    operator==(const Record &r) const { return x == r.x and id == r.id and flag == r.flag and w == r.w; }
+};
+H5PP_REGISTER_COMPOUND(Record, x, id, flag, w)
+
+struct Weight {
+    float w = 0;
+};
+H5PP_REGISTER_COMPOUND(Weight, w)
+
+void checkTable(h5pp::File &file, const std::string &tablePath, const std::vector<Record> &records) {
+    h5pp::hid::h5t packed = H5Tcopy(h5pp::type::getH5Type<Record>());
+    H5Tpack(packed);
+    file.createTable(packed, tablePath, "Packed records");
+    file.writeTableRecords(records, tablePath);
+    if(file.getTableInfo(tablePath).recordBytes.value() == sizeof(Record)) throw h5pp::runtime_error("Table records are not packed");
+    if(file.readTableRecords<std::vector<Record>>(tablePath) != records) throw h5pp::runtime_error("Records mismatch in [{}]", tablePath);
+    auto weights = file.readTableField<std::vector<Weight>>(tablePath, {"w"}, h5pp::TableSelection::ALL);
+    for(size_t i = 0; i < records.size(); ++i)
+        if(weights[i].w != records[i].w) throw h5pp::runtime_error("Field mismatch in [{}] at record {}", tablePath, i);
+}
+
+int main() {
+    h5pp::File file("output/xferBuffer.h5", h5pp::FileAccess::REPLACE, 2);
+
+    std::vector<Record> records(100000);
+    for(size_t i = 0; i < records.size(); ++i) {
+        records[i].x    = static_cast<double>(i) * 0.5;
+        records[i].id   = static_cast<int32_t>(i);
+        records[i].flag = static_cast<char>('a' + i % 26);
+        records[i].w    = static_cast<float>(i % 1000);
+    }
+
+    // The HDF5 default, a small fixed size with many conversion passes, and automatic sizing
+    checkTable(file, "default", records);
+    file.setXferBufferSize(4096);
+    if(file.getXferBufferPolicy().size != 4096) throw h5pp::runtime_error("Buffer size was not set");
+    checkTable(file, "fixed", records);
+    file.setXferBufferAuto();
+    if(not file.getXferBufferPolicy().autoSize) throw h5pp::runtime_error("Automatic buffer size was not set");
+    checkTable(file, "auto", records);
+
+    // The buffers belong to h5pp: the transfer property list of the file is left alone
+    if(H5Pget_buffer(file.plists.dsetXfer, nullptr, nullptr) != h5pp::constants::minXferBuffer)
+        throw h5pp::runtime_error("The dataset transfer property list was modified");
+
+    // A single transfer can override the policy of the file
+    std::vector<int32_t> ints(50000);
+    for(size_t i = 0; i < ints.size(); ++i) ints[i] = static_cast<int32_t>(i) - 25000;
+    file.writeDataset(ints, "ints");
+    h5pp::Options options;
+    options.xferBufferPolicy = h5pp::XferBufferPolicy{64, false};
+    auto doubles             = file.readDataset<std::vector<double>>("ints", options);
+    for(size_t i = 0; i < ints.size(); ++i)
+        if(doubles[i] != static_cast<double>(ints[i])) throw h5pp::runtime_error("Converted dataset mismatch at {}", i);
+
+    return 0;
+}